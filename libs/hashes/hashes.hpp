@@ -31,6 +31,78 @@ typedef uint64_t Hash64;
 Hash32 MurmurHash32 ( const void * key, int len, uint32_t seed = 0);
 Hash64 MurmurHash64 ( const void * key, int len, uint64_t seed = 0);
 
+// incremental variant (MurmurHash2A): length is mixed in at the end,
+// so data could be hashed by pieces (see MurmurHash32Stream)
+Hash32 MurmurHash32A ( const void * key, int len, uint32_t seed = 0);
+
+/// @brief MurmurHash2A of data added by pieces, the same as MurmurHash32A of whole data
+class MurmurHash32Stream
+{
+  static const uint32_t m = 0x5bd1e995;
+  static const int r = 24;
+  
+  uint32_t m_hash;
+  uint32_t m_tail;
+  uint32_t m_count;
+  uint32_t m_size;
+  
+  static inline void mmix(uint32_t &h, uint32_t k) {
+    k *= m; 
+    k ^= k >> r; 
+    k *= m; 
+    h *= m; 
+    h ^= k;
+  }
+  
+  public:
+    MurmurHash32Stream(uint32_t seed = 0) { begin(seed); }
+    
+    void begin(uint32_t seed = 0) {
+      m_hash = seed;
+      m_tail = m_count = m_size = 0;
+    }
+    
+    void add(const void *key, size_t len) {
+      const unsigned char *data = (const unsigned char *)key;
+      m_size += len;
+      
+      // complete pending tail
+      for (; len && m_count; len--) 
+        put(*data++);
+      
+      for (; len >= 4; data += 4, len -= 4)
+        mmix(m_hash, *(const uint32_t *)data);
+      
+      for (; len; len--)
+        put(*data++);
+    }
+    
+    void add(unsigned char c) {
+      m_size++;
+      put(c);
+    }
+    
+    uint32_t end() const {
+      uint32_t h = m_hash;
+      mmix(h, m_tail);
+      mmix(h, m_size);
+      
+      h ^= h >> 13;
+      h *= m;
+      h ^= h >> 15;
+      return h;
+    }
+  
+  private:
+    void put(unsigned char c) {
+      m_tail |= (uint32_t)c << (m_count * 8);
+      if (++m_count == 4) {
+        mmix(m_hash, m_tail);
+        m_tail = m_count = 0;
+      }
+    }
+};
+
 static inline void MurmurHash(const void *s, size_t len, uint32_t *res, uint32_t seed = 0) {
   *res = MurmurHash32(s, len, seed);
 }
@@ -98,3 +98,44 @@ uint32_t MurmurHash32 ( const void * key, int len, uint32_t seed /* = 0 */ )
 
   return h;
 } 
+
+// incremental version (see MurmurHash32Stream)
+uint32_t MurmurHash32A ( const void * key, int len, uint32_t seed /* = 0 */ )
+{
+  const uint32_t m = 0x5bd1e995;
+  const int r = 24;
+  uint32_t l = len;
+
+  const unsigned char * data = (const unsigned char *)key;
+
+  uint32_t h = seed, k, t = 0;
+
+#define mmix(h,k) { k *= m; k ^= k >> r; k *= m; h *= m; h ^= k; }
+
+  while(len >= 4)
+  {
+    k = *(uint32_t *)data;
+    mmix(h, k);
+
+    data += 4;
+    len -= 4;
+  }
+
+  switch(len)
+  {
+    case 3: t ^= data[2] << 16;
+    case 2: t ^= data[1] << 8;
+    case 1: t ^= data[0];
+  };
+
+  mmix(h, t);
+  mmix(h, l);
+
+#undef mmix
+
+  h ^= h >> 13;
+  h *= m;
+  h ^= h >> 15;
+
+  return h;
+}
@@ -8,6 +8,9 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <cstring>
 
 #include "utils/ptr_array.hpp"
 #include "qclassify.hpp"
@@ -17,7 +20,9 @@ using namespace std;
 namespace gogo
 {
 
-QCBasicPhraseStorage::QCBasicPhraseStorage() : m_acclen(0), m_bDirty(true) {}
+const unsigned QCBasicPhraseStorage::BLOCK_SIZE;
+
+QCBasicPhraseStorage::QCBasicPhraseStorage() : m_acclen(0), m_bDirty(true), m_bWide(false) {}
 
 void QCBasicPhraseStorage::addPhrase(const string &s)
 {
@@ -29,17 +34,29 @@ void QCBasicPhraseStorage::addPhrase(const string &s)
   m_bDirty = true;
 }
 
+/// @return length of common prefix of @arg a and @arg b (no longer than 255)
+static inline unsigned __common_prefix(const string &a, const string &b)
+{
+  unsigned i, n = min(min(a.length(), b.length()), (size_t)0xFF);
+  for (i = 0; i < n && a[i] == b[i]; i++)
+    ;
+  return i;
+}
+
 void QCBasicPhraseStorage::prepareExport() const
 {
   if (m_bDirty) {
     m_offsets.clear();
+    m_offsets.setWide(m_bWide);
     m_acclen = 0;
-    for (vector<string>::const_iterator it = m_phrases.begin();
-        it != m_phrases.end();
-        it++)
+    for (unsigned i = 0; i < m_phrases.size(); i++)
     {
-      m_offsets.push_back(m_acclen);
-      m_acclen += it->length() + 1;
+      if (i % BLOCK_SIZE == 0) {
+        m_offsets.push_back(m_acclen);
+        m_acclen += m_phrases[i].length() + 1;
+      }
+      else
+        m_acclen += sizeof(uint8_t) + m_phrases[i].length() - __common_prefix(m_phrases[i - 1], m_phrases[i]) + 1;
     }
     m_bDirty = false;
   }
@@ -47,7 +64,7 @@ void QCBasicPhraseStorage::prepareExport() const
 
 size_t QCBasicPhraseStorage::size() const {
   prepareExport();
-  return m_offsets.size() + sizeof(uint32_t) + m_acclen;
+  return sizeof(uint32_t) + m_offsets.size() + sizeof(uint64_t) + m_acclen;
 }
 
 /// @brief reordering phraseID
@@ -67,33 +84,100 @@ void QCBasicPhraseStorage::optimize(const std::vector<unsigned> &vshift)
   }
 }
 
-// export format: [OFFSETS][SIZE][PHRASES]
+// export format: [N][BLOCK_OFFSETS][SIZE:8][BLOCKS]
+// block: [PHRASE\0]([PREFIX_LEN:1][SUFFIX\0] x (BLOCK_SIZE - 1))
 void QCBasicPhraseStorage::save(MemWriter &mwr) 
 {
   prepareExport();
+  mwr << (uint32_t)m_phrases.size();
   m_offsets.save(mwr);
   
-  mwr << (uint32_t)m_acclen;
-  for (vector<string>::iterator it = m_phrases.begin(); it != m_phrases.end(); it++)
-    mwr << *it;
+  mwr << (uint64_t)m_acclen;
+  for (unsigned i = 0; i < m_phrases.size(); i++)
+  {
+    if (i % BLOCK_SIZE == 0) {
+      mwr << m_phrases[i];
+      continue;
+    }
+    
+    uint8_t prefix = __common_prefix(m_phrases[i - 1], m_phrases[i]);
+    mwr << prefix;
+    mwr.write(m_phrases[i].c_str() + prefix, m_phrases[i].length() - prefix + 1);
+  }
 }
 
 /////////////////////////////////////////////////////////////////////////
 // QCBasicPhraseReader implementation
 /////////////////////////////////////////////////////////////////////////
 
+QCBasicPhraseReader::~QCBasicPhraseReader()
+{
+  for (unsigned i = 0; i < m_blocks.size(); i++)
+    delete[] m_blocks[i];
+}
+
 void QCBasicPhraseReader::load(MemReader &mrd)
 {
-  uint32_t sz;
+  uint64_t sz;
+  
+  for (unsigned i = 0; i < m_blocks.size(); i++)
+    delete[] m_blocks[i];
   
+  mrd >> m_n;
   m_offsets.load(mrd);
   mrd >> sz;
   m_offsets.setBase(mrd.get());
   mrd.advance((size_t)sz);
+  
+  m_blocks.assign(m_offsets.size(), NULL);
 }
 
-const char *QCBasicPhraseReader::getPhrase(unsigned i) {
-  return m_offsets.at(i);
+/// @brief decode phrases of block (the first time only)
+// Concurrent readers could decode the same block, the first decoded is kept.
+const char *QCBasicPhraseReader::decodeBlock(unsigned iblock) const
+{
+  char *pblock = m_blocks[iblock];
+  if (pblock)
+    return pblock;
+  
+  const unsigned BLOCK_SIZE = QCBasicPhraseStorage::BLOCK_SIZE;
+  unsigned i, n = min(BLOCK_SIZE, m_n - iblock * BLOCK_SIZE);
+  uint32_t offsets[BLOCK_SIZE];
+  string buf;
+  
+  const char *p = m_offsets[iblock];
+  for (i = 0; i < n; i++) 
+  {
+    offsets[i] = buf.length();
+    if (i) {
+      unsigned prefix = (uint8_t)*p++;
+      buf.append(buf, offsets[i - 1], prefix);
+    }
+    buf.append(p);
+    buf.push_back('\0');
+    p += strlen(p) + 1;
+  }
+  
+  pblock = new char[sizeof(offsets) + buf.length()];
+  memcpy(pblock, offsets, sizeof(offsets));
+  memcpy(pblock + sizeof(offsets), buf.data(), buf.length());
+  
+  if (!__sync_bool_compare_and_swap(&m_blocks[iblock], (char *)NULL, pblock)) {
+    delete[] pblock;
+    pblock = m_blocks[iblock];
+  }
+  return pblock;
+}
+
+const char *QCBasicPhraseReader::getPhrase(unsigned i) const 
+{
+  const unsigned BLOCK_SIZE = QCBasicPhraseStorage::BLOCK_SIZE;
+  if (i >= m_n)
+    throw std::out_of_range("QCBasicPhraseReader::index too large");
+  
+  const char *pblock = decodeBlock(i / BLOCK_SIZE);
+  const uint32_t *offsets = reinterpret_cast<const uint32_t *>(pblock);
+  return pblock + BLOCK_SIZE * sizeof(uint32_t) + offsets[i % BLOCK_SIZE];
 }
 
 }
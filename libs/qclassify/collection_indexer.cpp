@@ -107,6 +107,8 @@ void PhraseCollectionIndexer::save(const char *path /* = NULL */)
   logstream << "  - " << st.nwords << " words (" << st.nwords_uniq << " uniq)\n";
   logstream << "  - " << st.nphrases << " phrases (" << st.nphrases_uniq << " uniq)\n";
   logstream << "  - " << st.nregexp << " regular expressions\n";
+  if (st.nmerged)
+    logstream << "  - " << st.nmerged << " phrases merged by words\n";
   logstream << "===============================================\n\n";
   
   if (m_optimizeIndex) {
@@ -115,6 +117,19 @@ void PhraseCollectionIndexer::save(const char *path /* = NULL */)
   }
 
   sz = m_qcIndexer.size() + m_phraseIndexer.size();
+  m_phraseIndexer.getStat(&st);
+  if (st.nhotwords) {
+    logstream << "Hot keywords: " << st.nhotwords << " (" << st.nhotphrases << 
+        " phrases addressed by word pair)\n";
+  }
+  logstream << "Class lists: " << st.nclasslists << " distinct of multiclass phrases\n";
+  if (st.wide)
+    logstream << "Wide index format: 32 bit word IDs, 64 bit offsets\n";
+  if (st.nforms)
+    logstream << "Forms table: " << st.nforms << " word forms of indexed words\n";
+  if (st.ntriekeys)
+    logstream << "Exact trie: " << st.ntriekeys << " word sequences of plain phrases\n";
+  
   logstream << "Preparing phrase index to export...\n";
   logstream << "Saving(" << (unsigned)(sz >> 10) << "Kb)\n";
   
@@ -137,6 +152,24 @@ void PhraseCollectionIndexer::save(const char *path /* = NULL */)
   of.close();
 }
 
+/// @brief add word forms from file (word per line) to forms table of index
+void PhraseCollectionIndexer::addWordForms(const char *path)
+{
+  std::ifstream is(path, std::ios::in);
+  if (!is.is_open()) {
+    std::stringstream ss;
+    ss << "PhraseCollectionIndexer: failed to open file \"" << path << "\"";
+    throw std::runtime_error(ss.str());
+  }
+  
+  m_phraseIndexer.setFormsTable(true);
+  std::string s;
+  while (std::getline(is, s)) {
+    if (trim_str(s))
+      m_phraseIndexer.addWordForm(s);
+  }
+}
+
 void PhraseCollectionIndexer::saveOrigPhrases(bool bSave)
 {
   m_phraseIndexer.saveOrigPhrases(bSave);
@@ -154,6 +187,25 @@ void PhraseCollectionIndexer::indexByConfig(const XmlConfig *pcfg)
   
   pcfg->GetStr("QueryQualifier", "IndexFile", m_idxpath, "phrases.idx");
   m_optimizeIndex = pcfg->GetBool("QueryQualifier", "OptimizeIndex", m_optimizeIndex);
+  m_phraseIndexer.setHotKeywordThreshold(pcfg->GetInt("QueryQualifier", "HotKeywordThreshold", 0));
+  m_phraseIndexer.setDedupByWords(pcfg->GetBool("QueryQualifier", "DedupByWords", false));
+  m_phraseIndexer.setWideFormat(pcfg->GetBool("QueryQualifier", "WideIndex", false));
+  
+  const char *formspath = pcfg->GetStr("QueryQualifier", "WordFormsFile");
+  m_phraseIndexer.setFormsTable(pcfg->GetBool("QueryQualifier", "FormsTable", false) || formspath);
+  if (formspath)
+    addWordForms(formspath);
+  if (pcfg->GetBool("QueryQualifier", "ExactTrie", false))
+    m_phraseIndexer.setExactTrie(true);
+  
+  unsigned bypass = 0;
+  if (pcfg->GetBool("QueryQualifier", "LemmaBypassDigits", false))
+    bypass |= LemmaCache::BYPASS_DIGITS;
+  if (pcfg->GetBool("QueryQualifier", "LemmaBypassShort", false))
+    bypass |= LemmaCache::BYPASS_SHORT;
+  if (pcfg->GetBool("QueryQualifier", "LemmaBypassLatin", false))
+    bypass |= LemmaCache::BYPASS_LATIN;
+  m_phraseIndexer.setLemmaBypass(bypass);
   
   bool bSave = pcfg->GetBool("QueryQualifier", "SaveOrigins", false);
   saveOrigPhrases(bSave);
@@ -19,8 +19,11 @@
 
 #include <string>
 
+#include <algorithm>
+
 #include "utils/memfile.hpp"
 #include "utils/memio.hpp"
+#include "utils/stringutils.hpp"
 #include "qclassify.hpp"
 #include "qclassify_impl.hpp"
 
@@ -28,7 +31,7 @@ namespace gogo
 {
   
 PhraseCollectionLoader::PhraseCollectionLoader(LemInterface *plem /* = NULL */) : 
-  m_plem(plem), quiet_(false)
+  m_plem(plem), m_lemmaCache(new LemmaCache), m_hotThreshold(0), quiet_(false)
 {
   
 }
@@ -36,6 +39,8 @@ PhraseCollectionLoader::PhraseCollectionLoader(LemInterface *plem /* = NULL */)
 
 void PhraseCollectionLoader::setLemmatizer(LemInterface *plem) {
   m_plem = plem;
+  if (m_lemmaCache.get())
+    m_lemmaCache->clear();
   if (m_psearcher.get()) 
     m_psearcher->setLemmatizer(m_plem);      
 }
@@ -46,9 +51,11 @@ const QCIndexReader &PhraseCollectionLoader::getQCIndex() {
 
 /// @brief load phrase index file
 /// @arg[in] path - file path
+/// @arg[in] pclasses - names of classes to load (NULL - all)
 // We should not throw any exceptions here
 bool PhraseCollectionLoader::loadFile(const char *path, 
-                                      bool bmmap /* = false */, bool bmlock /* = false */)
+                                      bool bmmap /* = false */, bool bmlock /* = false */,
+                                      const std::vector<std::string> *pclasses /* = NULL */)
 {
   std::stringstream ss_null;
   std::ostream &logstream = (quiet_) ? ss_null : std::cerr;
@@ -88,8 +95,17 @@ bool PhraseCollectionLoader::loadFile(const char *path,
     m_qcreader->load(mrd);
     
     m_psearcher.reset(new PhraseSearcher(m_plem));
+    m_psearcher->setLemmaCache(m_lemmaCache.get());
     m_psearcher->load(mrd);
     m_psearcher->setQCIndex(m_qcreader.get());
+    
+    m_slimIndex.clear();
+    if (pclasses && !loadClasses(*pclasses, logstream)) {
+      m_psearcher.reset();
+      m_qcreader.reset();
+      m_idxfile.unload();
+      return false;
+    }
   }
   catch (std::exception &e) {
     std::cerr << "PhraseCollectionLoader: exception while loading: " << e.what() << std::endl;
@@ -102,6 +118,57 @@ bool PhraseCollectionLoader::loadFile(const char *path,
   return true;
 }
 
+/// @brief replace loaded index with in-memory index of given classes
+// Phrases of other classes (and words, postings of them) are dropped,
+// index file is released.
+bool PhraseCollectionLoader::loadClasses(const std::vector<std::string> &classes, std::ostream &logstream)
+{
+  QCClassMask mask;
+  unsigned clsid, n = 0;
+  
+  for (unsigned i = 0; i < classes.size(); i++) {
+    if (!m_qcreader->getId(classes[i], clsid)) {
+      logstream << "PhraseCollectionLoader: unknown class \"" << classes[i] << "\"\n";
+      continue;
+    }
+    if (!mask.has(clsid))
+      n++;
+    mask.add(clsid);
+  }
+  
+  // empty mask would mean all classes
+  if (!n) {
+    logstream << "PhraseCollectionLoader: none of listed classes is in index\n";
+    return false;
+  }
+  
+  PhraseIndexer idx;
+  idx.setHotKeywordThreshold(m_hotThreshold);
+  unsigned nphrases = m_psearcher->exportPhrases(idx, &mask);
+  idx.optimize();
+  
+  std::vector<char> region(idx.size());
+  MemWriter mwr(&region[0]);
+  idx.save(mwr);
+  
+  std::auto_ptr<PhraseSearcher> psearcher(new PhraseSearcher(m_plem));
+  psearcher->setLemmaCache(m_lemmaCache.get());
+  MemReader mrd(&region[0]);
+  psearcher->load(mrd);
+  psearcher->setQCIndex(m_qcreader.get());
+  
+  size_t fullsize = m_idxfile.size();
+  m_psearcher = psearcher;
+  m_slimIndex.swap(region);
+  m_idxfile.unload();
+  
+  logstream << "PhraseCollectionLoader: " << n << " of " << m_qcreader->amount() << 
+      " classes loaded (" << nphrases << " phrases): " << (m_slimIndex.size() >> 10) << 
+      "K of " << (fullsize >> 10) << "K, " << ((fullsize - std::min(fullsize, m_slimIndex.size())) >> 10) << 
+      "K saved\n";
+  return true;
+}
+
 bool PhraseCollectionLoader::loadByConfig(const XmlConfig *pcfg)
 {
   quiet_ = pcfg->GetBool( "QueryQualifier", "Quiet", false );
@@ -111,7 +178,53 @@ bool PhraseCollectionLoader::loadByConfig(const XmlConfig *pcfg)
        bmlock = pcfg->GetBool("QueryQualifier", "MLocked", false);
   
   pcfg->GetStr("QueryQualifier", "IndexFile", idxpath, "phrases.idx");
-  return loadFile(idxpath.c_str(), bmmap, bmlock);
+  m_hotThreshold = pcfg->GetInt("QueryQualifier", "HotKeywordThreshold", 0);
+  
+  int ncached = pcfg->GetInt("QueryQualifier", "LemmaCacheSize", 65536);
+  m_lemmaCache.reset((ncached > 0) ? new LemmaCache(ncached) : NULL);
+  if (m_psearcher.get())
+    m_psearcher->setLemmaCache(m_lemmaCache.get());
+  
+  // comma separated class names
+  std::vector<std::string> classes;
+  const char *pclasses = pcfg->GetStr("QueryQualifier", "LoadClasses");
+  if (pclasses) {
+    std::stringstream ss(pclasses);
+    std::string name;
+    while (std::getline(ss, name, ',')) {
+      if (trim_str(name))
+        classes.push_back(name);
+    }
+  }
+  
+  if (!loadFile(idxpath.c_str(), bmmap, bmlock, (pclasses) ? &classes : NULL))
+    return false;
+  if (m_psearcher.get())
+    m_psearcher->setStrictForms(pcfg->GetBool("QueryQualifier", "StrictForms", false));
+  
+  const char *engine = pcfg->GetStr("QueryQualifier", "ExactEngine");
+  if (engine && m_psearcher.get()) {
+    if (!strcmp(engine, "trie") && m_psearcher->hasExactTrie()) {
+      m_psearcher->setExactEngine(PhraseSearcher::EXACT_ENGINE_TRIE);
+    } 
+    else if (strcmp(engine, "index")) {
+      std::cerr << "PhraseCollectionLoader: exact engine \"" << engine << 
+          "\" isn't available (trie needs index built with ExactTrie)\n";
+      return false;
+    }
+  }
+  
+  mergeConfig(pcfg);
+  return true;
+}
+
+void PhraseCollectionLoader::mergeConfig(const XmlConfig *pcfg)
+{
+  if (!m_qcreader.get())
+    return;
+  
+  m_qcreader->mergeConfig(pcfg);
+  m_psearcher->setQCIndex(m_qcreader.get()); // searcher's rank bounds by new penalties
 }
 
 } // namespace gogo
@@ -27,11 +27,32 @@ class QCHtmlMarker
       
       bool bUniq;          // mark only uniq phrases (phrase id)
       bool bSkipFirstWord; // skip first word in sentence
+      bool bSkipRawText;   // skip contents of <script>, <style> and <textarea>
       
       bool bUseUdataAsFormat; // use userdata as format or %U marker
+      
+      codepage_t codepage; // code page of text and output (markers and userdata are transcoded)
   
       MarkupSettings() : order(MARKUP_ORDER_NATIVE), range(5), gap(0), nmax(0), 
-                     bUniq(false), bSkipFirstWord(false), bUseUdataAsFormat(true) {}
+                     bUniq(false), bSkipFirstWord(false), bSkipRawText(false), bUseUdataAsFormat(true), 
+                     codepage(CODEPAGE_UTF8) {}
+    };
+    
+    //---------------------------------------------------------------------------------
+    /// @brief buffers of markup (words, matches, markers) kept between calls by caller:
+    /// markup of similar documents with warmed up context doesn't allocate memory;
+    /// context is used by one markup at a time
+    class MarkupContext {
+        struct Buffers;
+        Buffers *m_pbuf;
+        
+        MarkupContext(const MarkupContext &);
+        MarkupContext &operator=(const MarkupContext &);
+        friend class QCHtmlMarker;
+        friend class QCHtmlMarkerImpl;
+      public:
+        MarkupContext();
+        ~MarkupContext();
     };
     
   private:
@@ -52,6 +73,10 @@ class QCHtmlMarker
     /// @return amount of marked blocks
     unsigned markup(const std::string &text, std::string &os, const MarkupSettings &st);
     
+    /// @brief the same with buffers of caller
+    /// @param ctx  - buffers of markup
+    unsigned markup(const std::string &text, std::string &os, const MarkupSettings &st, MarkupContext &ctx);
+    
     //---------------------------------------------------------------------------------
     /// @brief markup text with default settings
     unsigned markup(const std::string &text, std::string &os);
@@ -0,0 +1,70 @@
+//------------------------------------------------------------
+/// @file   lemma_cache.cpp
+/// @brief  cache of word first forms
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#include <string>
+
+#include "qclassify.hpp"
+
+namespace gogo
+{
+
+// Cache is direct-mapped and lock-free: slot is read and replaced by single
+// 64 bit operation, so reader sees either old or new (form, lemma) pair.
+// Words are keyed by hash of normalized form, the same way as index does.
+LemmaCache::LemmaCache(unsigned size /* = 65536 */)
+{
+  uint32_t n = 1;
+  while (n < size && n < (1U << 30))
+    n <<= 1;
+  
+  m_mask = n - 1;
+  m_slots = new uint64_t[n];
+  clear();
+}
+
+LemmaCache::~LemmaCache() {
+  delete[] m_slots;
+}
+
+void LemmaCache::clear() 
+{
+  for (uint32_t i = 0; i <= m_mask; i++)
+    m_slots[i] = 0;
+  __sync_synchronize();
+}
+
+bool LemmaCache::insert(uint32_t form, uint32_t lemma)
+{
+  if (!form)
+    return false;
+  
+  uint64_t slot = ((uint64_t)form << 32) | lemma;
+  uint64_t old = __sync_lock_test_and_set(&m_slots[slotOf(form)], slot);
+  return old && (uint32_t)(old >> 32) != form;
+}
+
+bool LemmaCache::isBypassed(const std::string &norm, unsigned bypass)
+{
+  size_t len = norm.length();
+  if (!bypass || !len)
+    return false;
+  
+  bool digits = true, latin = true;
+  unsigned nchars = 0;
+  for (size_t i = 0; i < len; i++) {
+    unsigned char c = norm[i];
+    if ((c & 0xC0) != 0x80)
+      nchars++;
+    digits = digits && (unsigned)(c - '0') < 10U;
+    latin = latin && c < 0x80;
+  }
+  
+  return ((bypass & BYPASS_DIGITS) && digits) || 
+         ((bypass & BYPASS_SHORT) && nchars == 1) ||
+         ((bypass & BYPASS_LATIN) && latin);
+}
+
+} // namespace gogo
@@ -7,6 +7,8 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <stdexcept>
 
 //#define PHRASE_INDEXER_DEBUG
 
@@ -19,6 +21,7 @@
 
 #include "utils/hash_array.hpp"
 #include "utils/ptr_array.hpp"
+#include "utils/da_trie.hpp"
 #include "qclassify.hpp"
 #include "qclassify_impl.hpp"
 #include "hashes/hashes.hpp"
@@ -39,15 +42,18 @@ class PhraseIndexerImpl : public QSerializerOut
   /// @brief phrase information class:
   /// @brief store separate words
   class Phrase {
-    vector<word_entry> m_words;
+    vector<word_entry_wide> m_words; // saved as narrow or wide words (see setWideFormat)
     vector<phrase_cls_info> m_classes;
     bool m_isRegexp;
+    string m_key; // normalized words separated by space (see setExactTrie)
     
     public:
       Phrase() : m_isRegexp(false) {}
       void setRegexp(bool isRegexp) { m_isRegexp = isRegexp; }
+      void setKey(const string &key) { m_key = key; }
+      const string &key() const { return m_key; }
       void addWord(unsigned id, unsigned form_hash, bool upcased) {
-        qcls_impl::word_entry we;
+        qcls_impl::word_entry_wide we;
         we.id = id;
         we.form = form_hash;
         we.upcased = upcased ? 1 : 0;
@@ -62,47 +68,113 @@ class PhraseIndexerImpl : public QSerializerOut
         m_classes.push_back(ci);
       }
       
+      /// @brief raise rank of phrase class if phrase has it already
+      /// @return false if phrase has no such class
+      bool mergeClass(unsigned clsid, unsigned phrase_rank) {
+        for (unsigned i = 0; i < m_classes.size(); i++) {
+          if (m_classes[i].clsid == clsid) {
+            m_classes[i].phrase_rank = max((unsigned)m_classes[i].phrase_rank, phrase_rank);
+            return true;
+          }
+        }
+        return false;
+      }
+      
+      /// @brief phrases have the same word sequence (IDs, forms and capitalization)
+      bool sameWords(const Phrase &ph) const {
+        if (ph.m_words.size() != m_words.size())
+          return false;
+        for (unsigned i = 0; i < m_words.size(); i++) {
+          const word_entry_wide &a = m_words[i], &b = ph.m_words[i];
+          if (a.id != b.id || a.form != b.form || a.upcased != b.upcased)
+            return false;
+        }
+        return true;
+      }
+      
       unsigned nwords() const { return m_words.size(); }
+      bool isRegexp() const { return m_isRegexp; }
+      /// @brief single-word phrases are stored inline in word dictionary
+      bool isSingle() const { return m_words.size() == 1 && !m_isRegexp; }
+      const vector<phrase_cls_info> &classes() const { return m_classes; }
+      unsigned maxRank() const {
+        unsigned r = 0;
+        for (unsigned i = 0; i < m_classes.size(); i++)
+          r = max(r, (unsigned)m_classes[i].phrase_rank);
+        return r;
+      }
+      /// @brief folded bitmap of phrase classes (see QCClassMask)
+      uint32_t classMask() const {
+        uint32_t mask = 0;
+        for (unsigned i = 0; i < m_classes.size(); i++)
+          mask |= QCClassMask::foldedBit(m_classes[i].clsid);
+        return mask;
+      }
+      const vector<word_entry_wide> &words() const { return m_words; }
       
       
       // format of export:
-      // [number of words(NW)][word_entry x NW][number of cls(NC)][phrase_cls_info x NC]
-      size_t size() const {
-        return sizeof(uint8_t)  + m_words.size() * sizeof(word_entry) + 
-               sizeof(uint16_t) + m_classes.size() * sizeof(phrase_cls_info);
+      // [phrase_record: number of words(NW), class reference][word_entry(_wide) x NW]
+      size_t size(bool bWide) const {
+        return sizeof(phrase_record) + 
+            m_words.size() * (bWide ? sizeof(word_entry_wide) : sizeof(word_entry));
       }
       
       /// @brief save phrase
-      void save(MemWriter &mwr) 
+      /// @arg[in] clsref - class reference (see PhraseIndexerImpl::internClasses)
+      /// @arg[in] bWide - save wide words
+      void save(MemWriter &mwr, uint32_t clsref, bool bWide) const
       {
-        unsigned i;
-        
         struct qcls_impl::phrase_record phrase_hdr;
         phrase_hdr.n = m_words.size();
         phrase_hdr.is_regexp = (int)m_isRegexp;
+        phrase_hdr.cls_inline = isClassInline();
         phrase_hdr.__reserved = 0; // shut up valgrind!
+        phrase_hdr.classes = clsref;
         
         mwr << phrase_hdr;
-        for (i = 0; i < m_words.size(); i++)
-          mwr << m_words[i];
-        
-        mwr << (uint16_t)m_classes.size();
-        for (i = 0; i < m_classes.size(); i++)
-          mwr << m_classes[i];
+        for (unsigned i = 0; i < m_words.size(); i++) {
+          if (bWide) {
+            mwr << m_words[i];
+          }
+          else {
+            word_entry we;
+            __copy_word(we, m_words[i]);
+            mwr << we;
+          }
+        }
       }
+      
+      /// @brief the only phrase class is stored in phrase record itself
+      bool isClassInline() const { return m_classes.size() == 1; }
   };
   
   // exporting things
-  mutable PtrArrayWriter<uint32_t> m_phrase_offsets;
+  mutable PtrArrayVarWriter m_phrase_offsets;
   mutable size_t m_phrases_size;
-  mutable HashArrayIndexer<word_hash_t, uint32_t> m_w2id_index;
-  mutable HashArrayIndexer<uint32_t, uint32_t>    m_words2phrases;
+  mutable bool m_bWide;  // wide index format (see PhraseIndexer::setWideFormat)
+  bool m_bForceWide;
+  mutable HashArrayIndexer<word_hash_t, uint32_t, dict_entry> m_w2id_index;
+  mutable vector<char> m_singles;
+  mutable HashArrayIndexer<uint32_t, uint32_t, posting_entry<uint32_t> > m_words2phrases;
+  mutable HashArrayIndexer<uint64_t, uint32_t, posting_entry<uint64_t> > m_pairs2phrases;
   mutable bool m_bDirty;
   
+  mutable vector<exact_entry> m_exactTable;
+  mutable vector<char> m_classLists; // interned class lists
+  mutable vector<uint32_t> m_clsRefs; // class reference by phrase ID
+  mutable unsigned m_nClassLists;
+  vector<uint8_t> m_clsMaxRank;   // max phrase rank by class ID
+  vector<uint8_t> m_clsMaxRankRE; // the same for regular expressions
+  
+  unsigned m_hotThreshold;
+  mutable unsigned m_nHotWords;
+  mutable unsigned m_nHotPhrases;
+  
   bool m_bSaveOrigPhrases;
-  QCBasicPhraseStorage m_origPhrases;
+  mutable QCBasicPhraseStorage m_origPhrases;
   PhraseRegExpWriter m_regWriter;
-  QCScatteredStringsWriter m_udataWriter;
+  mutable QCScatteredStringsWriter m_udataWriter;
   
   PhraseSplitterPlain m_splitterPlain;
   PhraseSplitterPCRE  m_splitterRE;
@@ -112,15 +184,68 @@ class PhraseIndexerImpl : public QSerializerOut
   map<phrase_hash_t, unsigned> m_phrase2id;
   vector<Phrase> m_phrases;
   
+  bool m_bDedupByWords;
+  multimap<uint32_t, unsigned> m_seq2id; // word sequence hash to phrase ID (see setDedupByWords)
+  
+  bool m_bFormsTable;
+  map<uint32_t, word_hash_t> m_forms; // word form hash to lemma hash (see setFormsTable)
+  mutable HashArrayIndexer<uint32_t, word_hash_t> m_forms_index;
+  mutable unsigned m_nForms;
+  
+  bool m_bExactTrie;
+  mutable DATrieBuilder m_trie;        // phrase key to offset of phrase list (see setExactTrie)
+  mutable vector<uint32_t> m_trieLists; // [N][PHRASE_ID x N] lists
+  
+  /// @brief order phrase IDs as postings: by number of phrase words, then by max rank (descending)
+  struct PhrasePostingLess {
+    const vector<Phrase> &m_vphrases;
+    PhrasePostingLess(const vector<Phrase> &v) : m_vphrases(v) {}
+    bool operator()(unsigned a, unsigned b) const { 
+      const Phrase &pa = m_vphrases[a], &pb = m_vphrases[b];
+      if (pa.nwords() != pb.nwords())
+        return pa.nwords() < pb.nwords();
+      return pa.maxRank() > pb.maxRank(); 
+    }
+  };
+  
   private:
-    Phrase *insertPhraseWords(const std::string &phrase, unsigned phraseId);
+    Phrase *insertPhraseWords(const std::string &phrase, unsigned &phraseId);
+    unsigned findSequence(const Phrase &ph, uint32_t fp) const;
+    unsigned wordId(word_hash_t h);
+    void postPhrase(const vector<unsigned> &wids, unsigned phraseId);
+    void addPhraseClass(Phrase *pphrase, unsigned clsid, unsigned rank);
+    void exportHotKeyword(unsigned keywordId, const vector<unsigned> &wfreq) const;
+    void exportExactTable() const;
+    void exportExactTrie() const;
+    void exportSingles(vector<uint32_t> &vOffsets) const;
+    template<class Tword>
+    void exportSingles(vector<uint32_t> &vOffsets) const;
+    bool needWideFormat() const;
+    void internClasses() const;
+    template<typename Tkey>
+    void addPosting(HashArrayIndexer<Tkey, uint32_t, posting_entry<Tkey> > &postings, 
+                    Tkey key, unsigned phraseId) const 
+    {
+      posting_entry<Tkey> e;
+      e.key = key;
+      e.value = phraseId;
+      e.nwords = m_phrases[phraseId].nwords();
+      e.maxrank = m_phrases[phraseId].maxRank();
+      e.clsmask = m_phrases[phraseId].classMask();
+      postings.add(e);
+    }
     PhraseIndexer::stat m_stat;
     
   public:
-    PhraseIndexerImpl() : m_bDirty(true), m_bSaveOrigPhrases(false) {};
+    PhraseIndexerImpl() : m_phrases_size(0), m_bWide(false), m_bForceWide(false), 
+                          m_bDirty(true), m_nClassLists(0), m_hotThreshold(0), m_nHotWords(0), 
+                          m_nHotPhrases(0), m_bSaveOrigPhrases(false), m_bDedupByWords(false), 
+                          m_bFormsTable(false), m_nForms(0), m_bExactTrie(false) {};
     virtual ~PhraseIndexerImpl() {};
     void addPhrase(unsigned clsid, const std::string &phrase, 
                    unsigned rank, const char *udata);
+    void addIndexedPhrase(const indexed_phrase &ip);
+    void addForms(const PhraseSplitterBase &splitter);
     
     // export facilities
     void prepareExport() const;
@@ -143,6 +268,10 @@ void PhraseIndexer::addPhrase(unsigned clsid, const string &phrase,
   m_pimpl->addPhrase(clsid, phrase, rank, udata);
 }
 
+void PhraseIndexer::addIndexedPhrase(const qcls_impl::indexed_phrase &ip) {
+  m_pimpl->addIndexedPhrase(ip);
+}
+
 PhraseIndexer::PhraseIndexer(LemInterface *plem /* = NULL */) { 
   m_pimpl = new PhraseIndexerImpl; 
   setLemmatizer(plem);
@@ -150,7 +279,15 @@ PhraseIndexer::PhraseIndexer(LemInterface *plem /* = NULL */) {
 
 PhraseIndexer::~PhraseIndexer() { delete m_pimpl; }
 
-void PhraseIndexer::getStat(stat *st) const { *st = m_pimpl->m_stat; }
+void PhraseIndexer::getStat(stat *st) const { 
+  *st = m_pimpl->m_stat; 
+  st->nhotwords = m_pimpl->m_nHotWords;
+  st->nhotphrases = m_pimpl->m_nHotPhrases;
+  st->nclasslists = m_pimpl->m_nClassLists;
+  st->wide = m_pimpl->m_bWide;
+  st->nforms = m_pimpl->m_nForms;
+  st->ntriekeys = m_pimpl->m_trie.amount();
+}
 void PhraseIndexer::optimize() { m_pimpl->optimize(); }
 size_t PhraseIndexer::size() const { return m_pimpl->size(); }
 void PhraseIndexer::save(MemWriter &mwr) { m_pimpl->save(mwr); }
@@ -161,6 +298,41 @@ void PhraseIndexer::setLemmatizer(LemInterface *plem) {
 void PhraseIndexer::saveOrigPhrases(bool bSave) { 
   m_pimpl->m_bSaveOrigPhrases = bSave; 
 }
+void PhraseIndexer::setDedupByWords(bool bDedup) {
+  m_pimpl->m_bDedupByWords = bDedup;
+}
+void PhraseIndexer::setWideFormat(bool bWide) {
+  m_pimpl->m_bForceWide = bWide;
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::setFormsTable(bool bForms) {
+  m_pimpl->m_bFormsTable = bForms;
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::addWordForm(const std::string &word) {
+  m_pimpl->m_splitterPlain.split(word);
+  m_pimpl->addForms(m_pimpl->m_splitterPlain);
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::addFormHash(uint32_t form, uint32_t lemma) {
+  if (form != lemma)
+    m_pimpl->m_forms[form] = lemma;
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::setLemmaBypass(unsigned bypass) {
+  m_pimpl->m_splitterPlain.setLemmaBypass(bypass & INDEX_FL_BYPASS_MASK);
+  m_pimpl->m_splitterRE.setLemmaBypass(bypass & INDEX_FL_BYPASS_MASK);
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::setExactTrie(bool bTrie) {
+  m_pimpl->m_bExactTrie = bTrie;
+  m_pimpl->m_splitterPlain.setKeepNormalized(bTrie);
+  m_pimpl->m_bDirty = true;
+}
+void PhraseIndexer::setHotKeywordThreshold(unsigned n) {
+  m_pimpl->m_hotThreshold = n;
+  m_pimpl->m_bDirty = true;
+}
  
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -185,25 +357,134 @@ void PhraseIndexerImpl::addPhrase(unsigned clsid, const string &phrase,
       return;
     
     m_phrase2id.insert(pair<phrase_hash_t, unsigned>(h, phraseId));
-    if (udata != NULL)
-      m_udataWriter.add(phraseId, (string)udata);
-    
-    m_stat.nphrases_uniq++;
+    if (phraseId != m_stat.nphrases_uniq) {
+      // merged with phrase of the same words: it's origin and user data are kept
+      m_stat.nmerged++;
+    } 
+    else {
+      if (udata != NULL)
+        m_udataWriter.add(phraseId, (string)udata);
+      m_stat.nphrases_uniq++;
+    }
   }
   else {
     pphrase = &m_phrases[it->second];
     m_stat.nwords += pphrase->nwords();
   }
   
+  addPhraseClass(pphrase, clsid, rank);
+}
+
+/// @brief add class to phrase
+void PhraseIndexerImpl::addPhraseClass(Phrase *pphrase, unsigned clsid, unsigned rank)
+{
   m_stat.nphrases++;
-  pphrase->addClass(clsid, rank);
+  if (!m_bDedupByWords || !pphrase->mergeClass(clsid, rank))
+    pphrase->addClass(clsid, rank);
+  
+  vector<uint8_t> &maxRank = pphrase->isRegexp() ? m_clsMaxRankRE : m_clsMaxRank;
+  if (maxRank.size() <= clsid) {
+    m_clsMaxRank.resize(clsid + 1);
+    m_clsMaxRankRE.resize(clsid + 1);
+  }
+  if (maxRank[clsid] < (uint8_t)rank)
+    maxRank[clsid] = (uint8_t)rank;
+  
   m_bDirty = true;
 }
 
+/// @brief add phrase record of other index (see PhraseSearcher::exportPhrases)
+// Phrase isn't registered for deduplication: there is no source text.
+void PhraseIndexerImpl::addIndexedPhrase(const indexed_phrase &ip)
+{
+  unsigned phraseId = m_stat.nphrases_uniq, i, nwords = ip.words.size();
+  vector<unsigned> wids(nwords);
+  
+  if (!nwords || ip.classes.empty())
+    return;
+  
+  m_stat.nwords += nwords;
+  for (i = 0; i < nwords; i++)
+    wids[i] = wordId(ip.hashes[i]);
+  postPhrase(wids, phraseId);
+  
+  m_phrases.resize(m_phrases.size() + 1);
+  Phrase &ph = m_phrases.back();
+  ph.setRegexp(ip.isRegexp);
+  for (i = 0; i < nwords; i++)
+    ph.addWord(wids[i], ip.words[i].form, ip.words[i].upcased);
+  if (m_bExactTrie && !ip.isRegexp)
+    ph.setKey(ip.key);
+  
+  if (ip.isRegexp) {
+    m_regWriter.add(phraseId, ip.re, ip.reFlags);
+    m_stat.nregexp++;
+  }
+  if (m_bSaveOrigPhrases)
+    m_origPhrases.addPhrase(ip.orig ? ip.orig : "");
+  if (ip.udata)
+    m_udataWriter.add(phraseId, (string)ip.udata);
+  
+  m_stat.nphrases_uniq++;
+  for (i = 0; i < ip.classes.size(); i++)
+    addPhraseClass(&ph, ip.classes[i].clsid, ip.classes[i].phrase_rank);
+}
+
+/// @return ID of word by it's hash (new words are inserted)
+unsigned PhraseIndexerImpl::wordId(word_hash_t h)
+{
+  map<word_hash_t, unsigned>::iterator it = m_w2id.find(h);
+  if (it != m_w2id.end()) 
+    return it->second;
+  
+  // insert new word
+  DBG( printf("ADD_WORD: 0x%08X:%d\n", h, m_stat.nwords_uniq) );
+  m_w2id.insert(pair<word_hash_t, unsigned>(h, m_stat.nwords_uniq));
+  return m_stat.nwords_uniq++;
+}
+
+/// @brief post phrase by it's keyword
+// balance word mapping:
+// phrase will be searched by one word
+// so select the less frequent one.
+void PhraseIndexerImpl::postPhrase(const vector<unsigned> &wids, unsigned phraseId)
+{
+  m_wId2phrasesId.resize(m_stat.nwords_uniq);
+  unsigned imin = 0, vmin = m_wId2phrasesId[ wids[0] ].size();
+  
+  for (unsigned i = 1; i < wids.size(); i++) {
+    unsigned n = m_wId2phrasesId[ wids[i] ].size();
+    if (n < vmin) {
+      vmin = n;
+      imin = i;
+    }
+  }
+  
+  // add phrase id to "keyword" list
+  m_wId2phrasesId[ wids[imin] ].push_back(phraseId);
+}
+
+/// @return ID of phrase with the same word sequence as @arg ph (~0U - none)
+/// @arg[in] fp - word sequence hash of @arg ph
+unsigned PhraseIndexerImpl::findSequence(const Phrase &ph, uint32_t fp) const
+{
+  pair<multimap<uint32_t, unsigned>::const_iterator, multimap<uint32_t, unsigned>::const_iterator> range;
+  
+  range = m_seq2id.equal_range(fp);
+  for (; range.first != range.second; range.first++) {
+    if (ph.sameWords(m_phrases[range.first->second]))
+      return range.first->second;
+  }
+  return ~0U;
+}
+
 /// @brief split and insert phrase to prepareExport
 /// @arg[in] phrase - source phrase
-/// @return pointer to inserted phrase or NULL in case of empty phrase
-PhraseIndexerImpl::Phrase *PhraseIndexerImpl::insertPhraseWords(const std::string &phrase, unsigned phraseId)
+/// @arg[in,out] phraseId - ID for new phrase, ID of existing phrase if merged with it
+/// @return pointer to inserted (merged) phrase or NULL in case of empty phrase
+// Being in word deduplication mode, phrase is merged with already indexed one
+// of the same word sequence: they differ by spacing or punctuation only.
+PhraseIndexerImpl::Phrase *PhraseIndexerImpl::insertPhraseWords(const std::string &phrase, unsigned &phraseId)
 {
   string phrase_mod;
   unsigned i, nwords;
@@ -235,48 +516,41 @@ PhraseIndexerImpl::Phrase *PhraseIndexerImpl::insertPhraseWords(const std::strin
   m_stat.nwords += nwords;
   
   // map word-hash to word-id
-  wids.reserve(nwords);
+  wids.resize(nwords);
+  for (i = 0; i < nwords; i++)
+    wids[i] = wordId(pSplitter->vWords[i].hash);
+  
+  addForms(*pSplitter);
+  
+  // store words (info) of phrase
+  Phrase phnew;
+  phnew.setRegexp(isRegexp);
   for (i = 0; i < nwords; i++) {
-    word_hash_t h = pSplitter->vWords[i].hash;
-    map<word_hash_t, unsigned>::iterator it;
-    
-    it = m_w2id.find(h);
-    if (it != m_w2id.end()) 
-      wids[i] = it->second;
-    else {
-      // insert new word
-      wids[i] = m_stat.nwords_uniq;
-      m_w2id.insert(pair<word_hash_t, unsigned>(h, m_stat.nwords_uniq++));
-      DBG( printf("ADD_WORD: 0x%08X:%d\n", pSplitter->vWords[i].hash, wids[i]) );
-    } 
+    phnew.addWord(wids[i], pSplitter->vWords[i].form, pSplitter->vWords[i].upcase);
   }
   
-  // balance word mapping:
-  // phrase will be searched by one word
-  // so select the less frequent one.
-  m_wId2phrasesId.resize(m_stat.nwords_uniq);
-  unsigned imin = 0, vmin = m_wId2phrasesId[ wids[0] ].size();
-  
-  for (i = 1; i < nwords; i++) {
-    unsigned n = m_wId2phrasesId[ wids[i] ].size();
-    if (n < vmin) {
-      vmin = n;
-      imin = i;
+  if (m_bExactTrie && !isRegexp) {
+    string key(pSplitter->normalized(0));
+    for (i = 1; i < nwords; i++) {
+      key += ' ';
+      key += pSplitter->normalized(i);
     }
+    phnew.setKey(key);
   }
   
-  unsigned keywordId = wids[imin];
-  
-  // add phrase id to "keyword" list
-  m_wId2phrasesId[keywordId].push_back(phraseId);
+  if (m_bDedupByWords && !isRegexp) {
+    uint32_t fp = __word_sequence_hash(&phnew.words()[0], nwords);
+    unsigned id = findSequence(phnew, fp);
+    if (id != ~0U) {
+      phraseId = id;
+      return &m_phrases[id];
+    }
+    m_seq2id.insert(pair<uint32_t, unsigned>(fp, phraseId));
+  }
   
-  // store words (info) of phrase
-  m_phrases.resize(m_phrases.size() + 1);
+  postPhrase(wids, phraseId);
+  m_phrases.push_back(phnew);
   Phrase &ph = m_phrases.back();
-  ph.setRegexp(isRegexp);
-  for (i = 0; i < nwords; i++) {
-    ph.addWord(wids[i], pSplitter->vWords[i].form, pSplitter->vWords[i].upcase);
-  }
   
   if (isRegexp) {
     // save regular expression (modified phrase)
@@ -290,6 +564,16 @@ PhraseIndexerImpl::Phrase *PhraseIndexerImpl::insertPhraseWords(const std::strin
   return &ph;
 }
 
+/// @brief remember forms of split words which differ from their lemmas (see setFormsTable)
+void PhraseIndexerImpl::addForms(const PhraseSplitterBase &splitter)
+{
+  for (unsigned i = 0; i < splitter.vWords.size(); i++) {
+    const PhraseSplitterBase::word_info &wi = splitter.vWords[i];
+    if (wi.form != wi.hash)
+      m_forms[wi.form] = wi.hash;
+  }
+}
+
 /// @brief optimize phrase index for quicker retrieval
 // As you can see, phrases are address by words and only.
 // So, comparing with phrases containing that word (what's how phrase searcher actually works)
@@ -312,6 +596,8 @@ void PhraseIndexerImpl::optimize()
          w2p_it++) 
      {
       vector<unsigned> &v = *w2p_it;
+      // postings are walked in order of phrase length and rank (see posting_entry)
+      stable_sort(v.begin(), v.end(), PhrasePostingLess(m_phrases));
       for (unsigned i = 0; i < v.size(); i++) {
         vShiftTbl[ v[i] ] = cnt;
         v[i] = cnt++;
@@ -325,6 +611,11 @@ void PhraseIndexerImpl::optimize()
     for (it = m_phrase2id.begin(); it != m_phrase2id.end(); it++) {
       it->second = vShiftTbl[ it->second ];
     }
+    
+    multimap<uint32_t, unsigned>::iterator seq_it;
+    for (seq_it = m_seq2id.begin(); seq_it != m_seq2id.end(); seq_it++) {
+      seq_it->second = vShiftTbl[ seq_it->second ];
+    }
   }
   
   // reorder elements in m_phrases: it would be profligacy enought...
@@ -341,6 +632,208 @@ void PhraseIndexerImpl::optimize()
   m_regWriter.optimize(vShiftTbl);
   m_origPhrases.optimize(vShiftTbl);
   m_udataWriter.optimize(vShiftTbl);
+  m_bDirty = true;
+}
+
+/// @brief move postings of a hot keyword to the word pair index
+// Every phrase of the keyword is keyed by the unordered pair {keyword, partner}
+// where partner is the rarest (by phrase frequency) of the other phrase words.
+// Query containing the keyword then verifies only phrases whose partner 
+// is present in query as well. Phrases consisting of keyword only stay in
+// ordinary word-to-phrases mapping.
+/// @arg[in] keywordId - hot keyword ID
+/// @arg[in] wfreq - number of phrases containing word (by word ID)
+void PhraseIndexerImpl::exportHotKeyword(unsigned keywordId, const vector<unsigned> &wfreq) const
+{
+  const vector<unsigned> &phrases_id = m_wId2phrasesId[keywordId];
+  
+  m_nHotWords++;
+  for (unsigned i = 0; i < phrases_id.size(); i++) 
+  {
+    const vector<word_entry_wide> &words = m_phrases[ phrases_id[i] ].words();
+    unsigned partner = keywordId, vmin = ~0U;
+    
+    for (unsigned j = 0; j < words.size(); j++) {
+      unsigned wid = words[j].id;
+      if (wid != keywordId && wfreq[wid] < vmin) {
+        vmin = wfreq[wid];
+        partner = wid;
+      }
+    }
+    
+    if (partner != keywordId) {
+      addPosting(m_pairs2phrases, __word_pair_key(keywordId, partner), phrases_id[i]);
+      m_nHotPhrases++;
+    }
+    else if (!m_phrases[ phrases_id[i] ].isSingle())
+      addPosting(m_words2phrases, (uint32_t)keywordId, phrases_id[i]);
+  }
+}
+
+/// @brief build table of exact word sequences
+// open addressing (linear probing) table of phrase word sequence hashes,
+// regular expressions are not included since they need matching anyway.
+// Phrases with the same sequence (e.g. differ by punctuation only) share
+// the hash, so searcher checks every slot of the probe chain.
+void PhraseIndexerImpl::exportExactTable() const
+{
+  unsigned tblsize = 1, i;
+  while (tblsize * 7 < m_phrases.size() * 10) // load factor <= 0.7
+    tblsize <<= 1;
+  
+  exact_entry empty;
+  empty.fp = 0;
+  empty.phrase_id = ~0U;
+  m_exactTable.assign(tblsize, empty);
+  
+  for (i = 0; i < m_phrases.size(); i++) 
+  {
+    const Phrase &ph = m_phrases[i];
+    if (ph.isRegexp())
+      continue;
+    
+    uint32_t fp = __word_sequence_hash(&ph.words()[0], ph.nwords());
+    unsigned slot = fp & (tblsize - 1);
+    while (m_exactTable[slot].phrase_id != ~0U)
+      slot = (slot + 1) & (tblsize - 1);
+    
+    m_exactTable[slot].fp = fp;
+    m_exactTable[slot].phrase_id = i;
+  }
+}
+
+/// @brief build trie of plain phrase keys (normalized word sequences)
+// Phrases of the same key (differ by capitalization or punctuation) share
+// list of their IDs, trie value is offset of the list.
+void PhraseIndexerImpl::exportExactTrie() const
+{
+  map< string, vector<unsigned> > keys;
+  map< string, vector<unsigned> >::const_iterator it;
+  unsigned i;
+  
+  for (i = 0; i < m_phrases.size(); i++) {
+    if (!m_phrases[i].key().empty())
+      keys[ m_phrases[i].key() ].push_back(i);
+  }
+  
+  m_trie.clear();
+  m_trieLists.clear();
+  for (it = keys.begin(); it != keys.end(); it++) {
+    m_trie.add(it->first, m_trieLists.size());
+    m_trieLists.push_back(it->second.size());
+    m_trieLists.insert(m_trieLists.end(), it->second.begin(), it->second.end());
+  }
+}
+
+/// @brief build region of single-word phrases
+/// @arg[out] vOffsets - offset of phrases by word ID (~0U - word has no such phrases)
+void PhraseIndexerImpl::exportSingles(vector<uint32_t> &vOffsets) const
+{
+  if (m_bWide)
+    exportSingles<word_entry_wide>(vOffsets);
+  else
+    exportSingles<word_entry>(vOffsets);
+  
+  if (m_singles.size() > ~0U)
+    throw std::runtime_error("PhraseIndexer: region of single-word phrases exceeds 4Gb");
+}
+
+template<class Tword>
+void PhraseIndexerImpl::exportSingles(vector<uint32_t> &vOffsets) const
+{
+  unsigned i, j, nsingles = 0;
+  
+  vOffsets.assign(m_stat.nwords_uniq, ~0U);
+  for (i = 0; i < m_phrases.size(); i++) {
+    if (m_phrases[i].isSingle())
+      nsingles++;
+  }
+  
+  m_singles.clear();
+  m_singles.resize(nsingles * sizeof(single_phrase_t<Tword>) + m_stat.nwords_uniq * sizeof(uint32_t));
+  MemWriter mwr(&m_singles[0]);
+  
+  for (i = 0; i < m_wId2phrasesId.size(); i++) 
+  {
+    const vector<unsigned> &phrases_id = m_wId2phrasesId[i];
+    uint32_t n = 0;
+    
+    // single-word phrase is posted by its only word
+    for (j = 0; j < phrases_id.size(); j++) {
+      if (m_phrases[ phrases_id[j] ].isSingle())
+        n++;
+    }
+    if (!n)
+      continue;
+    
+    vOffsets[i] = (char *)mwr.get() - &m_singles[0];
+    mwr << n;
+    for (j = 0; j < phrases_id.size(); j++) 
+    {
+      const Phrase &ph = m_phrases[ phrases_id[j] ];
+      if (!ph.isSingle())
+        continue;
+      
+      single_phrase_t<Tword> sp;
+      sp.phrase_id = phrases_id[j];
+      sp.cls_inline = ph.isClassInline();
+      sp.clsmask = ph.classMask();
+      __copy_word(sp.word, ph.words()[0]);
+      sp.classes = m_clsRefs[ phrases_id[j] ];
+      mwr << sp;
+    }
+  }
+  
+  m_singles.resize((char *)mwr.get() - &m_singles[0]);
+}
+
+/// @brief intern phrase class lists
+// A few class/rank combinations (e.g. {news:100}) repeat across most of phrases,
+// so equal lists are saved once and phrase refers to the list by it's offset.
+// The only class of phrase fits the reference and is stored inline.
+void PhraseIndexerImpl::internClasses() const
+{
+  map<string, uint32_t> lists; // saved list to it's offset
+  
+  m_classLists.clear();
+  m_clsRefs.resize(m_phrases.size());
+  for (unsigned i = 0; i < m_phrases.size(); i++) 
+  {
+    const vector<phrase_cls_info> &classes = m_phrases[i].classes();
+    if (m_phrases[i].isClassInline()) {
+      memcpy(&m_clsRefs[i], &classes[0], sizeof(uint32_t));
+      continue;
+    }
+    
+    string key;
+    uint16_t n = classes.size();
+    key.append((const char *)&n, sizeof(n));
+    key.append((const char *)&classes[0], n * sizeof(phrase_cls_info));
+    
+    pair<map<string, uint32_t>::iterator, bool> ins = 
+        lists.insert(pair<string, uint32_t>(key, m_classLists.size()));
+    if (ins.second)
+      m_classLists.insert(m_classLists.end(), key.begin(), key.end());
+    m_clsRefs[i] = ins.first->second;
+  }
+  
+  m_nClassLists = lists.size();
+  if (m_classLists.size() > ~0U)
+    throw std::runtime_error("PhraseIndexer: class lists exceed 4Gb");
+}
+
+/// @brief check whether collection doesn't fit narrow index format
+// narrow format: 22 bit word IDs, 32 bit offsets of phrases, origins and user data
+bool PhraseIndexerImpl::needWideFormat() const
+{
+  if (m_bForceWide || m_stat.nwords_uniq > NARROW_WORD_ID_MAX)
+    return true;
+  
+  uint64_t sz = 0;
+  for (unsigned i = 0; i < m_phrases.size(); i++)
+    sz += m_phrases[i].size(false);
+  
+  return sz > ~0U || m_origPhrases.dataSize() > ~0U || m_udataWriter.dataSize() > ~0U;
 }
 
 /// @brief build wordHash -> {phrasesId} array
@@ -354,33 +847,97 @@ void PhraseIndexerImpl::prepareExport() const
   
   map<word_hash_t, unsigned>::const_iterator wh_it;
   
-  // word hash to ID mapping
+  m_bWide = needWideFormat();
+  m_origPhrases.setWide(m_bWide);
+  m_udataWriter.setWide(m_bWide);
+  
+  internClasses();
+  
+  // word hash to ID mapping (with single-word phrases inlined)
+  vector<uint32_t> vSingleOffsets;
+  exportSingles(vSingleOffsets);
+  
   m_w2id_index.clear();
   m_w2id_index.init(m_stat.nwords_uniq);
   for (wh_it = m_w2id.begin(); wh_it != m_w2id.end(); wh_it++) {
-    m_w2id_index.add(wh_it->first, wh_it->second);
+    dict_entry e;
+    e.key = wh_it->first;
+    e.value = wh_it->second;
+    e.singles = vSingleOffsets[wh_it->second];
+    m_w2id_index.add(e);
+  }
+  
+  // phrase frequency of words: needed to select pair partners of hot keywords
+  vector<unsigned> wfreq;
+  unsigned nhot = 0;
+  if (m_hotThreshold) {
+    wfreq.resize(m_stat.nwords_uniq);
+    for (vector<Phrase>::const_iterator it = m_phrases.begin(); it != m_phrases.end(); it++) {
+      const vector<word_entry_wide> &words = it->words();
+      for (unsigned i = 0; i < words.size(); i++) {
+        unsigned j;
+        for (j = 0; j < i && words[j].id != words[i].id; j++)
+          ;
+        if (j == i) // count word once per phrase
+          wfreq[ words[i].id ]++;
+      }
+    }
+    
+    for (unsigned i = 0; i < m_wId2phrasesId.size(); i++) {
+      if (m_wId2phrasesId[i].size() > m_hotThreshold)
+        nhot += m_wId2phrasesId[i].size();
+    }
   }
   
   // word ID to phrases ID mapping (multy)
   m_words2phrases.clear();
   m_words2phrases.init(m_stat.nwords_uniq);
+  m_pairs2phrases.clear();
+  m_pairs2phrases.init(nhot);
+  m_nHotWords = m_nHotPhrases = 0;
   
   for (wh_it = m_w2id.begin(); wh_it != m_w2id.end(); wh_it++) {
     unsigned word_id = wh_it->second;
     
     const vector<unsigned> &phrases_id = m_wId2phrasesId[word_id];
+    if (m_hotThreshold && phrases_id.size() > m_hotThreshold) {
+      exportHotKeyword(word_id, wfreq);
+      continue;
+    }
+    
     for (unsigned i = 0; i < phrases_id.size(); i++) {
-      m_words2phrases.add(word_id, phrases_id[i]);
+      if (!m_phrases[ phrases_id[i] ].isSingle())
+        addPosting(m_words2phrases, (uint32_t)word_id, phrases_id[i]);
+    }
+  }
+  
+  exportExactTable();
+  if (m_bExactTrie)
+    exportExactTrie();
+  
+  // forms of indexed words only: forms of other words can't be met by searcher
+  m_forms_index.clear();
+  m_nForms = 0;
+  if (m_bFormsTable) {
+    map<uint32_t, word_hash_t>::const_iterator fit;
+    for (fit = m_forms.begin(); fit != m_forms.end(); fit++)
+      m_nForms += m_w2id.count(fit->second);
+    
+    m_forms_index.init(m_nForms);
+    for (fit = m_forms.begin(); fit != m_forms.end(); fit++) {
+      if (m_w2id.count(fit->second))
+        m_forms_index.add(fit->first, fit->second);
     }
   }
   
   // build phrase offsets
   m_phrase_offsets.clear();
+  m_phrase_offsets.setWide(m_bWide);
   m_phrases_size = 0;
   vector<Phrase>::const_iterator it;
   for (it = m_phrases.begin(); it != m_phrases.end(); it++) {
     m_phrase_offsets.push_back(m_phrases_size);
-    m_phrases_size += it->size();
+    m_phrases_size += it->size(m_bWide);
   }
   
   m_bDirty = false;
@@ -390,28 +947,74 @@ void PhraseIndexerImpl::prepareExport() const
 size_t PhraseIndexerImpl::size() const 
 {
   prepareExport();
-  return m_w2id_index.size() + m_words2phrases.size() +
-      m_phrase_offsets.size() + sizeof(uint32_t) + m_phrases_size + 
-      m_regWriter.size() + m_origPhrases.size() + m_udataWriter.size();
+  return sizeof(uint32_t) + m_w2id_index.size() + sizeof(uint32_t) + m_singles.size() + 
+      m_words2phrases.size() + m_pairs2phrases.size() +
+      m_phrase_offsets.size() + (m_bWide ? sizeof(uint64_t) : sizeof(uint32_t)) + m_phrases_size + 
+      sizeof(uint32_t) + m_classLists.size() + 
+      m_regWriter.size() + m_origPhrases.size() + m_udataWriter.size() +
+      sizeof(uint32_t) + m_clsMaxRank.size() * 2 * sizeof(uint8_t) + 
+      sizeof(uint32_t) + m_exactTable.size() * sizeof(exact_entry) + 
+      (m_bFormsTable ? m_forms_index.size() : 0) + 
+      (m_bExactTrie ? m_trie.size() + sizeof(uint32_t) + m_trieLists.size() * sizeof(uint32_t) : 0);
 }
 
 /// @brief export phrase storage
-// export format: [WORD-HASH_TO_PHRASEID][PHRASES_OFFSETS][PHRASES]
+// export format: [FLAGS][WORD-HASH_TO_PHRASEID][SINGLE_WORD_PHRASES][WORD-PAIR_TO_PHRASEID][PHRASES_OFFSETS][PHRASES][CLASS_LISTS]...[EXACT_SEQUENCES][FORMS][TRIE]
+// offsets and size of phrases are 64 bit in wide format (INDEX_FL_WIDE),
+// form hash to lemma hash table is present with INDEX_FL_FORMS only,
+// trie with it's phrase lists ([TRIE][LISTS_SIZE][UINT32 x LISTS_SIZE]) - with INDEX_FL_TRIE only,
+// lemmatizer bypass rules are kept in FLAGS (INDEX_FL_BYPASS_SHIFT)
 void PhraseIndexerImpl::save(MemWriter &mwr) 
 {
   prepareExport();
   
+  mwr << (uint32_t)((m_bWide ? INDEX_FL_WIDE : 0) | (m_bFormsTable ? INDEX_FL_FORMS : 0) | 
+                    (m_bExactTrie ? INDEX_FL_TRIE : 0) | 
+                    (m_splitterPlain.getLemmaBypass() << INDEX_FL_BYPASS_SHIFT));
   m_w2id_index.save(mwr);
+  mwr << (uint32_t)m_singles.size();
+  if (!m_singles.empty())
+    mwr.write(&m_singles[0], m_singles.size());
   m_words2phrases.save(mwr);
+  m_pairs2phrases.save(mwr);
   m_phrase_offsets.save(mwr);
   
-  mwr << (uint32_t)m_phrases_size;
-  for (vector<Phrase>::iterator it = m_phrases.begin(); it != m_phrases.end(); it++)
-    it->save(mwr);
+  unsigned i;
+  if (m_bWide)
+    mwr << (uint64_t)m_phrases_size;
+  else
+    mwr << (uint32_t)m_phrases_size;
+  for (i = 0; i < m_phrases.size(); i++)
+    m_phrases[i].save(mwr, m_clsRefs[i], m_bWide);
+  
+  mwr << (uint32_t)m_classLists.size();
+  if (!m_classLists.empty())
+    mwr.write(&m_classLists[0], m_classLists.size());
   
   m_regWriter.save(mwr);
   m_origPhrases.save(mwr);
   m_udataWriter.save(mwr);
+  
+  // [NCLASSES][MAX_RANK x NCLASSES][MAX_RANK_RE x NCLASSES][TABLE_SIZE][EXACT_ENTRY x TABLE_SIZE]
+  mwr << (uint32_t)m_clsMaxRank.size();
+  for (i = 0; i < m_clsMaxRank.size(); i++)
+    mwr << m_clsMaxRank[i];
+  for (i = 0; i < m_clsMaxRankRE.size(); i++)
+    mwr << m_clsMaxRankRE[i];
+  
+  mwr << (uint32_t)m_exactTable.size();
+  for (i = 0; i < m_exactTable.size(); i++)
+    mwr << m_exactTable[i];
+  
+  if (m_bFormsTable)
+    m_forms_index.save(mwr);
+  
+  if (m_bExactTrie) {
+    m_trie.save(mwr);
+    mwr << (uint32_t)m_trieLists.size();
+    for (i = 0; i < m_trieLists.size(); i++)
+      mwr << m_trieLists[i];
+  }
 }
 
 } // namespace gogo
@@ -7,11 +7,15 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <iostream>
 
 #include "hashes/hashes.hpp"
 #include "utils/hash_array.hpp"
 #include "utils/ptr_array.hpp"
+#include "utils/da_trie.hpp"
+#include "utils/stringutils.hpp"
+#include "utils/utf8_tokenizer.hpp"
 #include "qclassify.hpp"
 #include "qclassify_impl.hpp"
 
@@ -34,37 +38,277 @@ namespace gogo
 /// @brief phrase searcher implementation
 class PhraseSearcherImpl : public QSerializerIn
 {
+  public:
+    /// @brief matched phrase with it's class list
+    struct phrase_candidate {
+      uint32_t phrase_id;
+      int      match_flags;
+      phrase_classes classes;
+      bool     pendingRE; // regular expression isn't checked yet
+    };
+    
+    /// @brief best match of class found by ranked search (see PhraseTopCollector)
+    struct top_entry {
+      unsigned clsid;
+      unsigned rank;
+      bool     exact;
+      unsigned phrase_id;
+    };
+    
+    /// @brief deferred regexp candidate with it's rank upper bound
+    struct deferred_entry {
+      unsigned bound;
+      phrase_candidate c;
+      bool operator < (const deferred_entry &e) const { return bound > e.bound; }
+    };
+    
+    /// @brief candidates receiver of processMatchingWithIDs(): plain list
+    // (receivers of ranked search see PhraseTopCollector)
+    struct CandidateList {
+      vector<phrase_candidate> &m_v;
+      CandidateList(vector<phrase_candidate> &v) : m_v(v) {}
+      
+      void add(const phrase_candidate &c) { m_v.push_back(c); }
+      unsigned minRank() const { return 0; }     // candidates ranked lower are useless
+      bool deferRegexp() const { return false; } // could regexp checking be postponed
+    };
+  
+  private:
   // following mutables present buffers
   // if you need re-enterant searchPhrase implementaion - put it in local area (slower)
-  mutable vector<word_entry> m_match;
+  mutable vector<word_entry_wide> m_match;
+  mutable vector<uint32_t> m_qid;              // query word IDs (~0U - unknown word)
+  mutable vector<const uint8_t *> m_qsingles;  // single-word phrases of query words
+  mutable vector<phrase_candidate> m_candidates;
+  mutable vector<top_entry> m_top;           // of PhraseTopCollector
+  mutable vector<deferred_entry> m_deferred;
   mutable PhraseSplitterPlain m_splitter;
   
-  PtrArrayReader<uint32_t, phrase_record> m_phrase_offsets;
-  HashArraySearcher<word_hash_t, uint32_t> m_w2id_index;
-  HashArraySearcher<uint32_t, uint32_t> m_words2phrases;
+  bool m_bWide; // wide index format (see PhraseIndexer::setWideFormat)
+  PtrArrayVarReader<phrase_record> m_phrase_offsets;
+  const char *m_classLists; // interned class lists of phrases
+  HashArraySearcher<word_hash_t, uint32_t, dict_entry> m_w2id_index;
+  bool m_bForms;       // index has forms table (m_forms)
+  bool m_bStrictForms; // words missing from forms table aren't lemmatized
+  HashArraySearcher<uint32_t, word_hash_t> m_forms;
+  const uint8_t *m_singles;
+  HashArraySearcher<uint32_t, uint32_t, posting_entry<uint32_t> > m_words2phrases;
+  HashArraySearcher<uint64_t, uint32_t, posting_entry<uint64_t> > m_pairs2phrases;
   PhraseRegExReader m_regReader;
   QCBasicPhraseReader m_origPhrases;
   QCScatteredStringsReader m_udataReader;
   
+  // exact word sequence table
+  const exact_entry *m_exactTable;
+  uint32_t m_exactMask;
+  mutable vector<uint32_t> m_exactHits;
+  
+  // trie of plain phrase keys to lists of phrase IDs (see PhraseIndexer::setExactTrie)
+  bool m_bTrie;
+  DATrieReader m_trie;
+  const uint32_t *m_trieLists; // [N][PHRASE_ID x N] lists
+  
+  /// @brief word of text scanned by trie (see scanExact)
+  struct scan_token {
+    uint32_t norm;   // offset of normalized word in m_scanNorms
+    uint32_t len;    // length of normalized word
+    uint32_t word;   // word of caller
+    bool     upcase;
+    bool     first;  // the first token of caller word
+    bool     last;   // the last token of caller word
+  };
+  mutable Utf8Tokenizer m_scanTokenizer;
+  mutable SingleByteTokenizer m_scanSbTokenizer;
+  mutable string m_scanNorms, m_scanWord;
+  mutable vector<scan_token> m_scanTokens;
+  
+  // max phrase ranks by class ID (plain phrases and regular expressions)
+  const uint8_t *m_clsMaxRank;
+  const uint8_t *m_clsMaxRankRE;
+  uint32_t m_nclasses;
+  
+  /// @brief ranking data computed by class penalties (see PhraseSearcher::updateBounds);
+  // replaced as a whole when penalties change, search uses the state taken at it's start
+  struct rank_state {
+    const QCIndexReader::ranking *pranking;  // held ranking of class index
+    const QCIndexReader::rank_table *tables; // rank tables by class ID (NULL - no class index)
+    // upper bounds of inexact match ranks (see searchBest)
+    unsigned exactBound;
+    unsigned exactBoundRE;
+    // upper bound of rank by max phrase rank for nonpartial[0] and partial[1] matches
+    unsigned rankBound[2][256];
+    // match flag combinations (bit per combination) ranked nonzero 
+    // by at least one phrase class, by phrase ID
+    vector<uint16_t> allowedFlags;
+    // upper bound of phrase rank: [2 x ID] - nonpartial, [2 x ID + 1] - partial match
+    vector<uint16_t> phraseBound;
+    
+    rank_state() : pranking(NULL), tables(NULL), exactBound(0), exactBoundRE(0) {
+      memset(rankBound, 0, sizeof(rankBound));
+    }
+    ~rank_state() { QCIndexReader::releaseRanking(pranking); }
+  };
+  
+  rank_state * volatile m_pstate;
+  mutable const rank_state *m_pcur; // state of running (or last) search, never freed by replacement
+  vector<rank_state *> m_retired;   // replaced state still used by search
+  volatile int m_lock;              // serializes replacement of state
+  mutable PhraseSearcher::search_stat m_stat;
+  
+  // classes wanted by running search (NULL - all) and their folded bitmap
+  mutable const QCClassMask *m_pmask;
+  mutable uint32_t m_clsfilter;
+  
   private:
-    inline int matchWords(const qcls_impl::word_entry *pwe, unsigned n) const;
-    inline void processMatchingWithIDs(const string &s, vector<PhraseSearcher::phrase_matched> &phrases) const;
+    template<class Tword>
+    inline int matchWords(const Tword *pwe, unsigned n) const;
+    template<unsigned N, class Tword>
+    inline int matchWordsN(const Tword *pwe) const;
+    template<class Tword>
+    inline int matchRecord(const phrase_record *phrec) const;
+    /// @return true if phrase words are the same as resolved query ones
+    template<class Tword>
+    bool sameWords(const phrase_record *phrec) const {
+      const Tword *pwe = __phrase_words<Tword>(phrec);
+      for (unsigned j = 0; j < phrec->n; j++) {
+        if (pwe[j].id != m_match[j].id || pwe[j].form != m_match[j].form || 
+            pwe[j].upcased != m_match[j].upcased)
+          return false;
+      }
+      return true;
+    }
+    /// @return position of the first unused query word with ID @arg id (or query size)
+    unsigned findWord(uint32_t id, unsigned wmask_used) const {
+      unsigned j, nq = m_qid.size();
+      for (j = 0; j < nq; j++) {
+        if (m_qid[j] == id && !(wmask_used & (1 << j)))
+          break;
+      }
+      return j;
+    }
+    /// @return false if phrase has no class wanted by search (by folded class bitmap)
+    bool isWanted(uint32_t clsmask) const {
+      if (!(clsmask & m_clsfilter)) {
+        m_stat.nfiltered++;
+        return false;
+      }
+      return true;
+    }
+    /// @return false if phrase couldn't be ranked when matched with given (PARTIAL) flag
+    bool isAllowed(const uint16_t *pallowed, uint32_t phrase_id, bool bPartial) const {
+      static const uint16_t masks[2] = {0x0F0F, 0xF0F0}; // combinations without/with PARTIAL
+      if (pallowed && !(pallowed[phrase_id] & masks[bPartial])) {
+        m_stat.npruned++;
+        return false;
+      }
+      return true;
+    }
+    /// @return false if phrase couldn't reach rank @arg minrank
+    bool outranks(uint32_t phrase_id, bool bPartial, unsigned minrank) const {
+      if (minrank && m_pcur->phraseBound[2 * phrase_id + bPartial] < minrank) {
+        m_stat.nbounded++;
+        return false;
+      }
+      return true;
+    }
+    /// @return false if phrase couldn't be ranked with match @arg flags
+    bool isRanked(const uint16_t *pallowed, uint32_t phrase_id, int flags) const {
+      if (pallowed && !(pallowed[phrase_id] & (1 << flags))) {
+        m_stat.ndropped++;
+        return false;
+      }
+      return true;
+    }
+    inline bool lookupWord(unsigned i, const dict_entry *&pde) const;
+    void startQuery(unsigned nwords) const;
+    void takeState() const;
+    void setWord(unsigned i, bool found, uint32_t id, uint32_t singles, uint32_t form, bool upcase) const;
+    template<class Tword, class Tsink>
+    inline void matchSingles(const uint8_t *psingles, const uint16_t *pallowed, Tsink &sink) const;
+    template<typename Tkey, class Tsink>
+    inline void matchPhrases(const string *ps, const posting_entry<Tkey> *pe, unsigned n, unsigned maxwords, 
+                             const uint16_t *pallowed, Tsink &sink) const;
+    /// @return true if word ID at position @arg i has been met in query before
+    bool isRepeatedWord(unsigned i) const {
+      for (unsigned k = 0; k < i; k++) {
+        if (m_match[k].found && m_match[k].id == m_match[i].id)
+          return true;
+      }
+      return false;
+    }
+    template<class Tsink>
+    inline void processMatchingWithIDs(const string *ps, bool bPrune, Tsink &sink) const;
+    void updateRankBounds(rank_state &st, const QCIndexReader &qci) const;
+    void updatePhraseTables(rank_state &st, const QCIndexReader &qci);
+    void publishState(rank_state *pst);
+    void splitScan(const string &text, const vector< pair<unsigned, unsigned> > *pwords, codepage_t cp) const;
+    bool nextScanWord(codepage_t cp, Utf8Tokenizer::word &w, size_t &ulen) const;
+    void addOccurrences(unsigned first, unsigned end, const uint32_t *plist, 
+                        vector<PhraseSearcher::exact_occurrence> &res) const;
   
   public:
-    virtual ~PhraseSearcherImpl() {}
+    PhraseSearcherImpl() : m_bWide(false), m_classLists(NULL), m_bForms(false), m_bStrictForms(false), 
+                           m_singles(NULL), m_exactTable(NULL), m_exactMask(0), m_bTrie(false), m_trieLists(NULL), 
+                           m_clsMaxRank(NULL), m_clsMaxRankRE(NULL), m_nclasses(0),
+                           m_pstate(new rank_state), m_pcur(m_pstate), m_lock(0), m_pmask(NULL), m_clsfilter(~0U) {
+      memset(&m_stat, 0, sizeof(m_stat));
+    }
+    virtual ~PhraseSearcherImpl() {
+      delete m_pstate;
+      for (unsigned i = 0; i < m_retired.size(); i++)
+        delete m_retired[i];
+    }
     virtual void load(MemReader &mwr);
     
+    /// @brief split query of code page @arg cp and resolve word IDs (m_match)
+    /// @return number of query words
+    unsigned resolveQuery(const char *s, size_t len, codepage_t cp) const;
+    unsigned resolveQuery(const string &s) const { return resolveQuery(s.data(), s.length(), CODEPAGE_UTF8); }
+    
+    /// @brief take pre-tokenized query (m_match), unresolved tokens are resolved here
+    /// @return number of query words
+    unsigned resolveTokens(const PhraseSearcher::query_token *pt, unsigned n) const;
+    /// @brief set word ID and single-word phrases of token by dictionary
+    void resolveToken(PhraseSearcher::query_token &t) const;
+    
+    /// @brief look for phrases exactly equal to resolved query (m_exactHits)
+    /// @return number of phrases found
+    unsigned searchExact() const;
+    
+    /// @brief find exact phrase occurrences in text by trie (see PhraseSearcher::scanExact)
+    /// @arg[in] pwords - words of caller (offset, length), NULL - every token is a word
+    /// @arg[in] maxwords - max number of caller words of occurrence, 0 - unlimited
+    /// @arg[in] cp - code page of text
+    /// @return number of occurrences
+    unsigned scanExact(const string &text, const vector< pair<unsigned, unsigned> > *pwords, 
+                       unsigned maxwords, codepage_t cp, vector<PhraseSearcher::exact_occurrence> &res) const;
+    
     /// @brief search phrase
     /// @arg[in] s - source phrase
-    /// @arg[out] phrases - source phrase
-    void searchPhrase(const string &s, vector<PhraseSearcher::phrase_matched> &phrases) const;
+    /// @arg[in] bPrune - skip phrases which couldn't be ranked
+    /// @arg[out] phrases - matched phrases (m_candidates)
+    /// @return number of phrases matched
+    unsigned searchPhrase(const string &s, bool bPrune) const;
+    /// @brief search resolved query (see searchPhrase)
+    /// @arg[in] ps - source phrase for regular expressions (NULL - they aren't matched)
+    unsigned searchResolved(const string *ps, bool bPrune) const;
+    
+    /// @brief set classes wanted by search (NULL - all)
+    void setClassMask(const QCClassMask *pmask) const {
+      m_pmask = (pmask && !pmask->empty()) ? pmask : NULL;
+      m_clsfilter = (m_pmask) ? m_pmask->folded() : ~0U;
+    }
+    bool isWantedClass(unsigned clsid) const { return !m_pmask || m_pmask->has(clsid); }
     
     friend class PhraseSearcher;
+    friend class PhraseTopCollector;
 };
   
 PhraseSearcher::PhraseSearcher(LemInterface *plem /* = NULL */) {
   m_pQCIndex = NULL;
+  m_exactEngine = EXACT_ENGINE_INDEX;
   m_pimpl = new PhraseSearcherImpl;
+  m_pbufresult = new QCResultArray;
   setLemmatizer(plem);
 }
 
@@ -72,17 +316,291 @@ void PhraseSearcher::setLemmatizer(LemInterface *plem) {
   m_pimpl->m_splitter.setLemmatizer(plem);
 }
 
-PhraseSearcher::~PhraseSearcher() { delete m_pimpl; }
-void PhraseSearcher::load(MemReader &mrd) {  m_pimpl->load(mrd); }
+PhraseSearcher::~PhraseSearcher() { 
+  delete m_pbufresult;
+  delete m_pimpl; 
+}
+void PhraseSearcher::load(MemReader &mrd) {  
+  m_pimpl->load(mrd); 
+  if (!hasExactTrie())
+    m_exactEngine = EXACT_ENGINE_INDEX;
+  updateBounds();
+}
 
 unsigned PhraseSearcher::searchPhrase(const string &s, vector<phrase_matched> &phrases) const
 {
-  m_pimpl->searchPhrase(s, phrases);
-  return phrases.size();
+  m_pimpl->setClassMask(NULL);
+  unsigned n = m_pimpl->searchPhrase(s, false);
+  
+  phrases.resize(n);
+  for (unsigned i = 0; i < n; i++) {
+    phrases[i].phrase_id = m_pimpl->m_candidates[i].phrase_id;
+    phrases[i].match_flags = m_pimpl->m_candidates[i].match_flags;
+  }
+  return n;
 }
 
 void PhraseSearcher::setQCIndex(QCIndexReader *pQCIndex) { 
   m_pQCIndex = pQCIndex;
+  updateBounds();
+}
+
+void PhraseSearcher::getSearchStat(search_stat *st) const {
+  *st = m_pimpl->m_stat;
+  memset(&m_pimpl->m_stat, 0, sizeof(m_pimpl->m_stat));
+}
+
+void PhraseSearcher::setLemmaCache(LemmaCache *pcache) {
+  m_pimpl->m_splitter.setLemmaCache(pcache);
+}
+
+void PhraseSearcher::getLemmaStat(LemmaCache::stat *st) const {
+  m_pimpl->m_splitter.getLemmaStat(st);
+}
+
+void PhraseSearcher::setStrictForms(bool bStrict) {
+  m_pimpl->m_bStrictForms = bStrict;
+}
+
+bool PhraseSearcher::hasFormsTable() const {
+  return m_pimpl->m_bForms;
+}
+
+void PhraseSearcher::setExactEngine(exact_engine_t e) {
+  if (e == EXACT_ENGINE_TRIE && !hasExactTrie())
+    throw std::runtime_error("PhraseSearcher: index has no exact trie");
+  m_exactEngine = e;
+}
+
+bool PhraseSearcher::hasExactTrie() const {
+  return m_pimpl->m_bTrie;
+}
+
+bool PhraseSearcher::hasRegExps() const {
+  return m_pimpl->m_regReader.amount() != 0;
+}
+
+unsigned PhraseSearcher::scanExact(const std::string &text, vector<exact_occurrence> &res, 
+                                   const QCClassMask *pmask /* = NULL */) const
+{
+  res.clear();
+  if (!m_pQCIndex) // need for penalties accounting
+    return 0;
+  
+  m_pimpl->setClassMask(pmask);
+  return m_pimpl->scanExact(text, NULL, 0, CODEPAGE_UTF8, res);
+}
+
+unsigned PhraseSearcher::scanExact(const std::string &text, const vector< pair<unsigned, unsigned> > &words, 
+                                   unsigned maxwords, vector<exact_occurrence> &res, 
+                                   const QCClassMask *pmask /* = NULL */, 
+                                   codepage_t cp /* = CODEPAGE_UTF8 */) const
+{
+  res.clear();
+  if (!m_pQCIndex)
+    return 0;
+  
+  m_pimpl->setClassMask(pmask);
+  return m_pimpl->scanExact(text, &words, maxwords, cp, res);
+}
+
+/// @brief compute ranking data by penalties of class index and replace current one
+// exactBound - any rank of inexact match (some penalty flags set),
+// exactBoundRE - any rank of regular expression matched without penalties.
+// Ranking is monotonic by base rank, so bound of class is reached on its max rank.
+// rankBound - any rank of phrase by it's max rank (searchTopK).
+// allowedFlags, phraseBound - see updatePhraseTables().
+void PhraseSearcher::updateBounds()
+{
+  PhraseSearcherImpl::rank_state *pst = new PhraseSearcherImpl::rank_state;
+  
+  if (m_pQCIndex && m_pQCIndex->amount()) {
+    pst->pranking = m_pQCIndex->acquireRanking();
+    pst->tables = pst->pranking->getTables();
+    m_pimpl->updateRankBounds(*pst, *m_pQCIndex);
+    m_pimpl->updatePhraseTables(*pst, *m_pQCIndex);
+  }
+  m_pimpl->publishState(pst);
+}
+
+/// @brief replace current ranking data with @arg pst
+// Replaced states are freed unless search (running in other thread) took it:
+// it's published in m_pcur before the search checks that state is still current 
+// (see takeState), so one of them sees the other's store past barriers.
+void PhraseSearcherImpl::publishState(rank_state *pst)
+{
+  QueryClassifierHelper::SpinGuard guard(m_lock);
+  rank_state *pold = m_pstate;
+  
+  __sync_bool_compare_and_swap(&m_pstate, pold, pst); // full barrier: state is built before it's seen
+  m_retired.push_back(pold);
+  
+  const rank_state *pcur = m_pcur;
+  unsigned n = 0;
+  for (unsigned i = 0; i < m_retired.size(); i++) {
+    if (m_retired[i] == pcur)
+      m_retired[n++] = m_retired[i];
+    else
+      delete m_retired[i];
+  }
+  m_retired.resize(n);
+}
+
+/// @brief take current ranking data for the whole search
+void PhraseSearcherImpl::takeState() const
+{
+  do {
+    m_pcur = m_pstate;
+    __sync_synchronize();
+  } while (m_pcur != m_pstate); // replaced meanwhile: could be freed unseen
+}
+
+/// @brief compute rank bounds of search (see updateBounds)
+void PhraseSearcherImpl::updateRankBounds(rank_state &st, const QCIndexReader &qci) const
+{
+  const QCIndexReader::rank_table *tables = st.tables;
+  
+  for (unsigned clsid = 0; clsid < qci.amount(); clsid++) 
+  {
+    for (int flags = 0; flags <= 0xF; flags++) {
+      unsigned (&bound)[256] = st.rankBound[(flags & PhraseSearcher::MATCH_FL_PARTIAL) ? 1 : 0];
+      for (unsigned base = 0; base < 256; base++)
+        bound[base] = max(bound[base], QCIndexReader::applyRank(tables[clsid], base, flags));
+    }
+  }
+  
+  unsigned n = min((unsigned)qci.amount(), m_nclasses);
+  for (unsigned clsid = 0; clsid < n; clsid++) 
+  {
+    unsigned r;
+    for (int flags = 1; flags <= 0xF; flags++) {
+      r = QCIndexReader::applyRank(tables[clsid], m_clsMaxRank[clsid], flags);
+      st.exactBound = max(st.exactBound, r);
+      r = QCIndexReader::applyRank(tables[clsid], m_clsMaxRankRE[clsid], flags);
+      st.exactBound = max(st.exactBound, r);
+    }
+    r = QCIndexReader::applyRank(tables[clsid], m_clsMaxRankRE[clsid], 0);
+    st.exactBoundRE = max(st.exactBoundRE, r);
+  }
+}
+
+/// @brief compute match flag combinations allowed for every phrase and it's rank bounds
+// Zero multiplier (or truncation of small rank) makes some matches useless 
+// for all phrase classes, such candidates are skipped by ranked searches.
+void PhraseSearcherImpl::updatePhraseTables(rank_state &st, const QCIndexReader &qci)
+{
+  vector<uint16_t> &vallowed = st.allowedFlags;
+  vector<uint16_t> &vbound = st.phraseBound;
+  
+  unsigned i, j, nphrases = m_phrase_offsets.size();
+  vallowed.resize(nphrases);
+  vbound.resize(nphrases * 2);
+  for (i = 0; i < nphrases; i++) 
+  {
+    phrase_classes pcl = __phrase_classes(m_classLists, m_phrase_offsets[i]);
+    uint16_t allowed = 0;
+    unsigned bound[2] = {0, 0};
+    
+    for (j = 0; j < pcl.n; j++) 
+    {
+      unsigned clsid = pcl.clse[j].clsid;
+      if (clsid >= qci.amount()) {
+        allowed = 0xFFFF; // don't guess
+        bound[0] = bound[1] = 0xFFFF;
+        break;
+      }
+      
+      for (int flags = 0; flags <= 0xF; flags++) {
+        unsigned r = QCIndexReader::applyRank(st.tables[clsid], pcl.clse[j].phrase_rank, flags);
+        unsigned &b = bound[(flags & PhraseSearcher::MATCH_FL_PARTIAL) ? 1 : 0];
+        if (r)
+          allowed |= (1 << flags);
+        b = max(b, r);
+      }
+    }
+    vallowed[i] = allowed;
+    vbound[2 * i] = min(bound[0], 0xFFFFU);
+    vbound[2 * i + 1] = min(bound[1], 0xFFFFU);
+  }
+}
+
+/// @brief add phrases of classes @arg pmask to indexer @arg idx
+// Word IDs are resolved back to hashes by dictionary, so indexer 
+// builds the same index as from source phrases of these classes.
+unsigned PhraseSearcher::exportPhrases(PhraseIndexer &idx, const QCClassMask *pmask /* = NULL */) const
+{
+  const HashArraySearcher<word_hash_t, uint32_t, dict_entry> &dict = m_pimpl->m_w2id_index;
+  unsigned i, j, nphrases = m_pimpl->m_phrase_offsets.size(), nexported = 0;
+  vector<word_hash_t> vhashes(dict.amount());
+  
+  if (pmask && pmask->empty())
+    pmask = NULL; // all classes, as by search
+  
+  for (i = 0; i < dict.amount(); i++) {
+    if (dict.m_pentries[i].value < vhashes.size())
+      vhashes[dict.m_pentries[i].value] = dict.m_pentries[i].key;
+  }
+  
+  idx.saveOrigPhrases(nphrases && getOriginPhrase(0));
+  idx.setLemmaBypass(m_pimpl->m_splitter.getLemmaBypass());
+  
+  // forms of words of dropped phrases are dropped by indexer
+  idx.setFormsTable(m_pimpl->m_bForms);
+  for (i = 0; i < m_pimpl->m_forms.amount(); i++)
+    idx.addFormHash(m_pimpl->m_forms.m_pentries[i].key, m_pimpl->m_forms.m_pentries[i].value);
+  
+  // trie keys by phrase ID: restored from trie units
+  vector<string> vkeys;
+  idx.setExactTrie(m_pimpl->m_bTrie);
+  if (m_pimpl->m_bTrie) {
+    vector< pair<string, uint32_t> > keys;
+    m_pimpl->m_trie.keys(keys);
+    vkeys.resize(nphrases);
+    for (i = 0; i < keys.size(); i++) {
+      const uint32_t *plist = m_pimpl->m_trieLists + keys[i].second;
+      for (j = 1; j <= plist[0]; j++)
+        vkeys.at(plist[j]) = keys[i].first;
+    }
+  }
+  
+  indexed_phrase ip;
+  for (i = 0; i < nphrases; i++) 
+  {
+    const phrase_record *phrec = m_pimpl->m_phrase_offsets[i];
+    phrase_classes pcl = __phrase_classes(m_pimpl->m_classLists, phrec);
+    
+    ip.classes.clear();
+    for (j = 0; j < pcl.n; j++) {
+      if (!pmask || pmask->has(pcl.clse[j].clsid))
+        ip.classes.push_back(pcl.clse[j]);
+    }
+    if (ip.classes.empty())
+      continue;
+    
+    ip.words.resize(phrec->n);
+    ip.hashes.resize(phrec->n);
+    for (j = 0; j < phrec->n; j++) {
+      if (m_pimpl->m_bWide)
+        ip.words[j] = __phrase_words<word_entry_wide>(phrec)[j];
+      else
+        __copy_word(ip.words[j], __phrase_words<word_entry>(phrec)[j]);
+      ip.hashes[j] = vhashes.at(ip.words[j].id);
+    }
+    
+    ip.isRegexp = phrec->is_regexp;
+    ip.re.clear();
+    ip.reFlags = 0;
+    if (ip.isRegexp && !m_pimpl->m_regReader.getSource(i, ip.re, ip.reFlags))
+      continue; // broken index: regular expression isn't saved
+    
+    ip.orig = getOriginPhrase(i);
+    ip.udata = getUserData(i);
+    ip.key = vkeys.empty() ? string() : vkeys[i];
+    idx.addIndexedPhrase(ip);
+    nexported++;
+  }
+  
+  return nexported;
 }
 
 const char *PhraseSearcher::getOriginPhrase(unsigned phraseid) const
@@ -108,24 +626,177 @@ const std::string &PhraseSearcher::getClassName(unsigned clsid) const {
   return m_pQCIndex->getName(clsid);
 }
 
+/// @brief rank of match by penalties of class (search state must be taken)
 inline unsigned PhraseSearcher::applyPenalties(unsigned clsid, unsigned base, int flags) const
 {
-  double rank = (double)base;
+  return QCIndexReader::applyRank(m_pimpl->m_pcur->tables[clsid], base, flags);
+}
+
+/// @brief search for phrase and pass every class of every matched phrase to visitor
+/// @arg[in] s - phrase to match
+/// @arg[in] visitor - receiver of (class ID, phrase ID, rank, flags)
+/// @arg[in] pmask - classes to search for (NULL - all)
+unsigned PhraseSearcher::searchPhrase(const std::string &s, SearchVisitor &visitor, 
+                                      const QCClassMask *pmask /* = NULL */) const
+{
+  if (!m_pQCIndex) { // need for penalties accounting
+    return 0;
+  }
+  
+  m_pimpl->resolveQuery(s);
+  return visitResolved(&s, visitor, pmask);
+}
+
+/// @brief search resolved query and pass every class of every matched phrase to visitor
+unsigned PhraseSearcher::visitResolved(const std::string *praw, SearchVisitor &visitor, 
+                                       const QCClassMask *pmask) const
+{
+  m_pimpl->setClassMask(pmask);
+  unsigned nres = m_pimpl->searchResolved(praw, true);
+  if (!nres)
+    return 0;
+  
+  const vector<PhraseSearcherImpl::phrase_candidate> &phrasesIds = m_pimpl->m_candidates;
+  unsigned i, j, clsid, rank, nvisits = 0;
+  phrase_classes pclassList;
+  
+  for (i = 0; i < nres; i++) 
+  {
+    pclassList = phrasesIds[i].classes;
+    for (j = 0; j < pclassList.n; j++) {
+      clsid = pclassList.clse[j].clsid;
+      if (!m_pimpl->isWantedClass(clsid))
+        continue;
+      
+      rank  = applyPenalties(clsid, pclassList.clse[j].phrase_rank, phrasesIds[i].match_flags);
+      if (rank) {
+        visitor.visit(clsid, phrasesIds[i].phrase_id, rank, phrasesIds[i].match_flags);
+        nvisits++;
+      }
+    }
+  }
+  
+  return nvisits;
+}
+
+namespace {
+/// @brief visitor filling result array
+class ResultArrayFiller : public SearchVisitor
+{
+  QCResultArray &m_res;
+  public:
+    ResultArrayFiller(QCResultArray &res) : m_res(res) {}
+    virtual void visit(unsigned clsid, unsigned phrase_id, unsigned rank, int) {
+      if (clsid < m_res.capacity())
+        m_res.update(clsid, phrase_id, rank);
+    }
+};
+}
+
+/// @brief search for phrase and fill array of class_id to {phrase_id,rank}
+/// @arg[in] s - phrase to match
+/// @arg[out] res - class_id -> {phrase_id,rank} array
+/// @arg[in] pmask - classes to search for (NULL - all)
+unsigned PhraseSearcher::searchPhrase(const std::string &s, QCResultArray &res, 
+                                      const QCClassMask *pmask /* = NULL */) const
+{
+  res.clear();
+  if (!m_pQCIndex)
+    return 0;
+  
+  if (res.capacity() < m_pQCIndex->amount())
+    res.init(m_pQCIndex->amount());
+  
+  ResultArrayFiller filler(res);
+  searchPhrase(s, filler, pmask);
+  return res.size();
+}
+
+void PhraseSearcher::makeToken(const std::string &lemma, const std::string &form, query_token &t)
+{
+  std::string norm;
+  
+  utf8_normalize(lemma.data(), lemma.length(), norm);
+  t.hash = MurmurHash32A(norm.data(), norm.length());
+  norm.clear();
+  utf8_normalize(form.data(), form.length(), norm);
+  t.form = MurmurHash32A(norm.data(), norm.length());
+  t.upcase = utf8_isupper(form.c_str());
+  t.resolved = false;
+  t.id = t.singles = ~0U;
+}
+
+unsigned PhraseSearcher::tokenize(const std::string &s, std::vector<query_token> &tokens) const
+{
+  return tokenize(s.data(), s.length(), CODEPAGE_UTF8, tokens);
+}
+
+unsigned PhraseSearcher::tokenize(const char *s, size_t len, codepage_t cp, 
+                                  std::vector<query_token> &tokens) const
+{
+  unsigned n = m_pimpl->resolveQuery(s, len, cp);
+  
+  tokens.resize(n);
+  for (unsigned i = 0; i < n; i++) {
+    const PhraseSplitterPlain::word_info &wi = m_pimpl->m_splitter.vWords[i];
+    query_token &t = tokens[i];
+    
+    t.hash = wi.hash;
+    t.form = wi.form;
+    t.upcase = wi.upcase;
+    t.resolved = true;
+    t.id = m_pimpl->m_qid[i];
+    t.singles = (m_pimpl->m_qsingles[i]) ? (uint32_t)(m_pimpl->m_qsingles[i] - m_pimpl->m_singles) : ~0U;
+  }
+  return n;
+}
+
+void PhraseSearcher::resolveTokens(query_token *tokens, unsigned n) const
+{
+  for (unsigned i = 0; i < n; i++)
+    m_pimpl->resolveToken(tokens[i]);
+}
+
+unsigned PhraseSearcher::searchTokens(const query_token *tokens, unsigned n, vector<phrase_matched> &phrases, 
+                                      const std::string *praw /* = NULL */) const
+{
+  m_pimpl->setClassMask(NULL);
+  m_pimpl->resolveTokens(tokens, n);
+  unsigned nres = m_pimpl->searchResolved(praw, false);
+  
+  phrases.resize(nres);
+  for (unsigned i = 0; i < nres; i++) {
+    phrases[i].phrase_id = m_pimpl->m_candidates[i].phrase_id;
+    phrases[i].match_flags = m_pimpl->m_candidates[i].match_flags;
+  }
+  return nres;
+}
+
+unsigned PhraseSearcher::searchTokens(const query_token *tokens, unsigned n, SearchVisitor &visitor, 
+                                      const QCClassMask *pmask /* = NULL */, 
+                                      const std::string *praw /* = NULL */) const
+{
+  if (!m_pQCIndex)
+    return 0;
   
-  assert(rank != -1);
+  m_pimpl->resolveTokens(tokens, n);
+  return visitResolved(praw, visitor, pmask);
+}
+
+unsigned PhraseSearcher::searchTokens(const query_token *tokens, unsigned n, QCResultArray &res, 
+                                      const QCClassMask *pmask /* = NULL */, 
+                                      const std::string *praw /* = NULL */) const
+{
+  res.clear();
+  if (!m_pQCIndex)
+    return 0;
   
-  const QCPenalties &pens = m_pQCIndex->getPenalties(clsid);
-  rank *= pens.baseRank;
-  if (flags & MATCH_FL_REORDERED)
-    rank *= pens.reorder_penalty;
-  if (flags & MATCH_FL_DIFF_FORM)
-    rank *= pens.diff_form_penalty;
-  if (flags & MATCH_FL_PARTIAL)
-    rank *= pens.partial_penalty;
-  if (flags & MATCH_FL_DIFF_CAPS)
-    rank *= pens.diff_caps_penalty;
+  if (res.capacity() < m_pQCIndex->amount())
+    res.init(m_pQCIndex->amount());
   
-  return (unsigned)rank;
+  ResultArrayFiller filler(res);
+  searchTokens(tokens, n, filler, pmask, praw);
+  return res.size();
 }
 
 /// @brief search for phrase and return map of class_id to {phrase_id,rank}
@@ -134,45 +805,232 @@ inline unsigned PhraseSearcher::applyPenalties(unsigned clsid, unsigned base, in
 unsigned PhraseSearcher::searchPhrase(const std::string &s, res_cls_num_t &res) const
 {
   res.clear();
-  if (!m_pQCIndex) { // need for penalties accounting
-    return 0;
+  
+  const QCResultArray &ra = *m_pbufresult;
+  for (unsigned i = searchPhrase(s, *m_pbufresult); i; i--) {
+    unsigned clsid = ra.clsid(i - 1);
+    res.insert(pair<unsigned, phrase_info>(clsid, ra[clsid]));
   }
+  return res.size();
+}
+
+/// @brief is match (rank, exact) of class better than @arg best one of the same class
+static inline bool better_match(unsigned rank, bool exact, unsigned best_rank, bool best_exact) 
+{
+  if (rank != best_rank)
+    return rank > best_rank;
+  return exact && !best_exact;
+}
+
+/// @brief is class (rank, clsid) ordered before @arg other one (as selectBest does)
+static inline bool better_class(unsigned rank, unsigned clsid, unsigned other_rank, unsigned other_clsid) 
+{
+  if (rank != other_rank)
+    return rank > other_rank;
+  return clsid < other_clsid;
+}
+
+//------------------------------------------------------------------
+/// @brief receiver of candidates for ranked search: keeps k best classes
+// Candidates are offered while postings are walked; minRank() tells 
+// walker which rank is needed to change result, so the rest of posting 
+// could be skipped. Regular expressions are checked at the end and only 
+// if they could change result.
+class PhraseTopCollector
+{
+  typedef PhraseSearcherImpl::phrase_candidate phrase_candidate;
+  typedef PhraseSearcherImpl::top_entry top_entry;
+  typedef PhraseSearcherImpl::deferred_entry deferred_entry;
   
-  vector<phrase_matched> phrasesIds;
-  m_pimpl->searchPhrase(s, phrasesIds);
-  unsigned nres = phrasesIds.size();
-  if (!nres)
-    return 0;
+  const PhraseSearcher &m_srch;
+  unsigned m_k;
+  // buffers of searcher
+  vector<top_entry> &m_top; // best match of each found class, ordered by better_class
+  vector<deferred_entry> &m_deferred;
   
-  unsigned i, j, clsid;
-  res_cls_num_t::iterator rit;
+  private:
+    /// @return max rank of candidate among it's classes
+    unsigned bound(const phrase_candidate &c) const {
+      unsigned r = 0;
+      for (unsigned j = 0; j < c.classes.n; j++) {
+        if (m_srch.m_pimpl->isWantedClass(c.classes.clse[j].clsid))
+          r = max(r, m_srch.applyPenalties(c.classes.clse[j].clsid, c.classes.clse[j].phrase_rank, c.match_flags));
+      }
+      return r;
+    }
+    
+    void apply(unsigned phrase_id, const phrase_classes &pcl, int flags);
   
-  phrase_info ph_info;
+  public:
+    PhraseTopCollector(const PhraseSearcher &srch, unsigned k) : m_srch(srch), m_k(k), 
+                       m_top(srch.m_pimpl->m_top), m_deferred(srch.m_pimpl->m_deferred) {
+      m_top.clear();
+      m_deferred.clear();
+    }
+    
+    void add(const phrase_candidate &c) {
+      if (c.pendingRE) {
+        deferred_entry e;
+        e.c = c;
+        e.bound = bound(c);
+        if (e.bound)
+          m_deferred.push_back(e);
+      }
+      else
+        apply(c.phrase_id, c.classes, c.match_flags);
+    }
+    unsigned minRank() const { return (m_top.size() >= m_k) ? m_top[m_k - 1].rank : 0; }
+    bool deferRegexp() const { return true; }
+    
+    /// @brief add exact word sequence matches (PhraseSearcherImpl::searchExact)
+    void addExact(const vector<uint32_t> &vhits) {
+      for (unsigned i = 0; i < vhits.size(); i++) {
+        const phrase_record *phrec = m_srch.m_pimpl->m_phrase_offsets[ vhits[i] ];
+        apply(vhits[i], __phrase_classes(m_srch.m_pimpl->m_classLists, phrec), 0);
+      }
+    }
+    
+    /// @brief walk postings of resolved query and check deferred regular expressions
+    void search(const string *ps);
+    
+    /// @return number of classes collected (no more than k)
+    unsigned amount() const { return min((unsigned)m_top.size(), m_k); }
+    void get(unsigned i, unsigned &clsid, PhraseSearcher::phrase_info &info) const {
+      clsid = m_top[i].clsid;
+      info.rank = m_top[i].rank;
+      info.phrase_id = m_top[i].phrase_id;
+    }
+};
+
+void PhraseTopCollector::apply(unsigned phrase_id, const phrase_classes &pcl, int flags)
+{
+  bool exact = (flags == 0);
   
-  phrase_record *phrec;
-  phrase_classes_list *pclassList;
+  for (unsigned j = 0; j < pcl.n; j++) 
+  {
+    unsigned cls  = pcl.clse[j].clsid;
+    if (!m_srch.m_pimpl->isWantedClass(cls))
+      continue;
+    
+    unsigned rank = m_srch.applyPenalties(cls, pcl.clse[j].phrase_rank, flags);
+    if (!rank)
+      continue;
+    
+    unsigned i;
+    for (i = 0; i < m_top.size() && m_top[i].clsid != cls; i++)
+      ;
+    if (i == m_top.size())
+      m_top.resize(i + 1);
+    else if (!better_match(rank, exact, m_top[i].rank, m_top[i].exact))
+      continue;
+    
+    top_entry &e = m_top[i];
+    e.clsid = cls;
+    e.rank = rank;
+    e.exact = exact;
+    e.phrase_id = phrase_id;
+    
+    // class could only move up
+    for (; i && better_class(m_top[i].rank, m_top[i].clsid, m_top[i - 1].rank, m_top[i - 1].clsid); i--)
+      swap(m_top[i], m_top[i - 1]);
+  }
+}
+
+void PhraseTopCollector::search(const string *ps)
+{
+  m_srch.m_pimpl->processMatchingWithIDs(ps, true, *this);
   
-  for (i = 0; i < nres; i++) 
+  // check regular expressions starting from the most promising ones
+  stable_sort(m_deferred.begin(), m_deferred.end());
+  for (unsigned i = 0; i < m_deferred.size(); i++) 
   {
-    ph_info.phrase_id = phrasesIds[i].phrase_id;
-    phrec = m_pimpl->m_phrase_offsets[ ph_info.phrase_id ];
-    pclassList = __phrase_header_jump_to_classes(phrec);
+    const phrase_candidate &c = m_deferred[i].c;
+    if (m_deferred[i].bound < minRank())
+      break;
     
-    for (j = 0; j < pclassList->n; j++) {
-      clsid = pclassList->clse[j].clsid;
-      ph_info.rank  = applyPenalties(clsid, pclassList->clse[j].phrase_rank, phrasesIds[i].match_flags);
+    if (ps && m_srch.m_pimpl->m_regReader.match(c.phrase_id, *ps) > 0)
+      apply(c.phrase_id, c.classes, c.match_flags);
+  }
+}
+
+/// @brief search for the best matched class only
+// Result is the class with maximum rank; rank ties are resolved in favour 
+// of lower class ID (as selectBest does). Phrase of class is the one 
+// with maximum rank, exact match (no penalty flags) is preferred on ties.
+// Exact hit from word sequence table is returned immediately unless 
+// any other match could outrank it, otherwise ranked search is performed.
+/// @arg[in] s - phrase to match
+/// @arg[out] clsid - class ID of the best match
+/// @arg[out] info - phrase ID and rank of the best match
+/// @arg[in] pmask - classes to search for (NULL - all)
+/// @return false if nothing matched
+bool PhraseSearcher::searchBest(const std::string &s, unsigned &clsid, phrase_info &info, 
+                                const QCClassMask *pmask /* = NULL */) const
+{
+  if (!m_pQCIndex || !m_pimpl->resolveQuery(s))
+    return false;
+  
+  return bestResolved(&s, clsid, info, pmask);
+}
+
+bool PhraseSearcher::searchBest(const query_token *tokens, unsigned n, unsigned &clsid, phrase_info &info, 
+                                const QCClassMask *pmask /* = NULL */, 
+                                const std::string *praw /* = NULL */) const
+{
+  if (!m_pQCIndex || !m_pimpl->resolveTokens(tokens, n))
+    return false;
+  
+  return bestResolved(praw, clsid, info, pmask);
+}
+
+/// @brief search resolved query for the best matched class (see searchBest)
+bool PhraseSearcher::bestResolved(const std::string *praw, unsigned &clsid, phrase_info &info, 
+                                  const QCClassMask *pmask) const
+{
+  m_pimpl->setClassMask(pmask);
+  PhraseTopCollector top(*this, 1);
+  if (m_pimpl->searchExact()) 
+  {
+    top.addExact(m_pimpl->m_exactHits);
+    if (top.amount()) {
+      top.get(0, clsid, info);
       
-      if (ph_info.rank) {
-        rit = res.find(clsid);
-        if (rit == res.end())
-          res.insert(pair<unsigned, phrase_info>(clsid, ph_info));
-        else if (rit->second.rank < ph_info.rank) {
-          rit->second = ph_info;
-        }
-      }
+      // inexact matches could only tie (and win by lower class ID), 
+      // exact matches of regular expressions - only lose
+      if ((info.rank > m_pimpl->m_pcur->exactBound || (!clsid && info.rank == m_pimpl->m_pcur->exactBound)) 
+          && info.rank > m_pimpl->m_pcur->exactBoundRE)
+        return true;
     }
   }
   
+  top.search(praw);
+  if (!top.amount())
+    return false;
+  
+  top.get(0, clsid, info);
+  return true;
+}
+
+/// @brief search for k best matched classes
+// Postings are walked in order of phrase max rank, rest of posting is 
+// skipped as soon as it can't outrank the k-th class found.
+unsigned PhraseSearcher::searchTopK(const std::string &s, unsigned k, vector<cls_matched> &res, 
+                                    const QCClassMask *pmask /* = NULL */) const
+{
+  res.clear();
+  if (!m_pQCIndex || !k || !m_pimpl->resolveQuery(s))
+    return 0;
+  
+  m_pimpl->setClassMask(pmask);
+  PhraseTopCollector top(*this, k);
+  if (m_pimpl->searchExact())
+    top.addExact(m_pimpl->m_exactHits);
+  top.search(&s);
+  
+  res.resize(top.amount());
+  for (unsigned i = 0; i < res.size(); i++)
+    top.get(i, res[i].clsid, res[i].info);
+  
   return res.size();
 }
 
@@ -185,22 +1043,22 @@ void PhraseSearcher::getClasses(const vector<phrase_matched> &phrases,
   phraseByCls.clear();
   
   phrasecls_matched mi;
-  phrase_record *phrec;
-  phrase_classes_list *pclassList;
+  const phrase_record *phrec;
+  phrase_classes pclassList;
   
   for (vector<phrase_matched>::const_iterator it = phrases.begin();
        it != phrases.end();
        it++) 
   {
     phrec = m_pimpl->m_phrase_offsets[ it->phrase_id ];
-    pclassList = __phrase_header_jump_to_classes(phrec);
+    pclassList = __phrase_classes(m_pimpl->m_classLists, phrec);
     
     mi.phrase_id = it->phrase_id;
     mi.match_flags = it->match_flags;
     
-    for (unsigned i = 0; i < pclassList->n; i++) {
-      mi.baserank = pclassList->clse[i].phrase_rank;
-      phraseByCls.insert(pair<unsigned, phrasecls_matched>(pclassList->clse[i].clsid, mi));
+    for (unsigned i = 0; i < pclassList.n; i++) {
+      mi.baserank = pclassList.clse[i].phrase_rank;
+      phraseByCls.insert(pair<unsigned, phrasecls_matched>(pclassList.clse[i].clsid, mi));
     }
   }
 }
@@ -215,22 +1073,22 @@ void PhraseSearcher::getClasses(const vector<phrase_matched> &phrases,
   phraseByCls.clear();
   
   phrasecls_matched mi;
-  phrase_record *phrec;
-  phrase_classes_list *pclassList;
+  const phrase_record *phrec;
+  phrase_classes pclassList;
   
   for (vector<phrase_matched>::const_iterator it = phrases.begin();
        it != phrases.end();
        it++) 
   {
     phrec = m_pimpl->m_phrase_offsets[ it->phrase_id ];
-    pclassList = __phrase_header_jump_to_classes(phrec);
+    pclassList = __phrase_classes(m_pimpl->m_classLists, phrec);
     
     mi.phrase_id = it->phrase_id;
     mi.match_flags = it->match_flags;
     
-    for (unsigned i = 0; i < pclassList->n; i++) {
-      mi.baserank = pclassList->clse[i].phrase_rank;
-      phraseByCls.insert(pair<string, phrasecls_matched>(m_pQCIndex->getName(pclassList->clse[i].clsid), mi));
+    for (unsigned i = 0; i < pclassList.n; i++) {
+      mi.baserank = pclassList.clse[i].phrase_rank;
+      phraseByCls.insert(pair<string, phrasecls_matched>(m_pQCIndex->getName(pclassList.clse[i].clsid), mi));
     }
   }
 }
@@ -241,13 +1099,13 @@ void PhraseSearcher::getClasses(const vector<phrase_matched> &phrases,
 unsigned PhraseSearcher::searchPhrase(const std::string &s, res_num_t &res) const
 {
   res.clear();
-  if (searchPhrase(s, m_bufresult)) {
-    for (res_cls_num_t::iterator it = m_bufresult.begin(); it != m_bufresult.end(); it++) {
-      res.insert(pair<unsigned, unsigned>(it->first, it->second.rank));
-    }
-    return res.size();
+  
+  const QCResultArray &ra = *m_pbufresult;
+  for (unsigned i = searchPhrase(s, *m_pbufresult); i; i--) {
+    unsigned clsid = ra.clsid(i - 1);
+    res.insert(pair<unsigned, unsigned>(clsid, ra[clsid].rank));
   }
-  return 0;
+  return res.size();
 }
 
 /// @brief search for phrase and return map of class name to phrase rank
@@ -256,13 +1114,13 @@ unsigned PhraseSearcher::searchPhrase(const std::string &s, res_num_t &res) cons
 unsigned PhraseSearcher::searchPhrase(const std::string &s, res_t &res) const
 {
   res.clear();
-  if (searchPhrase(s, m_bufresult)) {
-    for (res_cls_num_t::iterator it = m_bufresult.begin(); it != m_bufresult.end(); it++) {
-      res.insert(pair<string, unsigned>(m_pQCIndex->getName(it->first), it->second.rank));
-    }
-    return res.size();
+  
+  const QCResultArray &ra = *m_pbufresult;
+  for (unsigned i = searchPhrase(s, *m_pbufresult); i; i--) {
+    unsigned clsid = ra.clsid(i - 1);
+    res.insert(pair<string, unsigned>(m_pQCIndex->getName(clsid), ra[clsid].rank));
   }
-  return 0;
+  return res.size();
 }
 
 
@@ -274,26 +1132,80 @@ unsigned PhraseSearcher::searchPhrase(const std::string &s, res_t &res) const
 // you can see format in phrase_indexer.cpp
 void PhraseSearcherImpl::load(MemReader &mrd) 
 {
+  uint32_t flags;
+  mrd >> flags;
+  m_bWide = (flags & INDEX_FL_WIDE) != 0;
+  m_phrase_offsets.setWide(m_bWide);
+  m_origPhrases.setWide(m_bWide);
+  m_udataReader.setWide(m_bWide);
+  
   m_w2id_index.load(mrd);
+  
+  uint32_t singles_sz;
+  mrd >> singles_sz;
+  m_singles = reinterpret_cast<const uint8_t *>(mrd.get());
+  mrd.advance(singles_sz);
+  
   m_words2phrases.load(mrd);
+  m_pairs2phrases.load(mrd);
   m_phrase_offsets.load(mrd);
   
   // remember phrase region base and skip it
-  uint32_t phrase_region_sz;
-  mrd >> phrase_region_sz;
+  uint64_t phrase_region_sz;
+  if (m_bWide) {
+    mrd >> phrase_region_sz;
+  }
+  else {
+    uint32_t sz;
+    mrd >> sz;
+    phrase_region_sz = sz;
+  }
   m_phrase_offsets.setBase(mrd.get());
   mrd.advance(phrase_region_sz);
+  
+  uint32_t lists_sz;
+  mrd >> lists_sz;
+  m_classLists = mrd.get();
+  mrd.advance(lists_sz);
+  
   m_regReader.load(mrd);
   m_origPhrases.load(mrd);
   m_udataReader.load(mrd);
+  
+  mrd >> m_nclasses;
+  m_clsMaxRank = reinterpret_cast<const uint8_t *>(mrd.get());
+  m_clsMaxRankRE = m_clsMaxRank + m_nclasses;
+  mrd.advance(m_nclasses * 2 * sizeof(uint8_t));
+  
+  uint32_t tblsize;
+  mrd >> tblsize;
+  m_exactTable = reinterpret_cast<const exact_entry *>(mrd.get());
+  m_exactMask = tblsize - 1;
+  mrd.advance(tblsize * sizeof(exact_entry));
+  
+  m_bForms = (flags & INDEX_FL_FORMS) != 0;
+  if (m_bForms)
+    m_forms.load(mrd);
+  m_splitter.setLazyLemma(m_bForms);
+  m_splitter.setLemmaBypass((flags >> INDEX_FL_BYPASS_SHIFT) & INDEX_FL_BYPASS_MASK);
+  
+  m_bTrie = (flags & INDEX_FL_TRIE) != 0;
+  if (m_bTrie) {
+    uint32_t lists_sz;
+    m_trie.load(mrd);
+    mrd >> lists_sz;
+    m_trieLists = reinterpret_cast<const uint32_t *>(mrd.get());
+    mrd.advance(lists_sz * sizeof(uint32_t));
+  }
 }
 
 
 /// @brief compare words with original phrase
-/// @arg[in] pwe - word_entry array pointer
+/// @arg[in] pwe - word_entry(_wide) array pointer
 /// @arg[in] n - number of words
 /// @return matching (penalty) flags or (-1) if not matched
-inline int PhraseSearcherImpl::matchWords(const qcls_impl::word_entry *pwe, unsigned n) const
+template<class Tword>
+inline int PhraseSearcherImpl::matchWords(const Tword *pwe, unsigned n) const
 {
   if (m_match.size() < n) {
     // no matching is possible, at least one word from indexed phrase absent in query
@@ -343,70 +1255,498 @@ inline int PhraseSearcherImpl::matchWords(const qcls_impl::word_entry *pwe, unsi
   return match_mask;
 }
 
+/// @brief matchWords() specialized by number of phrase words
+// the same semantics: every phrase word takes the first unused query word
+// with its ID; penalty flags are accumulated without branches
+template<unsigned N, class Tword>
+inline int PhraseSearcherImpl::matchWordsN(const Tword *pwe) const
+{
+  unsigned nq = m_qid.size();
+  if (nq < N)
+    return (-1);
+  
+  int match_mask = (int)(nq != N) * PhraseSearcher::MATCH_FL_PARTIAL;
+  unsigned i, j, prev_pos = 0, wmask_used = 0x0;
+  
+  for (i = 0; i < N; i++) 
+  {
+    j = findWord(pwe[i].id, wmask_used);
+    if (j == nq)
+      return (-1); // query doesn't contain this word
+    
+    const word_entry_wide &we = m_match[j];
+    match_mask |= (int)(i && prev_pos + 1 != j) * PhraseSearcher::MATCH_FL_REORDERED;
+    match_mask |= (int)(we.form != pwe[i].form) * PhraseSearcher::MATCH_FL_DIFF_FORM;
+    match_mask |= (int)(we.upcased != pwe[i].upcased) * PhraseSearcher::MATCH_FL_DIFF_CAPS;
+    
+    wmask_used |= (1 << j);
+    prev_pos = j;
+  }
+  
+  return match_mask;
+}
+
+/// @brief match query with phrase record words
+template<class Tword>
+inline int PhraseSearcherImpl::matchRecord(const phrase_record *phrec) const
+{
+  const Tword *pwe = __phrase_words<Tword>(phrec);
+  switch (phrec->n) {
+    case 1:  return matchWordsN<1>(pwe);
+    case 2:  return matchWordsN<2>(pwe);
+    case 3:  return matchWordsN<3>(pwe);
+    default: return matchWords(pwe, phrec->n);
+  }
+}
+
+/// @brief match query with single-word phrases of query word
+/// @arg[in] psingles - [uint32_t N][single_phrase_t<Tword> x N] region
+/// @arg[out] phrases - matched phrases
+template<class Tword, class Tsink>
+inline void PhraseSearcherImpl::matchSingles(const uint8_t *psingles, const uint16_t *pallowed, Tsink &sink) const
+{
+  phrase_candidate match_res;
+  uint32_t n;
+  memcpy(&n, psingles, sizeof(n)); // region isn't aligned
+  const single_phrase_t<Tword> *sp = reinterpret_cast<const single_phrase_t<Tword> *>(psingles + sizeof(uint32_t));
+  bool bPartial = (m_qid.size() != 1);
+  
+  match_res.pendingRE = false;
+  m_stat.nvisited += n;
+  for (; n; n--, sp++) 
+  {
+    if (!isWanted(sp->clsmask))
+      continue;
+    
+    if (!isAllowed(pallowed, sp->phrase_id, bPartial))
+      continue;
+    
+    if (!outranks(sp->phrase_id, bPartial, sink.minRank()))
+      continue;
+    
+    match_res.phrase_id   = sp->phrase_id;
+    match_res.match_flags = matchWordsN<1>(&sp->word);
+    match_res.classes     = __phrase_classes(m_classLists, sp);
+    if (isRanked(pallowed, match_res.phrase_id, match_res.match_flags))
+      sink.add(match_res);
+  }
+}
+
+/// @brief match query with phrase candidates
+/// @arg[in] pe, n - posting range (ordered by phrase length)
+/// @arg[in] maxwords - candidates with more words can't be matched
+/// @arg[in] pallowed - allowed flags by phrase ID (NULL - no pruning)
+/// @arg[out] sink - receiver of matched phrases
+template<typename Tkey, class Tsink>
+inline void PhraseSearcherImpl::matchPhrases(const string *ps, const posting_entry<Tkey> *pe, unsigned n, unsigned maxwords, 
+                                             const uint16_t *pallowed, Tsink &sink) const
+{
+  phrase_candidate match_res;
+  unsigned nq = m_qid.size();
+  
+  for (unsigned j = 0; j < n && pe[j].nwords <= maxwords; j++) 
+  {
+    m_stat.nvisited++;
+    if (!isWanted(pe[j].clsmask))
+      continue;
+    
+    if (!isAllowed(pallowed, pe[j].value, pe[j].nwords != nq))
+      continue;
+    
+    // phrases of the same length are ordered by max rank: skip the rest of them
+    unsigned minrank = sink.minRank();
+    if (minrank && m_pcur->rankBound[pe[j].nwords != nq][pe[j].maxrank] < minrank) {
+      for (; j + 1 < n && pe[j + 1].nwords == pe[j].nwords; j++)
+        m_stat.nbounded++;
+      m_stat.nbounded++;
+      continue;
+    }
+    if (!outranks(pe[j].value, pe[j].nwords != nq, minrank))
+      continue;
+    
+    match_res.phrase_id   = pe[j].value;
+    const phrase_record *phrec  = m_phrase_offsets[match_res.phrase_id];
+    match_res.match_flags = (m_bWide) ? matchRecord<word_entry_wide>(phrec) : matchRecord<word_entry>(phrec);
+    
+    DBG( printf("+match with phrase: %d; flags=%02X\n", match_res.phrase_id, match_res.match_flags));
+    // ckeck regular expression matching if phrase is RE
+    if (match_res.match_flags == -1 || !isRanked(pallowed, match_res.phrase_id, match_res.match_flags))
+      continue;
+    
+    match_res.pendingRE = phrec->is_regexp && sink.deferRegexp();
+    if (!phrec->is_regexp || match_res.pendingRE || (ps && m_regReader.match(match_res.phrase_id, *ps) > 0)) {
+      match_res.classes = __phrase_classes(m_classLists, phrec);
+      sink.add(match_res);
+    }
+  }
+}
+
 /// @brief process with phrase matching:
-/// @arg[out] phrases - phraseID:flags pair
-inline void PhraseSearcherImpl::processMatchingWithIDs(const string &s, vector<PhraseSearcher::phrase_matched> &phrases) const
+/// @arg[out] sink - receiver of matched phrases
+template<class Tsink>
+inline void PhraseSearcherImpl::processMatchingWithIDs(const string *ps, bool bPrune, Tsink &sink) const
 {
-  vector<uint32_t> vPhraseIds;
-  unsigned i, j, n;
-  PhraseSearcher::phrase_matched match_res;
+  unsigned i, j, n, nfound = 0;
+  const vector<uint16_t> &vallowed = m_pcur->allowedFlags;
+  const uint16_t *pallowed = (bPrune && !vallowed.empty()) ? &vallowed[0] : NULL;
+  
+  DBG( printf("+processMatchingWithIDs: %s\n", ps ? ps->c_str() : "(tokens)"));
   
-  DBG( printf("+processMatchingWithIDs: %s\n", s.c_str()));
+  // every word of phrase should be found in query
+  for (i = 0; i < m_match.size(); i++) {
+    if (m_match[i].found)
+      nfound++;
+  }
   
   for(i = 0; i < m_match.size(); i++) 
   {
-    qcls_impl::word_entry &w = m_match[i];
+    qcls_impl::word_entry_wide &w = m_match[i];
     if (!w.found)
       continue;
     
+    // single-word phrases are kept in dictionary
+    if (m_qsingles[i]) {
+      if (m_bWide)
+        matchSingles<word_entry_wide>(m_qsingles[i], pallowed, sink);
+      else
+        matchSingles<word_entry>(m_qsingles[i], pallowed, sink);
+    }
+    
     // match with every phrase containing this word
-    n = m_words2phrases.search(w.id, vPhraseIds);
+    const posting_entry<uint32_t> *pe;
+    n = m_words2phrases.searchRange(w.id, pe);
     DBG( printf("+m_words2phrases.search(%u)=%u\n", w.id, n));
-    for (j = 0; j < n; j++) 
+    if (n)
+      matchPhrases(ps, pe, n, nfound, pallowed, sink);
+  }
+  
+  // phrases of hot keywords are addressed by pair {keyword, partner}:
+  // probe every distinct pair of query words (once)
+  if (nfound < 2 || !m_pairs2phrases.amount())
+    return;
+  
+  for (i = 0; i < m_match.size(); i++) 
+  {
+    if (!m_match[i].found || isRepeatedWord(i))
+      continue;
+    
+    for (j = i + 1; j < m_match.size(); j++) 
     {
-      match_res.phrase_id   = vPhraseIds[j];
-      const phrase_record *phrec  = m_phrase_offsets[match_res.phrase_id];
-      match_res.match_flags = matchWords(phrec->words, phrec->n);
+      if (!m_match[j].found || isRepeatedWord(j))
+        continue;
       
-      DBG( printf("+match with phrase: %d; flags=%02X\n", match_res.phrase_id, match_res.match_flags));
-      // ckeck regular expression matching if phrase is RE
-      if (match_res.match_flags != -1 && (!phrec->is_regexp || 
-          m_regReader.match(match_res.phrase_id, s) > 0)) 
-      {
-        phrases.push_back(match_res);
-      }
+      const posting_entry<uint64_t> *pe;
+      n = m_pairs2phrases.searchRange(__word_pair_key(m_match[i].id, m_match[j].id), pe);
+      DBG( printf("+m_pairs2phrases.search(%u, %u)=%u\n", m_match[i].id, m_match[j].id, n));
+      if (n)
+        matchPhrases(ps, pe, n, nfound, pallowed, sink);
     }
   }
 }
 
-void PhraseSearcherImpl::searchPhrase(const string &s, vector<PhraseSearcher::phrase_matched> &phrases) const
-{ 
-  phrases.clear();
-  unsigned nwords = m_splitter.split(s);
-  DBG( printf("+NWORDS: %d\n", nwords));
-  if (!nwords)
-    return;
+/// @brief find dictionary entry of query word @arg i
+// With forms table the query is split without lemmatizer: form of table is resolved
+// to it's lemma, form of dictionary is lemma itself, and the rest of words are 
+// lemmatized (unless strict mode is set).
+inline bool PhraseSearcherImpl::lookupWord(unsigned i, const dict_entry *&pde) const
+{
+  PhraseSplitterPlain::word_info &wi = m_splitter.vWords[i];
+  
+  if (m_bForms) {
+    word_hash_t lemma;
+    if (m_forms.search(wi.form, lemma))
+      wi.hash = lemma;
+    else if (m_w2id_index.searchRange(wi.form, pde))
+      return true;
+    else if (m_bStrictForms || !m_splitter.hasLemmatizer())
+      return false;
+    else
+      m_splitter.lemmatize(i);
+  }
+  return m_w2id_index.searchRange(wi.hash, pde) != 0;
+}
+
+/// @brief take ranking data of the whole search and size query buffers
+void PhraseSearcherImpl::startQuery(unsigned nwords) const
+{
+  takeState();
   
   m_match.resize(nwords);
+  m_qid.resize(nwords);
+  m_qsingles.resize(nwords);
+}
+
+/// @brief set query word @arg i
+/// @arg[in] found - word is indexed (id, singles are set)
+void PhraseSearcherImpl::setWord(unsigned i, bool found, uint32_t id, uint32_t singles, 
+                                 uint32_t form, bool upcase) const
+{
+  word_entry_wide &ma = m_match[i];
+  
+  if (found) {
+    ma.id = id;
+    ma.found = 1;
+    ma.upcased = upcase & 0x1;
+    ma.form = form;
+    m_qid[i] = id;
+    m_qsingles[i] = (singles != ~0U) ? m_singles + singles : NULL;
+  }
+  else {
+    ma.found = 0;
+    m_qid[i] = ~0U; // no word has such ID
+    m_qsingles[i] = NULL;
+  }
+  
+  DBG( printf("+WORD: [%d]; id=%d; upcased=%d\n", ma.found ? 1 : 0, (int)ma.id, ma.upcased ? 1 : 0) );
+}
+
+unsigned PhraseSearcherImpl::resolveQuery(const char *s, size_t len, codepage_t cp) const
+{
+  unsigned nwords = m_splitter.split(s, len, cp);
+  DBG( printf("+NWORDS: %d\n", nwords));
+  
+  startQuery(nwords);
   for(unsigned i = 0; i < nwords; i++) {
-    uint32_t id;
+    const dict_entry *pde;
     PhraseSplitterPlain::word_info &wi = m_splitter.vWords[i];
-    word_entry &ma = m_match[i];
     
-    if (m_w2id_index.search(wi.hash, id)) {
-      ma.id = id;
-      ma.found = 1;
-      ma.upcased = wi.upcase & 0x1;
-      ma.form = wi.form;
+    if (lookupWord(i, pde))
+      setWord(i, true, pde->value, pde->singles, wi.form, wi.upcase);
+    else
+      setWord(i, false, ~0U, ~0U, wi.form, wi.upcase);
+  }
+  
+  return nwords;
+}
+
+void PhraseSearcherImpl::resolveToken(PhraseSearcher::query_token &t) const
+{
+  const dict_entry *pde;
+  
+  if (m_w2id_index.searchRange(t.hash, pde)) {
+    t.id = pde->value;
+    t.singles = pde->singles;
+  }
+  else {
+    t.id = t.singles = ~0U;
+  }
+  t.resolved = true;
+}
+
+unsigned PhraseSearcherImpl::resolveTokens(const PhraseSearcher::query_token *pt, unsigned n) const
+{
+  n = min(n, (unsigned)MAX_WORDS_SPLIT); // as splitter does
+  startQuery(n);
+  
+  for (unsigned i = 0; i < n; i++) {
+    PhraseSearcher::query_token t = pt[i];
+    if (!t.resolved)
+      resolveToken(t);
+    setWord(i, t.id != ~0U, t.id, t.singles, t.form, t.upcase);
+  }
+  
+  return n;
+}
+
+unsigned PhraseSearcherImpl::searchExact() const
+{
+  m_exactHits.clear();
+  if (!m_exactTable)
+    return 0;
+  
+  unsigned i, n = m_match.size();
+  for (i = 0; i < n; i++) {
+    if (!m_match[i].found)
+      return 0;
+  }
+  
+  uint32_t fp = __word_sequence_hash(&m_match[0], n);
+  for (i = fp & m_exactMask; m_exactTable[i].phrase_id != ~0U; i = (i + 1) & m_exactMask) 
+  {
+    if (m_exactTable[i].fp != fp)
+      continue;
+    
+    // verify candidate: hash collisions are possible
+    const phrase_record *phrec = m_phrase_offsets[ m_exactTable[i].phrase_id ];
+    if (phrec->n != n)
+      continue;
+    
+    if (m_bWide ? sameWords<word_entry_wide>(phrec) : sameWords<word_entry>(phrec))
+      m_exactHits.push_back(m_exactTable[i].phrase_id);
+  }
+  
+  return m_exactHits.size();
+}
+
+/// @brief get next word of scanned text (@arg ulen - it's length in UTF-8)
+inline bool PhraseSearcherImpl::nextScanWord(codepage_t cp, Utf8Tokenizer::word &w, size_t &ulen) const
+{
+  if (cp == CODEPAGE_UTF8) {
+    if (!m_scanTokenizer.next(w, m_scanWord))
+      return false;
+    ulen = w.len;
+  }
+  else {
+    if (!m_scanSbTokenizer.next(w, m_scanWord))
+      return false;
+    ulen = m_scanSbTokenizer.utf8Length(w);
+  }
+  return true;
+}
+
+/// @brief split text (words of caller) to normalized tokens (m_scanTokens)
+// Tokens are taken as plain splitter takes them: long words are skipped.
+void PhraseSearcherImpl::splitScan(const string &text, const vector< pair<unsigned, unsigned> > *pwords, 
+                                   codepage_t cp) const
+{
+  unsigned k, nwords = (pwords) ? pwords->size() : 1;
+  Utf8Tokenizer::word w;
+  size_t ulen;
+  
+  if (cp != CODEPAGE_UTF8 && m_scanSbTokenizer.codepage() != cp)
+    m_scanSbTokenizer = SingleByteTokenizer(cp);
+  
+  m_scanNorms.clear();
+  m_scanTokens.clear();
+  for (k = 0; k < nwords; k++) 
+  {
+    size_t ntokens = m_scanTokens.size();
+    const char *s = text.data();
+    size_t len = text.length();
+    if (pwords) {
+      s += (*pwords)[k].first;
+      len = (*pwords)[k].second;
+    }
+    if (cp == CODEPAGE_UTF8)
+      m_scanTokenizer.reset(s, len);
+    else
+      m_scanSbTokenizer.reset(s, len);
+    
+    while (nextScanWord(cp, w, ulen)) {
+      if (ulen > MAX_WORD_LENGTH)
+        continue;
+      
+      scan_token t;
+      t.norm = m_scanNorms.size();
+      t.len = m_scanWord.size();
+      t.word = (pwords) ? k : m_scanTokens.size();
+      t.upcase = w.upcase;
+      t.first = !pwords || m_scanTokens.size() == ntokens;
+      t.last = !pwords;
+      m_scanNorms += m_scanWord;
+      m_scanTokens.push_back(t);
+    }
+    if (pwords && m_scanTokens.size() > ntokens)
+      m_scanTokens.back().last = true;
+  }
+}
+
+/// @brief rank phrases of trie list matched by tokens [first, end) and add them to @arg res
+// phrase is ranked by the best of wanted classes (ties - the lower class ID)
+void PhraseSearcherImpl::addOccurrences(unsigned first, unsigned end, const uint32_t *plist, 
+                                        vector<PhraseSearcher::exact_occurrence> &res) const
+{
+  PhraseSearcher::exact_occurrence oc;
+  unsigned i, j;
+  
+  for (i = 1; i <= plist[0]; i++) 
+  {
+    const phrase_record *phrec = m_phrase_offsets[ plist[i] ];
+    if (phrec->n != end - first)
+      continue; // broken index
+    
+    int flags = 0;
+    for (j = 0; j < phrec->n; j++) {
+      bool upcased = m_bWide ? (__phrase_words<word_entry_wide>(phrec)[j].upcased != 0) : 
+                               (__phrase_words<word_entry>(phrec)[j].upcased != 0);
+      if (upcased != m_scanTokens[first + j].upcase)
+        flags = PhraseSearcher::MATCH_FL_DIFF_CAPS;
     }
-    else {
-      ma.found = 0;
+    
+    phrase_classes pcl = __phrase_classes(m_classLists, phrec);
+    oc.rank = 0;
+    oc.clsid = ~0U;
+    for (j = 0; j < pcl.n; j++) {
+      unsigned clsid = pcl.clse[j].clsid;
+      if (!isWantedClass(clsid))
+        continue;
+      
+      unsigned rank = QCIndexReader::applyRank(m_pcur->tables[clsid], pcl.clse[j].phrase_rank, flags);
+      if (rank > oc.rank || (rank && rank == oc.rank && clsid < oc.clsid)) {
+        oc.rank = rank;
+        oc.clsid = clsid;
+      }
     }
+    if (!oc.rank)
+      continue;
+    
+    oc.first = m_scanTokens[first].word;
+    oc.nwords = m_scanTokens[end - 1].word - oc.first + 1;
+    oc.phrase_id = plist[i];
+    oc.match_flags = flags;
+    res.push_back(oc);
+  }
+}
+
+// Trie is walked from every token by it's normalized bytes and space between
+// words, walk stops once there is no transition; so every token is visited
+// no more than by MAX_WORDS_SPLIT walks (the longest phrase key).
+unsigned PhraseSearcherImpl::scanExact(const string &text, const vector< pair<unsigned, unsigned> > *pwords, 
+                                       unsigned maxwords, codepage_t cp, 
+                                       vector<PhraseSearcher::exact_occurrence> &res) const
+{
+  if (!m_bTrie || m_trie.empty())
+    return 0;
+  
+  takeState();
+  if (!m_pcur->tables)
+    return 0;
+  
+  splitScan(text, pwords, cp);
+  
+  const char *norms = m_scanNorms.data();
+  unsigned i, j, n = m_scanTokens.size();
+  
+  for (i = 0; i < n; i++) 
+  {
+    const scan_token &ti = m_scanTokens[i];
+    if (!ti.first)
+      continue;
     
-    DBG( printf("+WORD: [%d]; id=%d; upcased=%d\n", ma.found ? 1 : 0, (int)ma.id, ma.upcased ? 1 : 0) );
+    uint32_t node = DATrieReader::ROOT, off;
+    for (j = i; j < n && j - i < MAX_WORDS_SPLIT; j++) 
+    {
+      const scan_token &tj = m_scanTokens[j];
+      if (maxwords && tj.word - ti.word >= maxwords)
+        break;
+      if (j > i && !m_trie.walk(node, (unsigned char)' '))
+        break;
+      if (!m_trie.walk(node, norms + tj.norm, tj.len))
+        break;
+      
+      if (tj.last && m_trie.value(node, off))
+        addOccurrences(i, j + 1, m_trieLists + off, res);
+    }
+  }
+  
+  return res.size();
+}
+
+unsigned PhraseSearcherImpl::searchPhrase(const string &s, bool bPrune) const
+{ 
+  resolveQuery(s);
+  return searchResolved(&s, bPrune);
+}
+
+unsigned PhraseSearcherImpl::searchResolved(const string *ps, bool bPrune) const
+{ 
+  m_candidates.clear();
+  if (!m_match.empty()) {
+    CandidateList sink(m_candidates);
+    processMatchingWithIDs(ps, bPrune, sink);
   }
   
-  processMatchingWithIDs(s, phrases);
+  return m_candidates.size();
 }
 
 } // namespace gogo
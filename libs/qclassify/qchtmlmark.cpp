@@ -7,17 +7,21 @@
 
 #include <string>
 #include <vector>
-#include <deque>
 #include <map>
-#include <set>
 #include <algorithm>
 #include <iostream>
 
+#include <string.h>
 #include <strings.h>
 #include <stdio.h>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "config/config.hpp"
 #include "utils/stringutils.hpp"
+#include "utils/utf8_tokenizer.hpp"
 #include "qclassify.hpp"
 #include "qclassify_impl.hpp"
 #include "htmlmark.hpp"
@@ -27,7 +31,7 @@ using namespace std;
 
 namespace gogo {
   
-typedef enum {TAG_UNKNOWN = -1, TAG_HTML, TAG_BODY, TAG_A} html_tag_t;
+typedef enum {TAG_UNKNOWN = -1, TAG_HTML, TAG_BODY, TAG_A, TAG_SCRIPT, TAG_STYLE, TAG_TEXTAREA} html_tag_t;
 
 /// @name implementation of Query-Classify HTML-marker
 class QCHtmlMarkerImpl 
@@ -40,6 +44,7 @@ class QCHtmlMarkerImpl
       unsigned marked:1;
       unsigned grasp_left:4;
       unsigned grasp_right:4;
+      unsigned decoded:1; // text of word with decoded entities is in decodedWords of context
     } wordentry_t;
     
     typedef struct match_info {
@@ -56,8 +61,6 @@ class QCHtmlMarkerImpl
       unsigned len;
     } match_info_t;
     
-  private:
-    
     typedef enum {WTYPE_TEXT, WTYPE_TAG} wtype_t;
   
     struct we_draft {
@@ -65,10 +68,22 @@ class QCHtmlMarkerImpl
       int      len;
       unsigned grasp_left:4;
       unsigned grasp_right:4;
+      unsigned decoded:1;
       wtype_t  wt;
     };
     
+    // text of word with decoded character references
+    struct decoded_word {
+      unsigned offset;      // of word in text
+      unsigned text_offset; // of text in wordText of context
+      unsigned text_len;
+      
+      bool operator<(const decoded_word &dw) const { return offset < dw.offset; }
+    };
     
+    typedef QCHtmlMarker::MarkupContext::Buffers buffers_t;
+    
+  private:
     bool m_bDebug;
     const PhraseSearcher *m_psrch;
     
@@ -85,37 +100,90 @@ class QCHtmlMarkerImpl
     };
     
     map<unsigned, ClsMarkupConfig> m_classConfigs;
+    QCHtmlMarker::MarkupContext m_ctx; // buffers of markup without context of caller
+    
+    // class markers (by class ID) and userdata (by phrase ID) transcoded to code page
+    codepage_t m_cacheCp;
+    map<unsigned, string> m_markerCp, m_udataCp;
     
   public:
     QCHtmlMarkerImpl();
-    unsigned markup(const string &text, string &os, const QCHtmlMarker::MarkupSettings &st);
+    unsigned markup(const string &text, string &os, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx);
     void loadSettings(const XmlConfig *pcfg);
     QCHtmlMarker::MarkupSettings m_cfgSettings;
     
     static inline QCHtmlMarker::sort_order_t parseOrder(const char *order);
     
   private:
-    inline html_tag_t html_tag_to_id(const char *tag);
+    inline html_tag_t html_tag_to_id(const char *name, size_t len);
     html_tag_t extract_tag(const char *p, unsigned n, bool &closer);
-    void html_getwords(const string &text, const QCHtmlMarker::MarkupSettings &st, vector<wordentry_t> *words);
+    void html_getwords(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx);
+    static inline const char *word_text(const buffers_t &ctx, const char *html, const wordentry_t &we, size_t &len);
+    void match_trie(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx);
+    void match_tokens(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx);
+    
+    const char *transcoded(map<unsigned, string> &cache, unsigned id, const char *s, codepage_t cp);
+    void clearTranscoded(codepage_t cp);
     
-    inline void SpecEncodeString(const char *orig_phrase, std::string &out);
+    static inline void SpecEncodeString(const char *orig_phrase, vector<u_char> &b64_buf, std::string &out);
     bool BuildPhraseURL(const struct match_info &pmi, 
                         const char *html, 
+                        codepage_t cp, 
+                        buffers_t &ctx,
                         string &buf);
     
-    void select_phrases(const vector<match_info_t> *vmatched, 
-                        vector<match_info_t> *vselected, 
-                        const QCHtmlMarker::MarkupSettings &st);
+    void select_phrases(buffers_t &ctx, const QCHtmlMarker::MarkupSettings &st);
     
     void apply_grasps(vector<match_info_t> *vm);
     void matches_reorder_byrank(vector<match_info_t> &vm, bool ascend);
-    void matches_reorder_byfreq(vector<match_info_t> &vm, bool ascend);
+    void matches_reorder_byfreq(vector<match_info_t> &vm, vector<unsigned> &freqs, bool ascend);
     
     friend class QCHtmlMarker;
 };
 
-QCHtmlMarkerImpl::QCHtmlMarkerImpl() : m_bDebug(false) {}
+//---------------------------------------------------------------------------------
+/// @brief buffers of markup, they are cleared by every markup (capacity is kept)
+struct QCHtmlMarker::MarkupContext::Buffers {
+  typedef QCHtmlMarkerImpl impl;
+  
+  vector<impl::wordentry_t>  words;
+  vector<impl::we_draft>     weds;
+  vector<impl::match_info_t> vmatched, vselected;
+  
+  // text of words with decoded character references (see wordentry_t::decoded)
+  vector<impl::decoded_word> decodedWords; // ordered by offset
+  string wordText, scanText;
+  
+  // window of words searched as query (UTF-8 text)
+  string window;
+  
+  // tokens of words for single-byte text: word i has [wordTokens[i], wordTokens[i + 1])
+  vector<PhraseSearcher::query_token> tokens, wtokens;
+  vector<unsigned> wordTokens;
+  string raw;
+  
+  // trie engine: words (offset, length) to scan, occurrences and the best one 
+  // of every word window by ((nwords - 1) * number of words + first word)
+  vector< pair<unsigned, unsigned> > spans;
+  vector<PhraseSearcher::exact_occurrence> occurrences;
+  vector<const PhraseSearcher::exact_occurrence *> best;
+  
+  // by phrase ID: number of matches (frequency order), phrase is marked (bUniq);
+  // they are zeroed back by IDs of matches
+  vector<unsigned> freqs;
+  vector<unsigned char> uniq;
+  
+  // markup of selected phrases one after another (end of every one, npos - not built)
+  string urls;
+  vector<size_t> urlEnds;
+  string escaped, utf8;
+  vector<u_char> b64;
+};
+
+QCHtmlMarker::MarkupContext::MarkupContext() : m_pbuf(new Buffers()) {}
+QCHtmlMarker::MarkupContext::~MarkupContext() { delete m_pbuf; }
+
+QCHtmlMarkerImpl::QCHtmlMarkerImpl() : m_bDebug(false), m_cacheCp(CODEPAGE_UTF8) {}
 
 inline QCHtmlMarker::sort_order_t QCHtmlMarkerImpl::parseOrder(const char *order)
 {
@@ -149,88 +217,159 @@ void QCHtmlMarkerImpl::loadSettings(const XmlConfig *pcfg)
   m_cfgSettings.gap   = (unsigned)pcfg->GetInt(sec, "Gap", def.gap);
   m_cfgSettings.nmax  = (unsigned)pcfg->GetInt(sec, "Limit", def.nmax);
   m_cfgSettings.bSkipFirstWord = pcfg->GetBool(sec, "SkipFirstWord", def.bSkipFirstWord);
+  m_cfgSettings.bSkipRawText   = pcfg->GetBool(sec, "SkipRawText", def.bSkipRawText);
   m_cfgSettings.bUniq          = pcfg->GetBool(sec, "Uniq", def.bUniq);
   m_cfgSettings.bUseUdataAsFormat = pcfg->GetBool(sec, "UseUdataAsFormat", def.bUseUdataAsFormat);
   
   const char *order = pcfg->GetStr(sec, "SortOrder");
   m_cfgSettings.order = (order) ? parseOrder(order): def.order;
+  
+  const char *cp = pcfg->GetStr(sec, "Codepage");
+  m_cfgSettings.codepage = def.codepage;
+  if (cp && !parse_codepage(cp, m_cfgSettings.codepage))
+    throw std::runtime_error("Unknown code page value");
+  
+  // markers are transcoded once for code page of config
+  clearTranscoded(m_cfgSettings.codepage);
+  map<unsigned, ClsMarkupConfig>::const_iterator it;
+  for (it = m_classConfigs.begin(); it != m_classConfigs.end(); it++) {
+    if (!it->second.marker.empty())
+      transcoded(m_markerCp, it->first, it->second.marker.c_str(), m_cfgSettings.codepage);
+  }
+}
+
+//---------------------------------------------------------------------------------
+/// @brief drop transcoded strings, next ones are of code page @arg cp
+void QCHtmlMarkerImpl::clearTranscoded(codepage_t cp)
+{
+  m_markerCp.clear();
+  m_udataCp.clear();
+  m_cacheCp = cp;
+}
+
+//---------------------------------------------------------------------------------
+/// @brief get UTF-8 string @arg s transcoded to code page @arg cp
+/// @param cache transcoded strings by @arg id (string is transcoded once)
+/// @return @arg s for UTF-8
+const char *QCHtmlMarkerImpl::transcoded(map<unsigned, string> &cache, unsigned id, 
+                                         const char *s, codepage_t cp)
+{
+  if (!s || cp == CODEPAGE_UTF8)
+    return s;
+  if (cp != m_cacheCp)
+    clearTranscoded(cp);
+  
+  map<unsigned, string>::iterator it = cache.find(id);
+  if (it == cache.end()) {
+    it = cache.insert(make_pair(id, string())).first;
+    utf8_to_codepage(cp, s, strlen(s), it->second);
+  }
+  return it->second.c_str();
 }
 
 
 /// @brief aux comparators
+/// @brief ties are ordered as matches are found (bigger windows first, then from left
+/// @brief to right), so sort keeps order of stable_sort without it's buffer
 typedef QCHtmlMarkerImpl::match_info_t mi_t;
 
-static bool compar_matches_offset(mi_t inf1, mi_t inf2)    { return (inf1.offset < inf2.offset); }
-static bool compar_matches_rank_asc(mi_t inf1, mi_t inf2)  { return (inf1.rank < inf2.rank); }
-static bool compar_matches_rank_desc(mi_t inf1, mi_t inf2) { return (inf1.rank > inf2.rank); }
-static bool compar_matches_freq_asc(mi_t inf1, mi_t inf2)  { return (inf1.freq < inf2.freq); }
-static bool compar_matches_freq_desc(mi_t inf1, mi_t inf2) { return (inf1.freq > inf2.freq); }
+static inline bool compar_matches_window(const mi_t &inf1, const mi_t &inf2) { 
+  return (inf1.nwords > inf2.nwords || (inf1.nwords == inf2.nwords && inf1.first_id < inf2.first_id)); 
+}
+
+static bool compar_matches_offset(const mi_t &inf1, const mi_t &inf2)    { return (inf1.offset < inf2.offset); }
+static bool compar_matches_rank_asc(const mi_t &inf1, const mi_t &inf2)  { 
+  return (inf1.rank < inf2.rank || (inf1.rank == inf2.rank && compar_matches_window(inf1, inf2))); 
+}
+static bool compar_matches_rank_desc(const mi_t &inf1, const mi_t &inf2) { 
+  return (inf1.rank > inf2.rank || (inf1.rank == inf2.rank && compar_matches_window(inf1, inf2))); 
+}
+static bool compar_matches_freq_asc(const mi_t &inf1, const mi_t &inf2)  { 
+  return (inf1.freq < inf2.freq || (inf1.freq == inf2.freq && compar_matches_window(inf1, inf2))); 
+}
+static bool compar_matches_freq_desc(const mi_t &inf1, const mi_t &inf2) { 
+  return (inf1.freq > inf2.freq || (inf1.freq == inf2.freq && compar_matches_window(inf1, inf2))); 
+}
 
 
 //-----------------------------------------------------------------------------------
 /// @brief Main function - markup text
+/// @param ctx - buffers of markup
 /// @return amount of marked blocks
 //-----------------------------------------------------------------------------------
-unsigned QCHtmlMarkerImpl::markup(const string &text, string &os, const QCHtmlMarker::MarkupSettings &st)
+unsigned QCHtmlMarkerImpl::markup(const string &text, string &os, const QCHtmlMarker::MarkupSettings &st, 
+                                  buffers_t &ctx)
 {
   if (!m_psrch) {
     os = text;
     return 0;
   }
     
-  PhraseSearcher::res_cls_num_t cres;
-  vector<wordentry_t>  words;
-  vector<match_info_t> vmatched, vselected;
+  PhraseSearcher::phrase_info pinfo;
+  unsigned clsid;
+  vector<wordentry_t>  &words = ctx.words;
+  vector<match_info_t> &vmatched = ctx.vmatched, &vselected = ctx.vselected;
   
   const char *html = const_cast<const char *>(text.data()); 
   size_t size = text.size();  
 
-  html_getwords(text, st, &words);
+  words.clear();
+  vmatched.clear();
+  vselected.clear();
+  html_getwords(text, st, ctx);
 
   // lookup matched phrases
   int i, n = words.size(), range, maxi;
   match_info_t mi;
   wordentry_t *curw, *endw, *pw;
 
-  for (range = st.range; range > 0; range--)
-    for (i=0, maxi = n - range; i <= maxi; i++) 
-    {
-      curw = &words[i];
+  if (m_psrch->getExactEngine() == PhraseSearcher::EXACT_ENGINE_TRIE)
+    match_trie(text, st, ctx);
+  else if (st.codepage != CODEPAGE_UTF8)
+    match_tokens(text, st, ctx);
+  else {
+    string &s = ctx.window;
+    
+    for (range = st.range; range > 0; range--)
+      for (i=0, maxi = n - range; i <= maxi; i++) 
+      {
+        curw = &words[i];
   
-      if ((int)curw->tag_dist < range) 
-        continue;
+        if ((int)curw->tag_dist < range) 
+          continue;
   
-      endw = curw + range - 1;
-      // construct string from words
-      /// TODO: replace by ...
-      string s;
-      for (pw = curw; pw <= endw; pw++) {
-        s.append(html + pw->offset, pw->len);
-        if (pw != endw)
-          s += " ";
-      }
+        endw = curw + range - 1;
+        // construct string from words
+        s.clear();
+        for (pw = curw; pw <= endw; pw++) {
+          size_t wlen;
+          const char *ws = word_text(ctx, html, *pw, wlen);
+          s.append(ws, wlen);
+          if (pw != endw)
+            s += " ";
+        }
       
-      unsigned n = m_psrch->searchPhrase(s, cres);
-      if (m_bDebug)
-        printf("=== CLS: \"%s\": %u\n", s.c_str(), n);
+        bool found = m_psrch->searchBest(s, clsid, pinfo);
+        if (m_bDebug)
+          printf("=== CLS: \"%s\": %u\n", s.c_str(), found ? 1 : 0);
       
-      if (n)  {
-        // remember best of matched
-        PhraseSearcher::res_cls_num_t::iterator cit = PhraseSearcher::selectBest(cres);
-        mi.rank = cit->second.rank;
-        mi.phrase_id = cit->second.phrase_id;
-        mi.clsid     = cit->first;
+        if (found)  {
+          // remember best of matched
+          mi.rank = pinfo.rank;
+          mi.phrase_id = pinfo.phrase_id;
+          mi.clsid     = clsid;
         
-        mi.offset   = curw->offset;
-        mi.len      = endw->offset + endw->len - curw->offset;
-        mi.first_id = i;
-        mi.nwords = range;
-        mi.first  = curw;
-        mi.last   = endw;
+          mi.offset   = curw->offset;
+          mi.len      = endw->offset + endw->len - curw->offset;
+          mi.first_id = i;
+          mi.nwords = range;
+          mi.first  = curw;
+          mi.last   = endw;
   
-        vmatched.push_back(mi);
+          vmatched.push_back(mi);
+        }
       }
-    }
+  }
    
     // Preorder matched phrases if need
     // (default is no ordering - i.e. bigger phrases from left to right)
@@ -245,14 +384,14 @@ unsigned QCHtmlMarkerImpl::markup(const string &text, string &os, const QCHtmlMa
       
       case QCHtmlMarker::MARKUP_ORDER_FREQ_ASC:
       case QCHtmlMarker::MARKUP_ORDER_FREQ_DESC:
-        matches_reorder_byfreq(vmatched, st.order == QCHtmlMarker::MARKUP_ORDER_FREQ_ASC);
+        matches_reorder_byfreq(vmatched, ctx.freqs, st.order == QCHtmlMarker::MARKUP_ORDER_FREQ_ASC);
         break;  
     }
     
     // now we have ALL phrases in vmatched. Theese phrases are self-ordered
     // by phrase lenght from beggining of text to it's end. So, now we should
     // select only non-overlapped phrases with some restrictions from <args>.
-    select_phrases(&vmatched, &vselected, st);
+    select_phrases(ctx, st);
     apply_grasps(&vselected);
     
     sort(vselected.begin(), vselected.end(), compar_matches_offset);
@@ -264,14 +403,31 @@ unsigned QCHtmlMarkerImpl::markup(const string &text, string &os, const QCHtmlMa
     {
       unsigned bc = 0;
       vector<match_info_t>::const_iterator it;
-      string url;
+      size_t osize = size, beg = 0, end;
+      
+      // build markup of matched phrases first to know size of output
+      ctx.urls.clear();
+      ctx.urlEnds.clear();
+      for (it = vselected.begin(); it != vselected.end(); it++) {
+        if (BuildPhraseURL(*it, html, st.codepage, ctx, ctx.urls)) {
+          osize += ctx.urls.size() - beg - it->len;
+          beg = ctx.urls.size();
+          ctx.urlEnds.push_back(beg);
+        } else {
+          ctx.urls.resize(beg);
+          ctx.urlEnds.push_back(string::npos);
+        }
+      }
+      os.reserve(os.size() + osize);
 
       // add matched phrases with formatted markup
-      for (it = vselected.begin(); it != vselected.end(); it++) {
+      for (it = vselected.begin(), beg = 0; it != vselected.end(); it++) {
         os.append(html + bc, it->offset - bc);
 
-        if (BuildPhraseURL(*it, html, url)) {
-          os.append(url);
+        end = ctx.urlEnds[it - vselected.begin()];
+        if (end != string::npos) {
+          os.append(ctx.urls, beg, end - beg);
+          beg = end;
           nMarked++;
         } else {
           // put text unchanged
@@ -292,6 +448,163 @@ struct StrCasecomp {
   bool operator() (const char *s1, const char *s2) const { return (strcasecmp(s1, s2) < 0); }
 };
 
+//-----------------------------------------------------------------------------------
+/// @brief lookup phrases by exact trie of searcher: all exact occurrences are found
+/// @brief in one pass, the best one of every word window is taken as searchBest does,
+/// @brief windows are ordered as by searching (bigger first, then from left to right)
+/// @param ctx - [in] words of text, [out] matched phrases
+//-----------------------------------------------------------------------------------
+void QCHtmlMarkerImpl::match_trie(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx)
+{
+  vector<wordentry_t> &words = ctx.words;
+  vector< pair<unsigned, unsigned> > &spans = ctx.spans;
+  const string *pscan = &text;
+  unsigned i, n = words.size(), range;
+  
+  // words with decoded entities are scanned from their text after the document
+  if (!ctx.wordText.empty()) {
+    ctx.scanText = text;
+    ctx.scanText += ctx.wordText;
+    pscan = &ctx.scanText;
+  }
+  
+  spans.resize(n);
+  for (i = 0; i < n; i++) {
+    size_t len;
+    const char *ws = word_text(ctx, text.data(), words[i], len);
+    
+    if (words[i].decoded)
+      spans[i] = make_pair((unsigned)(text.size() + (ws - ctx.wordText.data())), (unsigned)len);
+    else
+      spans[i] = make_pair(words[i].offset, (unsigned)len);
+  }
+  
+  ctx.occurrences.clear();
+  m_psrch->scanExact(*pscan, spans, st.range, ctx.occurrences, NULL, st.codepage);
+  
+  vector<PhraseSearcher::exact_occurrence>::const_iterator it;
+  unsigned maxwords = 0;
+  
+  for (it = ctx.occurrences.begin(); it != ctx.occurrences.end(); it++) 
+    maxwords = std::max(maxwords, it->nwords);
+  
+  ctx.best.assign(maxwords * n, NULL);
+  for (it = ctx.occurrences.begin(); it != ctx.occurrences.end(); it++) 
+  {
+    if (words[it->first].tag_dist < it->nwords)
+      continue;
+    
+    const PhraseSearcher::exact_occurrence *&pbest = ctx.best[(it->nwords - 1) * n + it->first];
+    if (!pbest || it->rank > pbest->rank || 
+        (it->rank == pbest->rank && it->clsid < pbest->clsid) ||
+        (it->rank == pbest->rank && it->clsid == pbest->clsid && !it->match_flags && pbest->match_flags))
+      pbest = &(*it);
+  }
+  
+  // bigger windows first, then from left to right
+  for (range = maxwords; range > 0; range--)
+    for (i = 0; i < n; i++) 
+    {
+      const PhraseSearcher::exact_occurrence *poc = ctx.best[(range - 1) * n + i];
+      if (!poc)
+        continue;
+      
+      wordentry_t *curw = &words[i], *endw = curw + range - 1;
+      match_info_t mi;
+      
+      if (m_bDebug)
+        printf("=== TRIE: \"%.*s\": %u\n", (int)(endw->offset + endw->len - curw->offset), 
+               text.data() + curw->offset, poc->phrase_id);
+      
+      mi.rank      = poc->rank;
+      mi.phrase_id = poc->phrase_id;
+      mi.clsid     = poc->clsid;
+      
+      mi.offset   = curw->offset;
+      mi.len      = endw->offset + endw->len - curw->offset;
+      mi.first_id = i;
+      mi.nwords = range;
+      mi.first  = curw;
+      mi.last   = endw;
+      
+      ctx.vmatched.push_back(mi);
+    }
+}
+
+//-----------------------------------------------------------------------------------
+/// @brief lookup phrases of single-byte text: every word is tokenized once (to hashes
+/// @brief of UTF-8 words), word windows are searched by their tokens as searchBest does
+/// @param ctx - [in] words of text, [out] matched phrases
+//-----------------------------------------------------------------------------------
+void QCHtmlMarkerImpl::match_tokens(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx)
+{
+  vector<wordentry_t> &words = ctx.words;
+  const char *html = text.data();
+  int i, n = words.size(), range;
+  bool bRegExps = m_psrch->hasRegExps();
+  PhraseSearcher::phrase_info pinfo;
+  unsigned clsid;
+  match_info_t mi;
+  
+  ctx.tokens.clear();
+  ctx.wordTokens.resize(n + 1);
+  for (i = 0; i < n; i++) {
+    size_t wlen;
+    const char *ws = word_text(ctx, html, words[i], wlen);
+    
+    ctx.wordTokens[i] = ctx.tokens.size();
+    m_psrch->tokenize(ws, wlen, st.codepage, ctx.wtokens);
+    ctx.tokens.insert(ctx.tokens.end(), ctx.wtokens.begin(), ctx.wtokens.end());
+  }
+  ctx.wordTokens[n] = ctx.tokens.size();
+  
+  for (range = st.range; range > 0; range--)
+    for (i = 0; i + range <= n; i++) 
+    {
+      wordentry_t *curw = &words[i], *endw = curw + range - 1, *pw;
+      
+      if ((int)curw->tag_dist < range) 
+        continue;
+      
+      unsigned first = ctx.wordTokens[i], ntokens = ctx.wordTokens[i + range] - first;
+      if (!ntokens)
+        continue;
+      
+      // regular expressions are matched by window text in UTF-8
+      if (bRegExps) {
+        ctx.raw.clear();
+        for (pw = curw; pw <= endw; pw++) {
+          size_t wlen;
+          const char *ws = word_text(ctx, html, *pw, wlen);
+          codepage_to_utf8(st.codepage, ws, wlen, ctx.raw);
+          if (pw != endw)
+            ctx.raw += " ";
+        }
+      }
+      
+      bool found = m_psrch->searchBest(&ctx.tokens[first], ntokens, clsid, pinfo, NULL, 
+                                       bRegExps ? &ctx.raw : NULL);
+      if (m_bDebug)
+        printf("=== CLS: \"%.*s\": %u\n", (int)(endw->offset + endw->len - curw->offset), 
+               html + curw->offset, found ? 1 : 0);
+      
+      if (found)  {
+        mi.rank = pinfo.rank;
+        mi.phrase_id = pinfo.phrase_id;
+        mi.clsid     = clsid;
+        
+        mi.offset   = curw->offset;
+        mi.len      = endw->offset + endw->len - curw->offset;
+        mi.first_id = i;
+        mi.nwords = range;
+        mi.first  = curw;
+        mi.last   = endw;
+        
+        ctx.vmatched.push_back(mi);
+      }
+    }
+}
+
 //-----------------------------------------------------------------------------------
 /// @brief Apply left and right grasp if phrase fully matched.
 /// @brief It's usually used in quotation marks, for example:
@@ -317,35 +630,34 @@ void QCHtmlMarkerImpl::apply_grasps(vector<match_info_t> *vm)
 
 //-----------------------------------------------------------------------------------
 /// @brief select limited amount of matched phrases from all
-/// @param vmatched  - all matched phrases
-/// @param vselected - [out] selected phrases
+/// @brief selected phrases don't overlap, so phrase is in gap of selected one
+/// @brief if some word of it's gap is marked
+/// @param ctx - [in] words of text and all matched phrases, [out] selected phrases
 //-----------------------------------------------------------------------------------
-void QCHtmlMarkerImpl::select_phrases(const vector<match_info_t> *vmatched, 
-                   vector<match_info_t> *vselected, 
-                   const QCHtmlMarker::MarkupSettings &st)
+void QCHtmlMarkerImpl::select_phrases(buffers_t &ctx, const QCHtmlMarker::MarkupSettings &st)
 {   
+  const vector<match_info_t> *vmatched = &ctx.vmatched;
+  vector<match_info_t> *vselected = &ctx.vselected;
   vector<match_info_t>::const_iterator it;
-  set<int> begs, ends;
-  int l, r, first_id, last_id;
-  set<int>::const_iterator its;
+  int n = ctx.words.size(), l, r;
   wordentry_t *wef, *wel;
   bool already_marked;
-  set<unsigned> phrases_tomark;
+  vector<unsigned char> &phrases_tomark = ctx.uniq; // by phrase ID
 
   for (it = vmatched->begin(); 
        it != vmatched->end() && (!st.nmax || vselected->size() < st.nmax); 
        it++) 
   {
-    if (st.bUniq && phrases_tomark.count(it->phrase_id) != 0)
+    if (st.bUniq && it->phrase_id < phrases_tomark.size() && phrases_tomark[it->phrase_id])
       continue;
 
-    first_id = (*it).first_id;
-    last_id = first_id + (*it).nwords - 1;
-    wel = (*it).last;
-       
-    // verify that phrases doesn't overlapped
+    // verify that phrases doesn't overlapped (and isn't in gap of selected ones)
+    l = std::max(it->first_id - (int)st.gap, 0);
+    r = std::min(it->first_id + it->nwords - 1 + (int)st.gap, n - 1);
+    wel = &ctx.words[r];
+    
     already_marked = false;
-    for (wef = (*it).first; wef <= wel; wef++) {
+    for (wef = &ctx.words[l]; wef <= wel; wef++) {
       if (wef->marked) {
         already_marked = true;
         break;
@@ -354,78 +666,47 @@ void QCHtmlMarkerImpl::select_phrases(const vector<match_info_t> *vmatched,
     if (already_marked)
       continue;
 
-    // now look for nearest phrase end (l) and nearest
-    // phrase beginning (r); this only make sense for non-zero gap.
-    l = r = -1;
-    if (st.gap) {
-      its = ends.lower_bound(first_id);
-      if (its == ends.end()) {
-        // no elements >= first_id, so get biggest value
-        if (!ends.empty())
-          l = (*ends.rbegin()); 
-      } else {
-        for(;;) {
-          if ((*its) <= first_id) {
-            l = (*its);
-            break;
-          }
-          if (its == ends.begin())
-            break;
-          its--;
-        }
-      }
+    // phrase satisfy conditions, so insert.
+    for (wef = (*it).first, wel = (*it).last; wef <= wel; wef++) 
+      wef->marked = 1;
 
-      its = begs.upper_bound(last_id);
-      if (its != begs.end()) 
-        r = *its;
-    }
-
-    if ((l == -1 || first_id - l > (int)st.gap) && 
-         (r == -1 || r - last_id  > (int)st.gap))
-    {
-      // phrase satisfy conditions, so insert.
-      for (wef = (*it).first; wef <= wel; wef++) 
-        wef->marked = 1;
-            
-      if (st.gap) {
-        ends.insert(last_id);
-        begs.insert(first_id);
-      }
-
-      if (st.bUniq)
-        phrases_tomark.insert(it->phrase_id);
-            
-      vselected->push_back(*it);
+    if (st.bUniq) {
+      if (it->phrase_id >= phrases_tomark.size())
+        phrases_tomark.resize(it->phrase_id + 1, 0);
+      phrases_tomark[it->phrase_id] = 1;
     }
+          
+    vselected->push_back(*it);
+  }
+  
+  if (st.bUniq) {
+    for (it = vselected->begin(); it != vselected->end(); it++)
+      phrases_tomark[it->phrase_id] = 0;
   }
 }
 
 //-----------------------------------------------------------------------------------
 /// @brief reorder matches by frequency
 /// @param vm - [in] match vector
+/// @param freqs - [in] zeroed counters by phrase ID (they are zeroed back)
 /// @param ascend - [in] order by ascendancy
 //-----------------------------------------------------------------------------------
-void QCHtmlMarkerImpl::matches_reorder_byfreq(vector<match_info_t> &vm, bool ascend)
+void QCHtmlMarkerImpl::matches_reorder_byfreq(vector<match_info_t> &vm, vector<unsigned> &freqs, bool ascend)
 {
-  map<int, int> phrases_freq; /* phrase ID => ntimes */
-  map<int, int>::iterator mit;
   vector<match_info_t>::iterator it;
     
   for (it = vm.begin(); it != vm.end(); it++) {
-    mit = phrases_freq.find((*it).phrase_id);
-    if (mit == phrases_freq.end())
-      phrases_freq.insert( pair<int, int>((*it).phrase_id, 1) );
-    else
-      mit->second++;
+    if ((*it).phrase_id >= freqs.size())
+      freqs.resize((*it).phrase_id + 1, 0);
+    freqs[(*it).phrase_id]++;
   }
     
-  for (it = vm.begin(); it != vm.end(); it++) {
-    mit = phrases_freq.find((*it).phrase_id);
-    assert(mit != phrases_freq.end());
-    (*it).freq = mit->second;
-  }
+  for (it = vm.begin(); it != vm.end(); it++)
+    (*it).freq = freqs[(*it).phrase_id];
+  for (it = vm.begin(); it != vm.end(); it++)
+    freqs[(*it).phrase_id] = 0;
 
-  stable_sort(vm.begin(), vm.end(), ascend ? compar_matches_freq_asc : compar_matches_freq_desc);
+  sort(vm.begin(), vm.end(), ascend ? compar_matches_freq_asc : compar_matches_freq_desc);
 }
 
 //-----------------------------------------------------------------------------------
@@ -435,35 +716,39 @@ void QCHtmlMarkerImpl::matches_reorder_byfreq(vector<match_info_t> &vm, bool asc
 //-----------------------------------------------------------------------------------
 void QCHtmlMarkerImpl::matches_reorder_byrank(vector<match_info_t> &vm, bool ascend)
 {
-  stable_sort(vm.begin(), vm.end(), ascend ? compar_matches_rank_asc : compar_matches_rank_desc);
+  sort(vm.begin(), vm.end(), ascend ? compar_matches_rank_asc : compar_matches_rank_desc);
 }
 
 //-----------------------------------------------------------------------------------
 /// @brief special encoding of string ( base64(s) ) where `s' in UTF-8
 //-----------------------------------------------------------------------------------
-inline void QCHtmlMarkerImpl::SpecEncodeString(const char *orig_phrase, std::string &out)
+inline void QCHtmlMarkerImpl::SpecEncodeString(const char *orig_phrase, vector<u_char> &b64_buf, std::string &out)
 {
   size_t ilen = strlen(orig_phrase);
-  std::vector<char> b64_buf(ilen * 2);
+  if (b64_buf.size() < (ilen + 2) / 3 * 4 + 1)
+    b64_buf.resize((ilen + 2) / 3 * 4 + 1);
 
-  size_t n = base64_encode((u_char *)orig_phrase, ilen, (u_char *)&b64_buf[0]);
-  gogo::str_escape(&b64_buf[0], out, n);
+  size_t n = base64_encode((const u_char *)orig_phrase, ilen, &b64_buf[0]);
+  gogo::str_escape((const char *)&b64_buf[0], out, n);
 }
 
 //-----------------------------------------------------------------------------------
 /// @brief build URL base on fomrmat provided in config file
+/// @brief output is in code page of text (URL parameters are escaped UTF-8 anyway)
 /// @param pmi - [in] matching info
-/// @param buf - [out] resulting buffer
+/// @param cp  - [in] code page of text
+/// @param ctx - [in] buffers of markup
+/// @param buf - [out] URL is appended to buffer (partially if it isn't built)
 //-----------------------------------------------------------------------------------
 bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi, 
                     const char *html, 
+                    codepage_t cp, 
+                    buffers_t &ctx,
                     string &buf) 
 {
-  buf.clear();
-  
   static const char *markup_fmt_default = (const char *)"<a class=\"gomail_search\" target=\"_blank\" href=\"http://go.mail.ru/search?q=%O\">%P</a>&nbsp;<img src=\"http://img.mail.ru/r/search_icon.gif\" width=\"13\" height=\"13\" alt=\"\" />";
   
-  const char *udata = m_psrch->getUserData(pmi.phrase_id);
+  const char *udata = transcoded(m_udataCp, pmi.phrase_id, m_psrch->getUserData(pmi.phrase_id), cp);
   const char *orig_phrase = m_psrch->getOriginPhrase(pmi.phrase_id);
 
   map<unsigned, ClsMarkupConfig>::const_iterator it = m_classConfigs.find(pmi.clsid);
@@ -473,9 +758,10 @@ bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi,
   
   if (useUdataAsFormat && udata) 
     markup_fmt = udata;
-  else {
-    markup_fmt = (pccfg && !pccfg->marker.empty()) ? pccfg->marker.c_str() : markup_fmt_default;
-  }
+  else if (pccfg && !pccfg->marker.empty())
+    markup_fmt = transcoded(m_markerCp, pmi.clsid, pccfg->marker.c_str(), cp);
+  else
+    markup_fmt = markup_fmt_default;
   
   for (const char *pfmt = markup_fmt; *pfmt != 0; pfmt++) 
   {
@@ -486,16 +772,15 @@ bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi,
       {
         case 'O':
           if (!orig_phrase) return false;
-          buf += orig_phrase;
+          utf8_to_codepage(cp, orig_phrase, strlen(orig_phrase), buf);
           break;
           
         case 'S':
         {
           if (!orig_phrase) return false;
           
-          std::string escaped_orig;
-          gogo::str_escape( orig_phrase, escaped_orig );
-          buf.append( escaped_orig );
+          gogo::str_escape( orig_phrase, ctx.escaped );
+          buf.append( ctx.escaped );
           break;
         }
           
@@ -507,9 +792,8 @@ bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi,
         case 'M': {
           if (!orig_phrase) return false;
           
-          string e;
-          SpecEncodeString(orig_phrase, e);
-          buf += e;
+          SpecEncodeString(orig_phrase, ctx.b64, ctx.escaped);
+          buf += ctx.escaped;
           }
           break;
           
@@ -519,10 +803,10 @@ bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi,
           
         case 'Q':
         {
-          std::string escaped_match;
-          
-          gogo::str_escape( html + pmi.offset, escaped_match, pmi.len );
-          buf.append( escaped_match );
+          ctx.utf8.clear();
+          codepage_to_utf8(cp, html + pmi.offset, pmi.len, ctx.utf8);
+          gogo::str_escape( ctx.utf8.data(), ctx.escaped, ctx.utf8.length() );
+          buf.append( ctx.escaped );
           break;
         }
         
@@ -541,32 +825,191 @@ bool QCHtmlMarkerImpl::BuildPhraseURL(const struct match_info &pmi,
   return true;
 }
 
+namespace {
+  // classes of bytes of text (out of tags)
+  enum {
+    HCH_WORD = 0,
+    HCH_SPACER,   // ' ', '\t', '\r', '\n'
+    HCH_SPLITTER, // ",.;:!?()\"[]/\\{}" and '\0'
+    HCH_AMP,      // escape or word byte
+    HCH_LT        // tag opening
+  };
+  
+  struct html_chars {
+    unsigned char cls[256];
+    
+    html_chars() {
+      memset(cls, HCH_WORD, sizeof(cls));
+      for (const char *s = ",.;:!?()\"[]/\\{}"; *s; s++) // +«»
+        cls[(unsigned char)*s] = HCH_SPLITTER;
+      cls[0] = HCH_SPLITTER;
+      cls[(unsigned char)' '] = cls[(unsigned char)'\t'] = HCH_SPACER;
+      cls[(unsigned char)'\r'] = cls[(unsigned char)'\n'] = HCH_SPACER;
+      cls[(unsigned char)'&'] = HCH_AMP;
+      cls[(unsigned char)'<'] = HCH_LT;
+    }
+  };
+  const html_chars s_htmlChars;
+  
+#ifdef __SSE2__
+  /// @return bitmask of bytes of @arg v which are in range [@arg lo, @arg lo + @arg n)
+  inline __m128i in_range(__m128i v, char lo, char n) {
+    __m128i t = _mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - lo)));
+    return _mm_cmplt_epi8(t, _mm_set1_epi8((char)(0x80 + n)));
+  }
+  
+  inline __m128i is_char(__m128i v, char c) { 
+    return _mm_cmpeq_epi8(v, _mm_set1_epi8(c)); 
+  }
+#endif
+  
+  /// @brief bytes ending run of word bytes in text
+  struct text_stop {
+    static bool is(char c) { return s_htmlChars.cls[(unsigned char)c] != HCH_WORD; }
+#ifdef __SSE2__
+    static unsigned mask(const char *p) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      // \0 \t \n \r ' ' ! " & ( ) , . / : ; < ? [ \ ] { }
+      __m128i m = _mm_or_si128(is_char(v, '\0'), in_range(v, '\t', 2));
+      m = _mm_or_si128(m, _mm_or_si128(is_char(v, '\r'), in_range(v, ' ', 3)));
+      m = _mm_or_si128(m, _mm_or_si128(is_char(v, '&'), in_range(v, '(', 2)));
+      m = _mm_or_si128(m, _mm_or_si128(is_char(v, ','), in_range(v, '.', 2)));
+      m = _mm_or_si128(m, _mm_or_si128(in_range(v, ':', 3), is_char(v, '?')));
+      m = _mm_or_si128(m, _mm_or_si128(in_range(v, '[', 3), is_char(v, '{')));
+      m = _mm_or_si128(m, is_char(v, '}'));
+      return _mm_movemask_epi8(m);
+    }
+#endif
+  };
+  
+  /// @brief bytes of tag brackets
+  struct tag_stop {
+    static bool is(char c) { return c == '<' || c == '>'; }
+#ifdef __SSE2__
+    static unsigned mask(const char *p) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+      return _mm_movemask_epi8(_mm_or_si128(is_char(v, '<'), is_char(v, '>')));
+    }
+#endif
+  };
+  
+  /// @brief search of stop bytes: 16 bytes are classified at once, 
+  /// bitmask of the last block serves next searches within it
+  template<class Tstop>
+  class stop_finder {
+    const char *m_blk;
+    unsigned m_bits;
+    
+  public:
+    stop_finder() : m_blk(NULL), m_bits(0) {}
+    
+    /// @return first stop byte of [@arg p, @arg end) or @arg end
+    const char *find(const char *p, const char *end) {
+#ifdef __SSE2__
+      for (;;) {
+        if (m_blk == NULL || p < m_blk || p >= m_blk + 16) {
+          if (end - p < 16)
+            break;
+          m_blk = p;
+          m_bits = Tstop::mask(p);
+        }
+        
+        unsigned bits = m_bits >> (p - m_blk);
+        if (bits)
+          return p + __builtin_ctz(bits);
+        p = m_blk + 16;
+      }
+#endif
+      while (p < end && !Tstop::is(*p))
+        p++;
+      return p;
+    }
+  };
+  
+  typedef enum {
+    ESC_WORD,        // character of word
+    ESC_CHAR,        // spacer or splitter of ASCII, it's taken as it is in text
+    ESC_SPACER, 
+    ESC_SPLITTER, 
+    ESC_QUOTE_OPEN, 
+    ESC_QUOTE_CLOSE
+  } esc_type_t;
+  
+  /// @return meaning of character reference (escape) to code points @arg ch in text
+  inline esc_type_t escape_type(const uint32_t ch[2])
+  {
+    if (ch[1])
+      return ESC_WORD;
+    
+    switch(ch[0]) {
+      case '<': case '>': case '"': case 0x2014: // mdash
+        return ESC_SPLITTER;
+      case 0xAB: // laquo
+        return ESC_QUOTE_OPEN;
+      case 0xBB: // raquo
+        return ESC_QUOTE_CLOSE;
+      case 0xA0: case '&': case '\'': // nbsp
+        return ESC_SPACER;
+    }
+    return (ch[0] < 0x80 && s_htmlChars.cls[ch[0]] != HCH_WORD) ? ESC_CHAR : ESC_WORD;
+  }
+  
+  const char *s_tagNames[] = {"html", "body", "a", "script", "style", "textarea"};
+  
+  // tags by perfect hash of lowercase name (name[0] + name[len - 1]) % 8
+  const html_tag_t s_tagSlots[8] = {
+    TAG_STYLE, TAG_UNKNOWN, TAG_A, TAG_BODY, TAG_HTML, TAG_TEXTAREA, TAG_UNKNOWN, TAG_SCRIPT
+  };
+  
+  inline bool is_tag_letter(char c) { return (unsigned)((c | 0x20) - 'a') < 26; }
+  
+  /// @return position of closing tag @arg name in [@arg p, @arg end) or @arg end
+  const char *find_closing_tag(const char *p, const char *end, const char *name)
+  {
+    size_t len = strlen(name);
+    
+    while ((p = (const char *)memchr(p, '<', end - p)) != NULL) {
+      size_t rest = end - p;
+      if (rest >= len + 2 && p[1] == '/' && !strncasecmp(p + 2, name, len) && 
+          (rest == len + 2 || !is_tag_letter(p[len + 2])))
+        return p;
+      p++;
+    }
+    return end;
+  }
+}
+
 //-----------------------------------------------------------------------------------
-/// @brief recognize HTML tag (convert to quite limited set of tags)
+/// @brief text of word @arg we to search for: word of @arg html or its text with decoded
+/// @brief character references
 //-----------------------------------------------------------------------------------
-inline html_tag_t QCHtmlMarkerImpl::html_tag_to_id(const char *tag)
+inline const char *QCHtmlMarkerImpl::word_text(const buffers_t &ctx, const char *html, const wordentry_t &we, size_t &len)
 {
-  static map< const char *, html_tag_t, StrCasecomp > html_tags;
-  map< const char *, html_tag_t >::const_iterator it;
-
-  if (!html_tags.size()) {
-    struct tag_match {
-      char *tag;
-      html_tag_t id;
-    } matches[] = { 
-      {(char*)"html", TAG_HTML}, 
-      {(char*)"body", TAG_BODY}, 
-      {(char*)"a",    TAG_A   }, 
-    };
-
-    for (unsigned i = 0; i < sizeof(matches) / sizeof(matches[0]); i++)
-    {
-      html_tags.insert( pair<const char *, html_tag_t>(matches[i].tag, (matches[i].id)) );
-    }
+  if (we.decoded) {
+    decoded_word key = {we.offset, 0, 0};
+    const decoded_word &dw = *lower_bound(ctx.decodedWords.begin(), ctx.decodedWords.end(), key);
+    len = dw.text_len;
+    return ctx.wordText.data() + dw.text_offset;
   }
+  
+  len = we.len;
+  return html + we.offset;
+}
 
-  it = html_tags.find(tag);
-  return (it == html_tags.end()) ? TAG_UNKNOWN : it->second;
+//-----------------------------------------------------------------------------------
+/// @brief recognize HTML tag (convert to quite limited set of tags)
+/// @param name - tag name (letters)
+/// @param len  - name length
+//-----------------------------------------------------------------------------------
+inline html_tag_t QCHtmlMarkerImpl::html_tag_to_id(const char *name, size_t len)
+{
+  if (!len)
+    return TAG_UNKNOWN;
+  
+  html_tag_t id = s_tagSlots[((name[0] | 0x20) + (name[len - 1] | 0x20)) & 7];
+  if (id == TAG_UNKNOWN || strlen(s_tagNames[id]) != len || strncasecmp(name, s_tagNames[id], len))
+    return TAG_UNKNOWN;
+  return id;
 }
 
 //-----------------------------------------------------------------------------------
@@ -578,9 +1021,6 @@ inline html_tag_t QCHtmlMarkerImpl::html_tag_to_id(const char *tag)
 //-----------------------------------------------------------------------------------
 html_tag_t QCHtmlMarkerImpl::extract_tag(const char *p, unsigned n, bool &closer)
 {
-  static char *tag_symbols = (char *)"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
-  char tag[8];
-    
   if (*p != '<')
     return TAG_UNKNOWN;
   p++; n--;
@@ -591,16 +1031,11 @@ html_tag_t QCHtmlMarkerImpl::extract_tag(const char *p, unsigned n, bool &closer
   } else
     closer = false;
 
-    if (n < 1)
-      return TAG_UNKNOWN;
-
-    if (n >= sizeof(tag))
-      n = sizeof(tag) - 1;
-
-    strncpy(tag, p, n); tag[n] = '\0';
-    tag[ strspn(tag, tag_symbols) ] = '\0';
-    
-    return html_tag_to_id(tag);
+  unsigned len = 0;
+  while (len < n && is_tag_letter(p[len]))
+    len++;
+  
+  return html_tag_to_id(p, len);
 }
 
 
@@ -608,48 +1043,34 @@ html_tag_t QCHtmlMarkerImpl::extract_tag(const char *p, unsigned n, bool &closer
 /// @brief Extract words from HTML document
 /// @param text  - [in] source HTML text
 /// @param st    - [in] markup settings
-/// @param words - [out] words selected vector
+/// @param ctx   - [out] words selected vector (appended) and their decoded text
 //-----------------------------------------------------------------------------------
-void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::MarkupSettings &st, vector<wordentry_t> *words)
+void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::MarkupSettings &st, buffers_t &ctx)
 {
   typedef enum {STATE_INTEXT, STATE_INTAG} STATES;
   const char *html = const_cast<const char *>(text.data()); 
   size_t size = text.size();
+  const char *end = html + size;
 
   STATES state = STATE_INTEXT;
   const char *p, *lastopen = NULL;
-  int    wlen = 0, step = 1;
-  vector<struct we_draft> weds;
+  int    wlen = 0;
+  size_t step = 1;
+  vector<struct we_draft> &weds = ctx.weds;
+  vector<wordentry_t> *words = &ctx.words;
   bool   within_a = false; /* we should ignore content within <a> tag */
   bool   within_body = false; /* collect words only within body */
   bool   within_html = false;
   bool   skip_word = st.bSkipFirstWord; // skip first word at document
   bool   mem_text, spacer, splitter;
-  static char *wsplit_symbols = (char *)",.;:!?()\"[]/\\{}"; // +«»
   size_t offset;
   int    quote_open_beg = -1, quote_close_end = -1;
-
-#define ESC_TYPE_SPACER      's'
-#define ESC_TYPE_SPLITTER    'S'
-#define ESC_TYPE_QUOTE_OPEN  'q'
-#define ESC_TYPE_QUOTE_CLOSE 'Q'
-
-#define ESC_SPACER(s)      {(char *)s, sizeof(s)-1, ESC_TYPE_SPACER}
-#define ESC_SPLITTER(s)    {(char *)s, sizeof(s)-1, ESC_TYPE_SPLITTER}
-#define ESC_QUOTE_OPEN(s)  {(char *)s, sizeof(s)-1, ESC_TYPE_QUOTE_OPEN}
-#define ESC_QUOTE_CLOSE(s) {(char *)s, sizeof(s)-1, ESC_TYPE_QUOTE_CLOSE}
-
-  struct escape {
-    char *esc;
-    int  len;
-    char type;
-  } escapes[] = {
-    ESC_SPLITTER("&lt;"),    ESC_SPLITTER("&gt;"),
-    ESC_QUOTE_OPEN("&laquo;"),  ESC_QUOTE_CLOSE("&raquo;"),
-    ESC_SPLITTER("&mdash;"), ESC_SPLITTER("&quot;"),
-    ESC_SPACER("&nbsp;"),    ESC_SPACER("&amp;"), ESC_SPACER("&#039;"),
-    {NULL, 0, 0}
-  };
+  int    text_beg = -1; // text of word with decoded entities starts at ctx.wordText
+  size_t synced = 0;    // text of word is in ctx.wordText before this offset
+  
+  // runs of word bytes and tag contents are passed by blocks
+  stop_finder<text_stop> text_stops;
+  stop_finder<tag_stop>  tag_stops;
 
 #define UPDATE_MEM_TEXT do { \
   mem_text = !within_a && (!within_html || within_body); \
@@ -661,6 +1082,7 @@ void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::Mar
   wed.offset = offset - wlen;      \
   wed.len = wlen;                  \
   wed.wt = WTYPE_TEXT;             \
+  wed.decoded = 0;                 \
   \
   if (quote_open_beg != -1) {      \
   wed.grasp_left = wed.offset - quote_open_beg;      \
@@ -677,107 +1099,166 @@ void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::Mar
   if (skip_word) {                   \
     skip_word = false;               \
   } else {                           \
+    if (text_beg != -1) {            \
+      decoded_word dw = {(unsigned)wed.offset, (unsigned)text_beg, 0}; \
+      ctx.wordText.append(html + synced, offset - synced); \
+      dw.text_len = ctx.wordText.size() - text_beg;        \
+      ctx.decodedWords.push_back(dw);  \
+      wed.decoded = 1;               \
+      text_beg = -1;                 \
+    }                                \
     weds.push_back(wed);             \
   }                                  \
 }
 
   UPDATE_MEM_TEXT;
+  weds.clear();
+  ctx.wordText.clear();
+  ctx.decodedWords.clear();
 
   for (offset=0, p = html; offset < size; p+=step, offset+=step)
   {
-    char c = *p;
     step = 1;
-            
-    if (c == '<')
-      lastopen = p;
-
-    switch(state) {
-      case STATE_INTEXT:
-        splitter = (strchr(wsplit_symbols, c) != NULL || c == '\0');
-        spacer   = (c == ' ' || c == '\t' || c == '\r' || c == '\n'); // TODO: utf8_isspace
+    
+    if (state == STATE_INTAG) {
+      p = tag_stops.find(p, end);
+      offset = p - html;
+      if (p == end)
+        break;
+      
+      if (*p == '<') {
+        lastopen = p;
+        continue;
+      }
+      
+      bool closer;
+      html_tag_t tag;
+                    
+      tag = extract_tag(lastopen, p - lastopen, closer);
+      switch(tag) {
+        case TAG_HTML:
+          within_html = !closer;
+          UPDATE_MEM_TEXT;
+          break;
+        case TAG_BODY:
+          within_body = !closer;
+          UPDATE_MEM_TEXT;
+          break;
+        case TAG_A:
+          within_a = !closer;
+          UPDATE_MEM_TEXT;
+          break;
+        case TAG_SCRIPT:
+        case TAG_STYLE:
+        case TAG_TEXTAREA:
+          // contents up to closing tag is not a text
+          if (st.bSkipRawText && !closer)
+            step = find_closing_tag(p + 1, end, s_tagNames[tag]) - p;
+          break;
+        default:
+          ;
+      }
+                    
+      state = STATE_INTEXT;
+      skip_word = st.bSkipFirstWord;
+      quote_open_beg = quote_close_end = -1;
+      continue;
+    }
+    
+    // word bytes just extend the word
+    const char *stop = text_stops.find(p, end);
+    wlen += stop - p;
+    p = stop;
+    offset = p - html;
+    if (p == end)
+      break;
+    
+    char c = *p;
+    unsigned cls = s_htmlChars.cls[(unsigned char)c];
+    
+    splitter = (cls == HCH_SPLITTER);
+    spacer   = (cls == HCH_SPACER); // TODO: utf8_isspace
                        
-        if (c == '&') {
-          /* check for special HTML sequences (escapes) */
-          int rest = size - offset;
-          struct escape *pe;
-
-          for (pe = &escapes[0]; pe->esc; pe++) 
-            if (rest >= pe->len && !strncmp(p, pe->esc, pe->len)) {
-            switch(pe->type) {
-              case ESC_TYPE_SPACER:
-                spacer = true;
-                break;
-              case ESC_TYPE_SPLITTER:
-                splitter = true;
-                skip_word = st.bSkipFirstWord;
-                break;
-              case ESC_TYPE_QUOTE_OPEN:
-                splitter = true;
-                quote_open_beg = (int)offset;
-                skip_word = st.bSkipFirstWord;
-                break;
-              case ESC_TYPE_QUOTE_CLOSE:
-                splitter = true;
-                quote_close_end = (int)offset + pe->len;
-                skip_word = st.bSkipFirstWord;
-                break;
-            }
-            step = pe->len;
+    if (cls == HCH_AMP) {
+      /* check for character references (escapes) */
+      uint32_t ch[2];
+      size_t reflen = html_entity_decode(p, size - offset, ch);
+      
+      if (reflen) {
+        switch(escape_type(ch)) {
+          case ESC_SPACER:
+            spacer = true;
             break;
+          case ESC_SPLITTER:
+            splitter = true;
+            skip_word = st.bSkipFirstWord;
+            break;
+          case ESC_QUOTE_OPEN:
+            splitter = true;
+            quote_open_beg = (int)offset;
+            skip_word = st.bSkipFirstWord;
+            break;
+          case ESC_QUOTE_CLOSE:
+            splitter = true;
+            quote_close_end = (int)(offset + reflen);
+            skip_word = st.bSkipFirstWord;
+            break;
+          case ESC_CHAR:
+            c = (char)ch[0];
+            cls = s_htmlChars.cls[(unsigned char)c];
+            splitter = (cls == HCH_SPLITTER);
+            spacer   = (cls == HCH_SPACER);
+            break;
+          case ESC_WORD:
+            // word is searched by its text with decoded characters
+            if (text_beg == -1) {
+              text_beg = (int)ctx.wordText.size();
+              synced = offset - wlen;
             }
-        }
-        if (c == '<' || spacer || splitter) {
-          SAVE_WORD;
-                    
-          if (c == '<' || splitter)
-          {
-            if (weds.size() && weds.back().wt != WTYPE_TAG) {
-              // we only interest of fact of tag, not their number
-              struct we_draft wed = {offset, 0, 0, 0, WTYPE_TAG};
-              weds.push_back(wed);
+            ctx.wordText.append(html + synced, offset - synced);
+            for (unsigned k = 0; k < 2 && ch[k]; k++) {
+              if (!append_codepage_char(st.codepage, ch[k], ctx.wordText))
+                ctx.wordText += ' ';
             }
-                        
-            if (c == '<')
-              state =  STATE_INTAG;
-          }
-
-          wlen = 0;
+            synced = offset + reflen;
+            break;
+        }
+        step = reflen;
+      }
+    }
+    
+    if (cls == HCH_LT)
+      lastopen = p;
+        
+    if (cls == HCH_LT || spacer || splitter) {
+      SAVE_WORD;
+      
+      if (text_beg != -1) {
+        // word isn't saved
+        ctx.wordText.resize(text_beg);
+        text_beg = -1;
+      }
                     
-          // check for end of sentence - mark
-          if (c == '.' || c == '?' || c == '!' || c == ';') 
-            skip_word = st.bSkipFirstWord;
+      if (cls == HCH_LT || splitter)
+      {
+        if (weds.size() && weds.back().wt != WTYPE_TAG) {
+          // we only interest of fact of tag, not their number
+          struct we_draft wed = {(int)offset, 0, 0, 0, 0, WTYPE_TAG};
+          weds.push_back(wed);
         }
-        else 
-          wlen++;
-        break;
+                        
+        if (cls == HCH_LT)
+          state =  STATE_INTAG;
+      }
 
-      case STATE_INTAG:
-        if (c == '>') {
-          bool closer;
-          html_tag_t tag;
+      wlen = 0;
                     
-          tag = extract_tag(lastopen, p - lastopen, closer);
-          switch(tag) {
-            case TAG_HTML:
-              within_html = !closer;
-              UPDATE_MEM_TEXT;
-              break;
-            case TAG_BODY:
-              within_body = !closer;
-              UPDATE_MEM_TEXT;
-              break;
-            case TAG_A:
-              within_a = !closer;
-              UPDATE_MEM_TEXT;
-            default:
-              ;
-          }
-                    
-          state = STATE_INTEXT;
-          skip_word = st.bSkipFirstWord;
-          quote_open_beg = quote_close_end = -1;
-        }
+      // check for end of sentence - mark
+      if (c == '.' || c == '?' || c == '!' || c == ';') 
+        skip_word = st.bSkipFirstWord;
     }
+    else 
+      wlen += step;
   } /* for p ... */
 
   // save last word
@@ -799,8 +1280,15 @@ void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::Mar
   }
 
   // now fill tag_dist with distance to nearest tag or end of document
-  // looking from end
-  deque<wordentry_t> wq;
+  // looking from end, words are written in direct sequence
+  size_t nwords = 0;
+  for (size_t i = 0; i < weds.size(); i++) {
+    if (weds[i].wt != WTYPE_TAG)
+      nwords++;
+  }
+  
+  size_t k = words->size() + nwords;
+  words->resize(k);
 
   unsigned dist = 0;
   for (int i = (int)weds.size() - 1; i >= 0; i--) 
@@ -809,7 +1297,7 @@ void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::Mar
     if (wer.wt == WTYPE_TAG)
       dist = 0;
     else {
-      wordentry_t we;
+      wordentry_t &we = (*words)[--k];
 
       ++dist;
 
@@ -819,15 +1307,9 @@ void QCHtmlMarkerImpl::html_getwords(const string &text, const QCHtmlMarker::Mar
       we.grasp_left  = wer.grasp_left;
       we.grasp_right = wer.grasp_right;
       we.marked = 0;
-      wq.push_front(we);
+      we.decoded = wer.decoded;
     }
   }
-   
-  // now write result in direct sequence
-  deque<wordentry_t>::const_iterator dqi;
-  for (dqi = wq.begin(); dqi != wq.end(); dqi++) {
-    words->push_back(*dqi);
-  }
 }
 
 
@@ -843,7 +1325,10 @@ QCHtmlMarker::QCHtmlMarker(const PhraseSearcher *psrch /* = NULL */) {
 
 QCHtmlMarker::~QCHtmlMarker() { delete m_pimpl; }
 
-void QCHtmlMarker::setPhraseSearcher(const PhraseSearcher *psrch) { m_pimpl->m_psrch = psrch; }
+void QCHtmlMarker::setPhraseSearcher(const PhraseSearcher *psrch) { 
+  m_pimpl->m_psrch = psrch; 
+  m_pimpl->clearTranscoded(m_pimpl->m_cacheCp); // userdata is of this searcher
+}
 
 //---------------------------------------------------------------------------------
 /// @brief markup text
@@ -853,12 +1338,25 @@ void QCHtmlMarker::setPhraseSearcher(const PhraseSearcher *psrch) { m_pimpl->m_p
 /// @return amount of marked blocks
 //---------------------------------------------------------------------------------
 unsigned QCHtmlMarker::markup(const string &text, string &os, const MarkupSettings &st)
+{
+  return markup(text, os, st, m_pimpl->m_ctx);
+}
+
+//---------------------------------------------------------------------------------
+/// @brief markup text with buffers of caller
+/// @param text - input text
+/// @param os   - marked up output stream
+/// @param st   - settings
+/// @param ctx  - buffers of markup
+/// @return amount of marked blocks
+//---------------------------------------------------------------------------------
+unsigned QCHtmlMarker::markup(const string &text, string &os, const MarkupSettings &st, MarkupContext &ctx)
 {
   os.clear();
   if (text.empty())    
     return 0;
   
-  return m_pimpl->markup(text, os, st);
+  return m_pimpl->markup(text, os, st, *ctx.m_pbuf);
 }
 
 //---------------------------------------------------------------------------------
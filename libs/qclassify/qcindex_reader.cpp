@@ -7,6 +7,9 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include "qclassify/qclassify.hpp"
 #include "qclassify/qclassify_impl.hpp"
 
@@ -16,24 +19,171 @@ using namespace gogo::QueryClassifierHelper;
 namespace gogo
 {
 
+QCIndexReader::QCIndexReader() : m_pranking(new ranking), m_lock(0) {}
+
+QCIndexReader::~QCIndexReader() 
+{
+  releaseRanking(m_pranking);
+}
+
 void QCIndexReader::load(MemReader &mrd)
 {
   uint32_t n;
+  ranking *pr = new ranking;
   
   mrd >> n;
-  m_classes.reserve(n);
+  m_names.clear();
+  m_names.reserve(n);
+  pr->pens.reserve(n);
   while (n--) {
-    QCClass qc;
+    QCPenalties pens;
+    string name;
+    
+    mrd >> pens >> name;
+    m_names.push_back(name);
+    pr->pens.push_back(pens);
+  }
+  
+  publish(pr);
+}
+
+bool QCIndexReader::getId(const std::string &name, unsigned &id) const
+{
+  vector<string>::const_iterator it = find(m_names.begin(), m_names.end(), name);
+  if (it == m_names.end())
+    return false;
+  
+  id = it - m_names.begin();
+  return true;
+}
+
+/// @brief multiply baseRank and penalties of every flag combination
+// Ranks are the same as of plain double arithmetic (base * baseRank * penalties, 
+// truncated): multiplier is the smallest one reaching every such rank, bases
+// overshot by it due to representation error of penalties are marked in 'below'.
+void QCIndexReader::fillRankTable(const QCPenalties &pens, rank_table &tbl)
+{
+  for (int flags = 0; flags <= 0xF; flags++) 
+  {
+    uint64_t ranks[256];
+    uint64_t mult = 0;
     
-    mrd >> qc.pens >> qc.name;
-    m_classes.push_back(qc);
+    ranks[0] = 0;
+    for (unsigned base = 1; base < 256; base++) 
+    {
+      double rank = (double)base;
+      rank *= pens.baseRank;
+      if (flags & PhraseSearcher::MATCH_FL_REORDERED)
+        rank *= pens.reorder_penalty;
+      if (flags & PhraseSearcher::MATCH_FL_DIFF_FORM)
+        rank *= pens.diff_form_penalty;
+      if (flags & PhraseSearcher::MATCH_FL_PARTIAL)
+        rank *= pens.partial_penalty;
+      if (flags & PhraseSearcher::MATCH_FL_DIFF_CAPS)
+        rank *= pens.diff_caps_penalty;
+      
+      // negative multiplier ranks nothing, multiplier is below 2^24: leave room for base
+      rank = max(0.0, min(rank, (double)base * (1U << 24)));
+      ranks[base] = (uint64_t)rank;
+      mult = max(mult, ((ranks[base] << 32) + base - 1) / base);
+    }
+    
+    tbl.mult[flags] = mult;
+    memset(tbl.below[flags], 0, sizeof(tbl.below[flags]));
+    for (unsigned base = 1; base < 256; base++) {
+      if (((base * mult) >> 32) > ranks[base])
+        tbl.below[flags][base >> 5] |= 1U << (base & 31);
+    }
   }
 }
 
+/// @brief build rank tables and replace current ranking with @arg pr
+// Replaced ranking is freed by the last of it's holders.
+void QCIndexReader::publish(ranking *pr)
+{
+  pr->tables.resize(pr->pens.size());
+  for (unsigned i = 0; i < pr->pens.size(); i++)
+    fillRankTable(pr->pens[i], pr->tables[i]);
+  
+  ranking *pold;
+  {
+    SpinGuard guard(m_lock);
+    pold = m_pranking;
+    __sync_bool_compare_and_swap(&m_pranking, pold, pr); // full barrier: ranking is built before it's seen
+  }
+  releaseRanking(pold);
+}
+
+const QCIndexReader::ranking *QCIndexReader::acquireRanking() const
+{
+  SpinGuard guard(m_lock); // ranking can't be released by replacement meanwhile
+  ranking *pr = m_pranking;
+  __sync_add_and_fetch(&pr->nrefs, 1);
+  return pr;
+}
+
+void QCIndexReader::releaseRanking(const ranking *pr)
+{
+  if (pr && !__sync_sub_and_fetch(&pr->nrefs, 1))
+    delete pr;
+}
+
+/// @brief read value from config
+/// @return false if value isn't set
+static bool getConfigValue(const XmlConfig *pcfg, const string &section, const char *name, double &val)
+{
+  if (!pcfg->GetStr(section, name))
+    return false;
+  
+  val = pcfg->GetDouble(section, name, 0.0);
+  return true;
+}
+
 /// @brief override loaded penalties and baseRank from config
-void QCIndexReader::mergeConfig(const XmlConfig *)
+void QCIndexReader::mergeConfig(const XmlConfig *pcfg)
 {
+  vector<string> qclist;
+  ranking *pr = new ranking;
+  bool bChanged = false;
+  
+  pr->pens = m_pranking->pens;
+  pcfg->GetSections(&qclist, "QueryClass_");
+  for (vector<string>::const_iterator it = qclist.begin(); it != qclist.end(); it++) 
+  {
+    vector<string>::const_iterator itName = find(m_names.begin(), m_names.end(), XMLtag2QCname(*it));
+    if (itName == m_names.end())
+      continue;
+    
+    QCPenalties &pens = pr->pens[itName - m_names.begin()];
+    double val;
+    
+    if (getConfigValue(pcfg, *it, "ReorderingPenalty", val)) {
+      pens.reorder_penalty = QCPenalties::penaltiToMultiplier(val);
+      bChanged = true;
+    }
+    if (getConfigValue(pcfg, *it, "PartialPenalty", val)) {
+      pens.partial_penalty = QCPenalties::penaltiToMultiplier(val);
+      bChanged = true;
+    }
+    if (getConfigValue(pcfg, *it, "DiffFormPenalty", val)) {
+      pens.diff_form_penalty = QCPenalties::penaltiToMultiplier(val);
+      bChanged = true;
+    }
+    if (getConfigValue(pcfg, *it, "DiffCapsPenalty", val)) {
+      pens.diff_caps_penalty = QCPenalties::penaltiToMultiplier(val);
+      bChanged = true;
+    }
+    if (getConfigValue(pcfg, *it, "BaseRank", val)) {
+      pens.baseRank = val;
+      bChanged = true;
+    }
+  }
   
+  if (!bChanged) {
+    delete pr;
+    return;
+  }
+  publish(pr);
 }
 
 }
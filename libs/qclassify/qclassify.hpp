@@ -13,6 +13,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include <iosfwd>
 
 #include "defs.hpp"
 #include <Interfaces/cpp/LemInterface.hpp>
@@ -22,7 +23,9 @@
 #include "utils/memfile.hpp"
 #include "utils/memio.hpp"
 #include "utils/hash_array.hpp"
+#include "utils/rank_bitmap.hpp"
 #include "utils/fileutils.hpp"
+#include "utils/utf8_tokenizer.hpp"
 
 
 namespace gogo {
@@ -32,14 +35,23 @@ class QCBasicPhraseStorage : public QSerializerOut
 {
   mutable size_t m_acclen;
   std::vector<std::string> m_phrases;
-  mutable PtrArrayWriter<uint32_t> m_offsets;
+  mutable PtrArrayVarWriter m_offsets; // by block
   mutable bool m_bDirty;
+  bool m_bWide;
   
   public:
+    /// phrases are front-coded in blocks: each phrase but the first of block
+    /// is saved as length of prefix shared with previous phrase and the rest
+    static const unsigned BLOCK_SIZE = 16;
+    
     QCBasicPhraseStorage();
     virtual ~QCBasicPhraseStorage() {};
     
     void prepareExport() const;
+    /// @brief use 64 bit offsets (see PhraseIndexer::setWideFormat)
+    void setWide(bool bWide) { m_bWide = bWide; m_bDirty = true; }
+    /// @return size of encoded phrases
+    size_t dataSize() const { prepareExport(); return m_acclen; }
     
     void optimize(const std::vector<unsigned> &vshift);
     void addPhrase(const std::string &s);
@@ -52,11 +64,26 @@ class QCBasicPhraseStorage : public QSerializerOut
 
 class QCBasicPhraseReader : public QSerializerIn
 {
-  PtrArrayReader<uint32_t> m_offsets;
-  const char* m_phrases;
+  PtrArrayVarReader<> m_offsets; // by block
+  uint32_t m_n;
+  // decoded blocks: [offset of phrase x BLOCK_SIZE][phrases], 
+  // decoded once and kept while reader lives since phrases are referred by pointers:
+  // cache isn't bounded, it grows up to decoded size of all phrases read
+  mutable std::vector<char *> m_blocks;
+  
+  const char *decodeBlock(unsigned iblock) const;
+  
+  QCBasicPhraseReader(const QCBasicPhraseReader &);
+  QCBasicPhraseReader &operator = (const QCBasicPhraseReader &);
+  
   public:
-    virtual ~QCBasicPhraseReader() {};
-    const char *getPhrase(unsigned i);
+    QCBasicPhraseReader() : m_n(0) {}
+    virtual ~QCBasicPhraseReader();
+    /// @return phrase by index (valid until reader is loaded again or destroyed)
+    /// @throw std::out_of_range
+    const char *getPhrase(unsigned i) const;
+    /// @brief storage has 64 bit offsets (should be set before loading)
+    void setWide(bool bWide) { m_offsets.setWide(bWide); }
     // import facility
     virtual void load(MemReader &mrd);
 };
@@ -68,7 +95,9 @@ class QCScatteredStringsWriter : public QSerializerOut
   std::map<unsigned, std::string> m_stings;
   mutable size_t m_acclen;
   mutable bool m_bDirty;
-  mutable HashArrayIndexer<uint32_t, uint32_t> m_id2offset;
+  mutable RankBitmapWriter m_presence; // string IDs
+  mutable PtrArrayVarWriter m_offsets; // by slot of ID
+  mutable std::vector<const std::string *> m_unique; // strings to save (equal ones are saved once)
   
   public:
     QCScatteredStringsWriter();
@@ -76,6 +105,10 @@ class QCScatteredStringsWriter : public QSerializerOut
     void add(unsigned id, const std::string &s);
     void optimize(const std::vector<unsigned> &vshift);
     void prepareExport() const;
+    /// @brief use 64 bit offsets (see PhraseIndexer::setWideFormat)
+    void setWide(bool bWide) { m_offsets.setWide(bWide); m_bDirty = true; }
+    /// @return size of saved strings
+    size_t dataSize() const { prepareExport(); return m_acclen; }
     
     // export facility
     virtual size_t size() const;
@@ -84,8 +117,8 @@ class QCScatteredStringsWriter : public QSerializerOut
 
 class QCScatteredStringsReader : public QSerializerIn
 {
-  const char *m_pBase;
-  HashArraySearcher<uint32_t, uint32_t> m_id2offset;
+  RankBitmapReader m_presence; // string IDs
+  PtrArrayVarReader<> m_offsets; // by slot of ID
   
   public:
     virtual ~QCScatteredStringsReader() {};
@@ -93,6 +126,8 @@ class QCScatteredStringsReader : public QSerializerIn
     /// @param id saved string identifyer
     /// @return string pointer or NULL unless found
     const char *get(unsigned id) const throw();
+    /// @brief strings have 64 bit offsets (should be set before loading)
+    void setWide(bool bWide) { m_offsets.setWide(bWide); }
     // import facility
     virtual void load(MemReader &mrd);
 };
@@ -145,29 +180,143 @@ class QCIndexWriter : public QSerializerOut
 //
 class QCIndexReader : public QSerializerIn
 {
-  struct QCClass {
-    std::string name;
-    QCPenalties pens;
-  }; 
-  std::vector<QCClass> m_classes;
+  public:
+    /// @brief fixed point (32.32) rank multipliers of class by match flags:
+    /// baseRank and penalties of every flag set are multiplied in advance
+    struct rank_table {
+      uint64_t mult[16];
+      uint32_t below[16][8]; // bitmap of 8 bit base ranks getting one less than by mult
+    };
+    
+    /// @brief penalties and rank tables of all classes (replaced as a whole),
+    /// freed when reader and all holders (see acquireRanking) are done with it
+    struct ranking {
+      std::vector<QCPenalties> pens;
+      std::vector<rank_table> tables;
+      mutable volatile int nrefs;
+      
+      ranking() : nrefs(1) {}
+      const rank_table *getTables() const {
+        return (tables.empty()) ? NULL : &tables[0];
+      }
+    };
+    
+  private:
+    std::vector<std::string> m_names;
+    ranking * volatile m_pranking;
+    mutable volatile int m_lock; // serializes replacement and acquiring of ranking
+    
+    static void fillRankTable(const QCPenalties &pens, rank_table &tbl);
+    void publish(ranking *pr);
+    
+    QCIndexReader(const QCIndexReader &);
+    QCIndexReader &operator = (const QCIndexReader &);
   
   public:
-    virtual ~QCIndexReader() {};
+    QCIndexReader();
+    virtual ~QCIndexReader();
     
+    //---------------------------------------------------------------------------------
+    /// @brief override penalties and BaseRank of classes found in config
+    /// new rank tables are swapped in atomically, so running searches are unaffected;
+    /// searcher picks them up on PhraseSearcher::setQCIndex()
     void mergeConfig(const XmlConfig *pcfg);
-    size_t amount() const { return m_classes.size(); }
+    
+    size_t amount() const { return m_names.size(); }
+    /// @brief current penalties by class ID (valid until penalties are replaced)
     const QCPenalties& getPenalties(unsigned id) const {
-      return m_classes[id].pens;
+      return m_pranking->pens[id];
     }
     const std::string& getName(unsigned id) const {
-      return m_classes[id].name;
+      return m_names[id];
+    }
+    /// @brief find class ID by name
+    /// @return false if there is no such class
+    bool getId(const std::string &name, unsigned &id) const;
+    
+    /// @brief current rank tables by class ID (valid until penalties are replaced)
+    const rank_table *getRankTables() const {
+      return m_pranking->getTables();
+    }
+    
+    /// @brief take current ranking, it's kept (even by replacement or destruction 
+    /// of reader) until releaseRanking() 
+    const ranking *acquireRanking() const;
+    static void releaseRanking(const ranking *pr);
+    
+    /// @brief rank of match: base * baseRank * penalties of flags, truncated
+    static unsigned applyRank(const rank_table &tbl, unsigned base, int flags) {
+      const uint32_t *below = tbl.below[flags & 0xF];
+      return (unsigned)((base * tbl.mult[flags & 0xF]) >> 32) - ((below[(base >> 5) & 7] >> (base & 31)) & 1);
     }
     
     // import facilities
     virtual void load(MemReader &mrd);
 };
 
+//
+// Cache of word first forms (lemmas) shared by phrase splitters of searchers
+//
+class LemmaCache
+{
+  volatile uint64_t *m_slots; // [form hash:32][lemma hash:32], 0 - empty
+  uint32_t m_mask;
+  
+  LemmaCache(const LemmaCache &);
+  LemmaCache &operator = (const LemmaCache &);
+  
+  public:
+    /// words which aren't passed to lemmatizer (see PhraseIndexer::setLemmaBypass)
+    enum {
+      BYPASS_DIGITS = 0x01, // digits only
+      BYPASS_SHORT  = 0x02, // single character
+      BYPASS_LATIN  = 0x04, // ASCII letters and digits only
+    };
+    
+    /// @brief counters of splitter (reset by PhraseSearcher::getLemmaStat)
+    struct stat {
+      uint64_t hits;      // lemma taken from cache
+      uint64_t misses;    // lemmatizer called, lemma cached
+      uint64_t evictions; // cached lemma replaced by other word
+      uint64_t bypassed;  // lemmatizer skipped by bypass rules
+    };
+    
+    //---------------------------------------------------------------------------------
+    /// @param size number of entries, rounded up to power of 2 [in]
+    LemmaCache(unsigned size = 65536);
+    ~LemmaCache();
+    
+    /// @return true if normalized word @arg norm shouldn't be lemmatized by @arg bypass rules
+    static bool isBypassed(const std::string &norm, unsigned bypass);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief lookup lemma hash of word form hash (safe to call from several threads)
+    /// @return false if form isn't cached
+    bool lookup(uint32_t form, uint32_t &lemma) const {
+      if (!form)
+        return false;
+      uint64_t slot = m_slots[slotOf(form)];
+      if ((uint32_t)(slot >> 32) != form)
+        return false;
+      lemma = (uint32_t)slot;
+      return true;
+    }
+    
+    /// @brief cache lemma hash of word form hash (safe to call from several threads)
+    /// @return true if other word has been evicted
+    bool insert(uint32_t form, uint32_t lemma);
+    
+    /// @brief drop cached lemmas (when lemmatizer is changed)
+    void clear();
+    
+  private:
+    uint32_t slotOf(uint32_t form) const { return form & m_mask; } // form is hash already
+};
+
 class PhraseIndexerImpl;
+namespace qcls_impl { 
+  struct indexed_phrase; 
+}
 
 //
 // Phrase index writer
@@ -183,8 +332,17 @@ class PhraseIndexer : public QSerializerOut
       unsigned nwords_uniq;
       unsigned nphrases_uniq;
       unsigned nregexp;
+      unsigned nhotwords;   // keywords moved to pair index
+      unsigned nhotphrases; // phrases addressed by word pair
+      unsigned nclasslists; // distinct class lists of multiclass phrases
+      unsigned nmerged;     // phrases merged by word sequence (see setDedupByWords)
+      unsigned nforms;      // word forms of table (see setFormsTable)
+      unsigned ntriekeys;   // distinct word sequences of exact trie (see setExactTrie)
+      bool wide;            // index is exported in wide format (see setWideFormat)
       
-      stat() : nwords(0), nphrases(0), nwords_uniq(0), nphrases_uniq(0), nregexp(0) {}
+      stat() : nwords(0), nphrases(0), nwords_uniq(0), nphrases_uniq(0), nregexp(0), 
+               nhotwords(0), nhotphrases(0), nclasslists(0), nmerged(0), nforms(0), ntriekeys(0), 
+               wide(false) {}
     };
   
   public:
@@ -197,6 +355,54 @@ class PhraseIndexer : public QSerializerOut
     /// @param bSave trigger
     void saveOrigPhrases(bool bSave);
     
+    //---------------------------------------------------------------------------------
+    /// @brief set posting length of "hot" keywords
+    /// phrases of keyword with more than @arg n phrases are addressed by 
+    /// pair of words (keyword + rarest of others) instead of keyword only
+    /// @param n threshold, 0 - disable pair index
+    void setHotKeywordThreshold(unsigned n);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief deduplicate phrases by word sequence (word IDs, forms and capitalization)
+    /// phrases differing by spacing or punctuation only are stored as one phrase
+    /// with the best rank of every class, origin and user data of the first one are kept
+    /// @param bDedup trigger (should be set before phrases are added)
+    void setDedupByWords(bool bDedup);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief force wide index format: 32 bit word IDs, 64 bit section offsets
+    /// narrow format (22 bit word IDs, 32 bit offsets) is used unless collection 
+    /// doesn't fit it, so the trigger is needed by tests and benchmarks mostly
+    /// @param bWide trigger
+    void setWideFormat(bool bWide);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief save table of word forms: hash of form to hash of it's lemma
+    /// searcher resolves words of table without lemmatizer (see PhraseSearcher::setStrictForms);
+    /// forms of phrase words and ones added by addWordForm are saved if their lemmas are indexed
+    /// @param bForms trigger
+    void setFormsTable(bool bForms);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief don't lemmatize words matching rules (digits only, single character etc.)
+    /// rules are saved with index and applied by searcher, so query words get the same hashes
+    /// @param bypass LemmaCache::BYPASS_* rules, 0 - none (default)
+    void setLemmaBypass(unsigned bypass);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief add form(s) of word to forms table (see setFormsTable)
+    /// @param word word form, lemmatized by indexer's lemmatizer
+    void addWordForm(const std::string &word);
+    /// @brief add form of word by hashes (see PhraseSearcher::exportPhrases)
+    void addFormHash(uint32_t form, uint32_t lemma);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief save trie of plain phrases by normalized word sequence: exact engine
+    /// of searcher (see PhraseSearcher::scanExact); trie matches words as written,
+    /// index is built by lemmas as usual if lemmatizer is set
+    /// @param bTrie trigger (should be set before phrases are added)
+    void setExactTrie(bool bTrie);
+    
     //---------------------------------------------------------------------------------
     /// @brief add phrase to index
     /// @param cls phrase class
@@ -206,6 +412,10 @@ class PhraseIndexer : public QSerializerOut
     void addPhrase(unsigned cls, const std::string &phrase, 
                    unsigned rank, const char *udata = NULL);
     
+    //---------------------------------------------------------------------------------
+    /// @brief add phrase record of loaded index (see PhraseSearcher::exportPhrases)
+    void addIndexedPhrase(const qcls_impl::indexed_phrase &ip);
+    
     void getStat(stat *st) const;
     void optimize();
     
@@ -216,6 +426,51 @@ class PhraseIndexer : public QSerializerOut
 
 
 class PhraseSearcherImpl;
+class PhraseTopCollector;
+class QCResultArray;
+
+//
+// Set of class IDs wanted by search (see PhraseSearcher search functions),
+// empty set wants all classes as NULL mask does
+//
+class QCClassMask
+{
+  std::vector<uint32_t> m_bits;
+  uint32_t m_folded; // bits (class ID % 32) of classes: filter of phrase class bitmaps in index
+  
+  public:
+    QCClassMask() : m_folded(0) {}
+    
+    /// @brief bit of class in folded 32 bit class bitmap
+    static uint32_t foldedBit(unsigned clsid) { return 1U << (clsid & 0x1F); }
+    
+    void add(unsigned clsid) {
+      if (m_bits.size() <= (clsid >> 5))
+        m_bits.resize((clsid >> 5) + 1, 0);
+      m_bits[clsid >> 5] |= foldedBit(clsid);
+      m_folded |= foldedBit(clsid);
+    }
+    void clear() { 
+      m_bits.clear(); 
+      m_folded = 0; 
+    }
+    bool has(unsigned clsid) const {
+      return (clsid >> 5) < m_bits.size() && (m_bits[clsid >> 5] & foldedBit(clsid));
+    }
+    bool empty() const { return !m_folded; }
+    uint32_t folded() const { return m_folded; }
+};
+
+//
+// Receiver of search results (see PhraseSearcher::searchPhrase)
+//
+class SearchVisitor
+{
+  public:
+    /// @brief called for every class of every matched phrase ranked nonzero
+    virtual void visit(unsigned clsid, unsigned phrase_id, unsigned rank, int match_flags) = 0;
+    virtual ~SearchVisitor() {}
+};
 
 //
 // Phrase searcher using saved index
@@ -230,6 +485,7 @@ class PhraseSearcher : public QSerializerIn
       MATCH_FL_DIFF_CAPS = 0x08
     };
     
+    /// @brief set class index (set it again to pick up penalties after QCIndexReader::mergeConfig)
     void setQCIndex(QCIndexReader *pQCIndex);
     
     typedef std::map<std::string, unsigned> res_t;  // phrase class name to rank
@@ -253,6 +509,55 @@ class PhraseSearcher : public QSerializerIn
     
     typedef std::map<unsigned, phrase_info> res_cls_num_t; // phrase class ID to phrase_info
     
+    struct cls_matched {
+      unsigned clsid;
+      phrase_info info;
+    };
+    
+    /// @brief candidate statistics (candidates are pruned by ranked searches only)
+    struct search_stat {
+      unsigned nvisited; // candidates taken from postings and dictionary
+      unsigned npruned;  // skipped without verification: no class ranks such match
+      unsigned ndropped; // verified, but ranked zero by every class
+      unsigned nbounded; // skipped since couldn't outrank result (searchBest, searchTopK)
+      unsigned nfiltered; // skipped by class bitmap: no wanted class (class mask of search)
+    };
+    
+    /// @brief word of pre-tokenized query (see tokenize, searchTokens)
+    /// word ID is resolved by dictionary of searcher and valid for it's index only
+    struct query_token {
+      uint32_t hash;     // hash of normalized first form (MurmurHash32A)
+      uint32_t form;     // hash of normalized word form
+      bool     upcase;   // the first character of word is uppercase
+      bool     resolved; // id and singles are set (see resolveTokens)
+      uint32_t id;       // word ID, ~0U - word isn't indexed
+      uint32_t singles;  // single-word phrases of word
+      
+      query_token() : hash(0), form(0), upcase(false), resolved(false), id(~0U), singles(~0U) {}
+    };
+    
+    /// @brief occurrence of phrase in text found by exact trie (see scanExact)
+    struct exact_occurrence {
+      unsigned first;     // the first word of occurrence
+      unsigned nwords;    // number of words
+      unsigned phrase_id;
+      int      match_flags; // 0 or MATCH_FL_DIFF_CAPS
+      unsigned clsid;     // the best class of phrase
+      unsigned rank;      // rank of phrase by the class
+    };
+    
+    /// @brief engine matching phrases of documents (see QCHtmlMarker)
+    typedef enum {
+      EXACT_ENGINE_INDEX, // every word window is searched as query
+      EXACT_ENGINE_TRIE   // exact occurrences only, by trie (see scanExact)
+    } exact_engine_t;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief make token of word lemmatized by caller (normalized here as tokenize does)
+    /// @param lemma first form of word [in]
+    /// @param form word form as it's met in text [in]
+    /// @param t unresolved token [out]
+    static void makeToken(const std::string &lemma, const std::string &form, query_token &t);
      
     PhraseSearcher(LemInterface *plem = NULL);
     void setLemmatizer(LemInterface *plem);
@@ -274,6 +579,136 @@ class PhraseSearcher : public QSerializerIn
     unsigned searchPhrase(const std::string &s, res_num_t &res) const;
     unsigned searchPhrase(const std::string &s, res_t &res) const;
     
+    //---------------------------------------------------------------------------------
+    /// @brief search without allocations: results are passed to visitor
+    /// @param s phrase to match [in]
+    /// @param visitor receiver of (class ID, phrase ID, rank, flags) [in]
+    /// @param pmask classes to search for, NULL - all [in]
+    /// @return number of visits
+    unsigned searchPhrase(const std::string &s, SearchVisitor &visitor, const QCClassMask *pmask = NULL) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief search without allocations: best phrase of every class in caller's array
+    /// (array is sized by number of classes on the first use)
+    /// @param s phrase to match [in]
+    /// @param res class ID to phrase_info array [out]
+    /// @param pmask classes to search for, NULL - all [in]
+    /// @return number of classes matched
+    unsigned searchPhrase(const std::string &s, QCResultArray &res, const QCClassMask *pmask = NULL) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief search for the best matched class only (quicker than searchPhrase + selectBest)
+    /// rank ties are resolved in favour of lower class ID as selectBest does (exact match is preferred among phrases of class)
+    /// @param s phrase to match [in]
+    /// @param clsid class ID of the best match [out]
+    /// @param info phrase ID and rank of the best match [out]
+    /// @param pmask classes to search for, NULL - all [in]
+    /// @return false if nothing matched
+    bool searchBest(const std::string &s, unsigned &clsid, phrase_info &info, 
+                    const QCClassMask *pmask = NULL) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief search for k best matched classes (ordered as searchBest selects)
+    /// @param s phrase to match [in]
+    /// @param k number of classes to return [in]
+    /// @param res best classes with their best phrases, no more than @arg k [out]
+    /// @param pmask classes to search for, NULL - all [in]
+    /// @return number of classes found
+    unsigned searchTopK(const std::string &s, unsigned k, std::vector<cls_matched> &res, 
+                        const QCClassMask *pmask = NULL) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief split and lemmatize text as searchPhrase does, tokens are resolved
+    /// @param s text [in]
+    /// @param tokens words of text [out]
+    /// @return number of tokens
+    unsigned tokenize(const std::string &s, std::vector<query_token> &tokens) const;
+    
+    /// @brief the same for text of code page @arg cp: single-byte text isn't transcoded,
+    /// it's words are normalized (and hashed) to UTF-8 directly
+    unsigned tokenize(const char *s, size_t len, codepage_t cp, std::vector<query_token> &tokens) const;
+    
+    /// @brief resolve word IDs of tokens once to reuse them by many searches
+    void resolveTokens(query_token *tokens, unsigned n) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief search by pre-tokenized query (unresolved tokens are resolved on the fly)
+    /// @param tokens, n query words [in]
+    /// @param phrases matched phrases [out]
+    /// @param praw source text to match regular expression phrases, NULL - don't match them [in]
+    /// @return number of phrases matched
+    unsigned searchTokens(const query_token *tokens, unsigned n, std::vector<phrase_matched> &phrases, 
+                          const std::string *praw = NULL) const;
+    
+    /// @brief the same as searchPhrase with visitor, by pre-tokenized query
+    unsigned searchTokens(const query_token *tokens, unsigned n, SearchVisitor &visitor, 
+                          const QCClassMask *pmask = NULL, const std::string *praw = NULL) const;
+    
+    /// @brief the same as searchPhrase with result array, by pre-tokenized query
+    unsigned searchTokens(const query_token *tokens, unsigned n, QCResultArray &res, 
+                          const QCClassMask *pmask = NULL, const std::string *praw = NULL) const;
+    
+    /// @brief the same as searchBest, by pre-tokenized query
+    bool searchBest(const query_token *tokens, unsigned n, unsigned &clsid, phrase_info &info, 
+                    const QCClassMask *pmask = NULL, const std::string *praw = NULL) const;
+    
+    /// @brief get (and reset) candidate pruning statistics
+    void getSearchStat(search_stat *st) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief share lemma cache (NULL - lemmatizer is called for every word)
+    /// cache is owned by caller and should be cleared when lemmatizer is changed
+    void setLemmaCache(LemmaCache *pcache);
+    /// @brief get (and reset) lemma cache counters of this searcher
+    void getLemmaStat(LemmaCache::stat *st) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief don't call lemmatizer for words missing from forms table of index
+    /// (index is built with PhraseIndexer::setFormsTable) - such words are taken as is;
+    /// otherwise lemmatizer is called for them only
+    /// @param bStrict trigger
+    void setStrictForms(bool bStrict);
+    /// @return index has table of word forms (see PhraseIndexer::setFormsTable)
+    bool hasFormsTable() const;
+    /// @return index has regular expression phrases (they need source text, see praw)
+    bool hasRegExps() const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief select engine of document matching
+    /// @param e engine, EXACT_ENGINE_TRIE needs index with trie (std::runtime_error otherwise)
+    void setExactEngine(exact_engine_t e);
+    exact_engine_t getExactEngine() const { return m_exactEngine; }
+    /// @return index has exact trie (see PhraseIndexer::setExactTrie)
+    bool hasExactTrie() const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief find all exact occurrences of plain phrases in text by trie in one pass
+    /// text is split and normalized as searchPhrase does without lemmatizer; phrase
+    /// words are matched in order, phrase is ranked by it's best wanted class
+    /// @param text text [in]
+    /// @param res occurrences ordered by the first word, then by number of words [out]
+    /// @param pmask classes to search for, NULL - all [in]
+    /// @return number of occurrences
+    unsigned scanExact(const std::string &text, std::vector<exact_occurrence> &res, 
+                       const QCClassMask *pmask = NULL) const;
+    
+    /// @brief the same for text split by caller to words (offset, length): they are split
+    /// further as searchPhrase does, occurrences begin and end on bounds of caller words
+    /// (first and nwords of occurrences count caller words)
+    /// @param maxwords max number of caller words of occurrence, 0 - unlimited [in]
+    /// @param cp code page of text [in]
+    unsigned scanExact(const std::string &text, const std::vector< std::pair<unsigned, unsigned> > &words, 
+                       unsigned maxwords, std::vector<exact_occurrence> &res, 
+                       const QCClassMask *pmask = NULL, codepage_t cp = CODEPAGE_UTF8) const;
+    
+    //---------------------------------------------------------------------------------
+    /// @brief add phrases of loaded index to indexer (re-indexing of class subset)
+    /// origins are saved if they are present in this index
+    /// @param idx indexer [out]
+    /// @param pmask classes to export, NULL or empty - all; other classes are dropped from phrases [in]
+    /// @return number of phrases exported
+    unsigned exportPhrases(PhraseIndexer &idx, const QCClassMask *pmask = NULL) const;
+    
     static res_cls_num_t::iterator selectBest(PhraseSearcher::res_cls_num_t &r);
     static res_num_t::iterator selectBest(PhraseSearcher::res_num_t &r);
     static res_t::iterator selectBest(PhraseSearcher::res_t &r);
@@ -293,14 +728,80 @@ class PhraseSearcher : public QSerializerIn
     const char *getOriginPhrase(unsigned phraseid) const;
     const char *getUserData(unsigned phraseid) const;
     const std::string &getClassName(unsigned clsid) const;
+    const char *getClassNamePtr(unsigned clsid) const { return getClassName(clsid).c_str(); }
     const QCIndexReader &getQCIndex() const { return *m_pQCIndex; }
     
   private:
-    mutable res_cls_num_t m_bufresult;
+    QCResultArray *m_pbufresult;
     PhraseSearcherImpl *m_pimpl;
     QCIndexReader *m_pQCIndex;
+    exact_engine_t m_exactEngine;
   
     inline unsigned applyPenalties(unsigned clsid, unsigned base, int flags) const;
+    unsigned visitResolved(const std::string *praw, SearchVisitor &visitor, const QCClassMask *pmask) const;
+    bool bestResolved(const std::string *praw, unsigned &clsid, phrase_info &info, const QCClassMask *pmask) const;
+    void updateBounds();
+    
+    friend class PhraseTopCollector;
+};
+
+//
+// Best phrase by class ID in flat array owned by caller:
+// no allocations after initialization, reset costs O(number of matched classes)
+//
+class QCResultArray
+{
+  std::vector<PhraseSearcher::phrase_info> m_info; // by class ID (zero rank - no match)
+  std::vector<unsigned> m_touched;                 // matched class IDs in order of match
+  
+  public:
+    QCResultArray(unsigned nclasses = 0) { init(nclasses); }
+    
+    void init(unsigned nclasses) {
+      PhraseSearcher::phrase_info empty = {0, 0};
+      m_info.assign(nclasses, empty);
+      m_touched.clear();
+      m_touched.reserve(nclasses);
+    }
+    
+    void clear() {
+      for (unsigned i = 0; i < m_touched.size(); i++)
+        m_info[ m_touched[i] ].rank = 0;
+      m_touched.clear();
+    }
+    
+    /// @brief keep phrase if it outranks the current one of class
+    void update(unsigned clsid, unsigned phrase_id, unsigned rank) {
+      PhraseSearcher::phrase_info &info = m_info[clsid];
+      if (!info.rank)
+        m_touched.push_back(clsid);
+      else if (info.rank >= rank)
+        return;
+      
+      info.phrase_id = phrase_id;
+      info.rank = rank;
+    }
+    
+    /// @return number of matched classes
+    unsigned size() const { return m_touched.size(); }
+    /// @return number of classes array could hold
+    unsigned capacity() const { return m_info.size(); }
+    /// @return class ID of i-th matched class
+    unsigned clsid(unsigned i) const { return m_touched[i]; }
+    
+    bool has(unsigned clsid) const { return clsid < m_info.size() && m_info[clsid].rank; }
+    const PhraseSearcher::phrase_info &operator[](unsigned clsid) const { return m_info[clsid]; }
+    
+    /// @return class ID with max rank (the lowest one of equal), ~0U if empty
+    unsigned best() const {
+      unsigned res = ~0U;
+      for (unsigned i = 0; i < m_touched.size(); i++) {
+        unsigned c = m_touched[i];
+        if (res == ~0U || m_info[c].rank > m_info[res].rank || (m_info[c].rank == m_info[res].rank && c < res))
+          res = c;
+      }
+      return res;
+    }
 };
 
 
@@ -321,8 +822,17 @@ class PhraseCollectionIndexer
     PhraseCollectionIndexer(LemInterface *plem = NULL);
     void setLemmatizer(LemInterface *plem);
     
+    /// @brief index files of classes by config
+    /// (LemmaBypassDigits, LemmaBypassShort, LemmaBypassLatin - don't lemmatize
+    /// words of digits, single character words, ASCII words; see setLemmaBypass)
     void indexByConfig(const XmlConfig *pcfg);
     void addFile(unsigned cls, std::istream &is);
+    void addWordForms(const char *path);
+    void setFormsTable(bool bForms) { m_phraseIndexer.setFormsTable(bForms); }
+    /// @brief see PhraseIndexer::setExactTrie (should be set before indexing)
+    void setExactTrie(bool bTrie) { m_phraseIndexer.setExactTrie(bTrie); }
+    /// @brief see PhraseIndexer::setLemmaBypass (should be set before indexing)
+    void setLemmaBypass(unsigned bypass) { m_phraseIndexer.setLemmaBypass(bypass); }
     void addPhrase(unsigned cls, const std::string &phrase, 
                    unsigned rank, const char *udata);
     void saveOrigPhrases(bool bSave);
@@ -339,18 +849,44 @@ class PhraseCollectionLoader
   std::auto_ptr<PhraseSearcher> m_psearcher;
   std::auto_ptr<QCIndexReader> m_qcreader;
   FileMemHolder m_idxfile;
+  std::vector<char> m_slimIndex; // index of loaded classes only (see loadFile)
   
   LemInterface   *m_plem;
+  std::auto_ptr<LemmaCache> m_lemmaCache; // shared by searchers of loader (NULL - off)
   PhraseSearcher m_emptySearcher;
+  unsigned m_hotThreshold;
   bool quiet_;
   
+  bool loadClasses(const std::vector<std::string> &classes, std::ostream &logstream);
+  
   public:
     PhraseCollectionLoader(LemInterface *plem = NULL);
     void setLemmatizer(LemInterface *plem);
     
-    bool loadFile(const char *path, bool bmmap = false, bool bmlock = false);
+    //---------------------------------------------------------------------------------
+    /// @brief load phrase index file
+    /// with class list in-memory index of these classes only is built and file is released
+    /// (class IDs and names are the same as in file)
+    /// @param path index file path
+    /// @param bmmap mmap(2) file instead of reading
+    /// @param bmlock mlock(2) file
+    /// @param pclasses names of classes to load, NULL - all; load fails if none of them is in file
+    bool loadFile(const char *path, bool bmmap = false, bool bmlock = false, 
+                  const std::vector<std::string> *pclasses = NULL);
+    
+    //---------------------------------------------------------------------------------
+    /// @brief load index file by QueryQualifier section of config
+    /// (IndexFile, MMaped, MLocked, LoadClasses - comma separated class names,
+    /// LemmaCacheSize - number of cached lemmas, 0 - off, 
+    /// StrictForms - see PhraseSearcher::setStrictForms,
+    /// ExactEngine - "index" (default) or "trie", see PhraseSearcher::setExactEngine)
     bool loadByConfig(const XmlConfig *pcfg);
     
+    //---------------------------------------------------------------------------------
+    /// @brief override penalties and BaseRank of loaded classes from config
+    /// (safe to call while searching from other threads)
+    void mergeConfig(const XmlConfig *pcfg);
+    
     bool is_loaded() const { return m_psearcher.get() != NULL; }
     bool reload() { return true; } /// @todo: write me
     
@@ -359,6 +895,8 @@ class PhraseCollectionLoader
     const PhraseSearcher *operator->() const { return getSearcher(); }
     
     const QCIndexReader &getQCIndex();
+    /// @return lemma cache shared by searchers (NULL - off)
+    LemmaCache *getLemmaCache() { return m_lemmaCache.get(); }
 };
 
 } // namespace gogo
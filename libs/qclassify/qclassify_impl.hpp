@@ -10,7 +10,8 @@
 #include <stdint.h>
 #include <sys/types.h>
 
-#include <cstring> // memset
+#include <cstddef> // offsetof
+#include <cstring> // memset, memcpy
 #include <string>
 #include <map>
 #include <vector>
@@ -21,6 +22,10 @@
 #include "defs.hpp"
 #include <Interfaces/cpp/LemInterface.hpp>
 #include "utils/memio.hpp"
+#include "utils/rank_bitmap.hpp"
+#include "utils/utf8_tokenizer.hpp"
+#include "hashes/hashes.hpp"
+#include "qclassify.hpp"
 
 namespace gogo 
 {
@@ -35,6 +40,21 @@ namespace QueryClassifierHelper {
   static inline std::string XMLtag2QCname(const std::string &tag) { 
     return tag.substr(sizeof("QueryClass_") - 1);
   }
+  
+  /// @brief scoped spin lock: for short and rare sections (replacement of shared data)
+  class SpinGuard {
+    volatile int &m_lock;
+    
+    SpinGuard(const SpinGuard &);
+    SpinGuard &operator = (const SpinGuard &);
+    
+    public:
+      explicit SpinGuard(volatile int &lock) : m_lock(lock) {
+        while (__sync_lock_test_and_set(&m_lock, 1))
+          ;
+      }
+      ~SpinGuard() { __sync_lock_release(&m_lock); }
+  };
 };
 
 namespace qcls_impl 
@@ -42,8 +62,9 @@ namespace qcls_impl
   typedef uint64_t phrase_hash_t;
   typedef uint32_t word_hash_t;
   
-  static const uint16_t QCLASSIFY_INDEX_VERSION = 10;
+  static const uint16_t QCLASSIFY_INDEX_VERSION = 22;
   
+  // word of phrase record: narrow (default) or wide index format
   struct word_entry {
     uint32_t id:22;
     int upcased:1;
@@ -51,29 +72,170 @@ namespace qcls_impl
     uint8_t form;
   } __PACKED;
   
+  struct word_entry_wide {
+    uint32_t id;
+    int upcased:1;
+    int found:1;
+    uint8_t form;
+  } __PACKED;
+  
+  static const uint32_t NARROW_WORD_ID_MAX = (1U << 22) - 1;
+  
+  template<class Tdst, class Tsrc>
+  static inline void __copy_word(Tdst &dst, const Tsrc &src) {
+    dst.id = src.id;
+    dst.upcased = src.upcased;
+    dst.found = src.found;
+    dst.form = src.form;
+  }
+  
+  // phrase index flags (saved first)
+  static const uint32_t INDEX_FL_WIDE = 0x1; // wide words, 64 bit offsets (see PhraseIndexer::setWideFormat)
+  static const uint32_t INDEX_FL_FORMS = 0x2; // word form to lemma table (see PhraseIndexer::setFormsTable)
+  static const uint32_t INDEX_FL_TRIE = 0x4;  // trie of normalized word sequences (see PhraseIndexer::setExactTrie)
+  static const unsigned INDEX_FL_BYPASS_SHIFT = 8; // LemmaCache::BYPASS_* rules (see PhraseIndexer::setLemmaBypass)
+  static const uint32_t INDEX_FL_BYPASS_MASK = 0xFF;
+  
   struct phrase_cls_info {
     uint32_t clsid:24;
     uint8_t  phrase_rank;
   } __PACKED;
     
   // runtime structs
+  // class list of phrase: the only class is stored inline (cls_inline set),
+  // otherwise reference is offset of interned phrase_classes_list
+  // (phrases share equal lists, see PhraseIndexerImpl::internClasses)
   struct phrase_record {
     uint8_t    n:5;
     uint8_t    is_regexp:1;
-    uint8_t    __reserved:2;
-    word_entry words[0];
+    uint8_t    cls_inline:1;
+    uint8_t    __reserved:1;
+    uint32_t   classes; // phrase_cls_info or class list offset
+    word_entry words[0]; // word_entry_wide in wide index
   } __PACKED;
   
+  template<class Tword>
+  static inline const Tword *__phrase_words(const phrase_record *pr) {
+    return reinterpret_cast<const Tword *>(pr->words);
+  }
+  
   struct phrase_classes_list {
     uint16_t n; // number of classes wich match phrase
     phrase_cls_info clse[0];
   } __PACKED;
   
-  /// @brief inlined jump from phrase header to it's class list record
-  static inline phrase_classes_list* __phrase_header_jump_to_classes(phrase_record *pr) {
-    return (phrase_classes_list*)((char *)pr + (sizeof(phrase_record) + sizeof(word_entry) * pr->n));
+  /// @brief single-word phrase stored inline (see dict_entry)
+  template<class Tword>
+  struct single_phrase_t {
+    uint32_t   phrase_id:31;
+    uint32_t   cls_inline:1;
+    uint32_t   clsmask; // bits (class ID % 32) of phrase classes
+    Tword      word;
+    uint32_t   classes; // the same as phrase_record::classes
+  } __PACKED;
+  
+  /// @brief word dictionary entry: word hash to word ID
+  struct dict_entry {
+    word_hash_t key;
+    uint32_t    value;   // word ID
+    uint32_t    singles; // offset of word single phrases ([uint8_t N][single_phrase x N]), ~0U - none
+    
+    bool operator < (const dict_entry &e) const { return (key < e.key); }
+  } __PACKED;
+  
+  /// @brief classes of phrase (view of inline class or interned list)
+  struct phrase_classes {
+    const phrase_cls_info *clse;
+    unsigned n;
+  };
+  
+  /// @brief resolve phrase class reference
+  /// @arg[in] lists - interned class lists region
+  /// @arg[in] pref - class reference of phrase record (unaligned)
+  static inline phrase_classes __phrase_classes(const char *lists, const char *pref, bool bInline) {
+    phrase_classes pc;
+    if (bInline) {
+      pc.clse = reinterpret_cast<const phrase_cls_info *>(pref);
+      pc.n = 1;
+    } else {
+      uint32_t off;
+      memcpy(&off, pref, sizeof(off));
+      const phrase_classes_list *pcl = reinterpret_cast<const phrase_classes_list *>(lists + off);
+      pc.clse = pcl->clse;
+      pc.n = pcl->n;
+    }
+    return pc;
   }
   
+  static inline phrase_classes __phrase_classes(const char *lists, const phrase_record *pr) {
+    return __phrase_classes(lists, reinterpret_cast<const char *>(pr) + offsetof(phrase_record, classes), 
+                            pr->cls_inline);
+  }
+  
+  template<class Tword>
+  static inline phrase_classes __phrase_classes(const char *lists, const single_phrase_t<Tword> *sp) {
+    return __phrase_classes(lists, reinterpret_cast<const char *>(sp) + offsetof(single_phrase_t<Tword>, classes), 
+                            sp->cls_inline);
+  }
+  
+  /// @brief posting entry: word (or word pair) key to phrase ID
+  // entries of the same key are ordered by phrase length, so searcher 
+  // stops walking posting before phrases longer than query;
+  // phrases of the same length are ordered by max rank (descending), 
+  // so ranked search skips the rest of them once they can't outrank result
+  // class bitmap rejects phrase of unwanted classes without touching phrase record
+  template<typename Tkey>
+  struct posting_entry {
+    Tkey     key;
+    uint32_t value;   // phrase ID
+    uint8_t  nwords;  // number of phrase words
+    uint8_t  maxrank; // max phrase rank among it's classes
+    uint32_t clsmask; // bits (class ID % 32) of phrase classes (see QCClassMask)
+    
+    bool operator < (const posting_entry &e) const { 
+      if (key != e.key)
+        return (key < e.key);
+      return (nwords < e.nwords || (nwords == e.nwords && maxrank > e.maxrank)); 
+    }
+  } __PACKED;
+  
+  /// @brief slot of exact word sequence table (open addressing)
+  struct exact_entry {
+    uint32_t fp;        // word sequence hash
+    uint32_t phrase_id; // ~0U - empty slot
+  } __PACKED;
+  
+  /// @brief hash of phrase word sequence: IDs, forms and capitalization
+  // (the same for narrow and wide words)
+  template<class Tword>
+  static inline uint32_t __word_sequence_hash(const Tword *pwe, unsigned n) {
+    uint32_t buf[64]; // n < 32 (see phrase_record)
+    for (unsigned i = 0; i < n; i++) {
+      buf[2 * i] = pwe[i].id;
+      buf[2 * i + 1] = (pwe[i].upcased & 0x1) | ((uint32_t)pwe[i].form << 8);
+    }
+    return MurmurHash32(buf, n * 2 * sizeof(uint32_t));
+  }
+  
+  /// @brief key of unordered word ID pair (hot keyword pair index)
+  static inline uint64_t __word_pair_key(uint32_t a, uint32_t b) {
+    return (a < b) ? (((uint64_t)a << 32) | b) : (((uint64_t)b << 32) | a);
+  }
+  
+  /// @brief phrase record of loaded index with words resolved back to hashes
+  // (re-indexing of class subset, see PhraseSearcher::exportPhrases)
+  struct indexed_phrase {
+    std::vector<word_hash_t>     hashes; // by word
+    std::vector<word_entry_wide> words;
+    std::vector<phrase_cls_info> classes;
+    bool        isRegexp;
+    uint8_t     reFlags; // compressed PCRE flags
+    std::string re;
+    const char *orig;    // NULL - original phrases aren't saved
+    const char *udata;   // NULL - no user data
+    std::string key;     // key of exact trie, empty - phrase isn't in trie
+  };
+  
   // phrases file header of size 64 bytes
   struct phrase_file_header {
     uint16_t version;
@@ -85,12 +247,28 @@ namespace qcls_impl
 }
 
 
+#define MAX_WORDS_SPLIT 8  // words of query (phrase) taken by splitter
+#define MAX_WORD_LENGTH 50 // longer words are skipped
+
 class PhraseSplitterBase 
 {
   LemInterface *m_plem;
+  LemmaCache   *m_pcache;
+  LemmaCache::stat m_lemstat;
+  bool m_bLazyLemma;
+  bool m_bKeepNorms;
+  unsigned m_bypass;
+  std::string m_utf8buf, m_word, m_fform; // buffers reused between calls
+  std::vector<std::string> m_norms;       // normalized words (lazy lemmatization, setKeepNormalized)
+  
+  uint32_t lemmaHash(uint32_t form, const std::string &norm);
+  
   protected:
     void addWord(const char *w, int len);
     void addWord(const UnicodeString &us);
+    void addWord(int len, uint32_t form, const std::string &norm, bool upcase);
+    /// @brief normalized word is needed by lemmatizer (see addWord)
+    bool needsNormalized() const { return m_plem != NULL || m_bKeepNorms; }
     virtual void splitPhrase(const std::string &phrase) = 0;
     
   public:
@@ -105,6 +283,24 @@ class PhraseSplitterBase
   public:
     PhraseSplitterBase(LemInterface *plem = NULL);
     void setLemmatizer(LemInterface *plem);
+    /// @brief set shared lemma cache (NULL - none)
+    void setLemmaCache(LemmaCache *pcache) { m_pcache = pcache; }
+    /// @brief get (and reset) lemma cache counters
+    void getLemmaStat(LemmaCache::stat *st);
+    /// @brief don't lemmatize words matching LemmaCache::BYPASS_* rules
+    void setLemmaBypass(unsigned bypass) { m_bypass = bypass; }
+    unsigned getLemmaBypass() const { return m_bypass; }
+    bool hasLemmatizer() const { return m_plem != NULL; }
+    /// @brief don't lemmatize words while splitting: word hash is hash of it's form
+    /// until lemmatize() is called
+    void setLazyLemma(bool bLazy) { m_bLazyLemma = bLazy; }
+    /// @brief lemmatize word @arg i of lazy split (see setLazyLemma)
+    /// @return hash of first form
+    uint32_t lemmatize(unsigned i);
+    /// @brief keep normalized words of split (see normalized)
+    void setKeepNormalized(bool bKeep) { m_bKeepNorms = bKeep; }
+    /// @return normalized word @arg i of split (lazy split or setKeepNormalized)
+    const std::string &normalized(unsigned i) const { return m_norms[i]; }
     unsigned split(const std::string &s);
     virtual ~PhraseSplitterBase() {}
 };
@@ -113,8 +309,17 @@ class PhraseSplitterBase
 // Splitting of plain text
 //
 class PhraseSplitterPlain : public PhraseSplitterBase {
+  Utf8Tokenizer m_tokenizer;
+  SingleByteTokenizer m_sbTokenizer;
+  MurmurHash32Stream m_hash;
+  std::string m_norm;
+  
+  void splitText(const char *s, size_t len, codepage_t cp);
   public:
     virtual void splitPhrase(const std::string &phrase);
+    /// @brief split text of code page @arg cp: words are the same as of text in UTF-8
+    unsigned split(const char *s, size_t len, codepage_t cp);
+    using PhraseSplitterBase::split;
     virtual ~PhraseSplitterPlain() {}
 };
 
@@ -152,6 +357,9 @@ class PhraseRegExpWriter : public QSerializerOut {
   };
   std::map<unsigned, phrase_regexp_t> m_regs; // phrase ID to regs
   size_t m_reSize;
+  mutable RankBitmapWriter m_presence; // phrase IDs
+  
+  void prepareExport() const;
   
   public:
     PhraseRegExpWriter();
@@ -166,13 +374,18 @@ class PhraseRegExpWriter : public QSerializerOut {
 };
 
 class PhraseRegExReader : public QSerializerIn {
-  std::map<unsigned, pcre *> m_regs;
+  RankBitmapReader m_presence;       // phrase IDs
+  std::vector<pcre *> m_regs;        // by slot of phrase ID (NULL - failed to compile)
+  std::vector<const char *> m_sources; // saved {flags, RE} by slot of phrase ID
+  unsigned m_ncompiled;
   public:
+    PhraseRegExReader() : m_ncompiled(0) {}
     // import facility
     virtual void load(MemReader &mrd);
     int match(unsigned phraseID, const std::string &s) const;
+    bool getSource(unsigned phraseID, std::string &re, uint8_t &flags) const;
     virtual ~PhraseRegExReader();
-    unsigned amount() const { return m_regs.size(); };
+    unsigned amount() const { return m_ncompiled; };
 };
 
 ///////////////////////////////////////////////////////////////////////////////
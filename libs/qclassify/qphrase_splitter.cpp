@@ -5,6 +5,7 @@
 /// @date   05.05.2009
 //------------------------------------------------------------
 
+#include <cstring>
 #include <string>
 #include <iostream>
 
@@ -14,14 +15,13 @@
 #include "qclassify_impl.hpp"
 
 
-#define MAX_WORDS_SPLIT 8
-#define MAX_WORD_LENGTH 50
-
 namespace gogo 
 {
   
-PhraseSplitterBase::PhraseSplitterBase(LemInterface *plem /* = NULL */)
+PhraseSplitterBase::PhraseSplitterBase(LemInterface *plem /* = NULL */) : 
+  m_pcache(NULL), m_bLazyLemma(false), m_bKeepNorms(false), m_bypass(0)
 {
+  memset(&m_lemstat, 0, sizeof(m_lemstat));
   setLemmatizer(plem);
 }
 
@@ -36,31 +36,86 @@ unsigned PhraseSplitterBase::split(const std::string &s)
 /// @brief without this interface, words will not be transformed to their base forms
 void PhraseSplitterBase::setLemmatizer(LemInterface *plem) { m_plem = plem; }
 
+void PhraseSplitterBase::getLemmaStat(LemmaCache::stat *st) 
+{
+  *st = m_lemstat;
+  memset(&m_lemstat, 0, sizeof(m_lemstat));
+}
+
 void PhraseSplitterBase::addWord(const UnicodeString &s)
 {
-    std::string utf8_buf;
-    UnicodeString2UTF8(s, &utf8_buf);
-    addWord(utf8_buf.c_str(), utf8_buf.length());
+    UnicodeString2UTF8(s, &m_utf8buf);
+    addWord(m_utf8buf.c_str(), m_utf8buf.length());
 }
   
 void PhraseSplitterBase::addWord(const char *w, int len)
 {
   if (vWords.size() < MAX_WORDS_SPLIT && len <= MAX_WORD_LENGTH) 
   {
-    std::string s(w, len), fform;
+    m_word.assign(w, len);
+    strNormalize(m_word);
+    addWord(len, MurmurHash32A(m_word.data(), m_word.length()), m_word, utf8_isupper(w));
+  }
+}
+
+/// @brief add word normalized and hashed already (see strNormalize, MurmurHash32A)
+/// @arg[in] len - length of source word
+/// @arg[in] form - hash of normalized word
+/// @arg[in] norm - normalized word, used if lemmatizer is set or words are kept (see needsNormalized)
+void PhraseSplitterBase::addWord(int len, uint32_t form, const std::string &norm, bool upcase)
+{
+  if (vWords.size() < MAX_WORDS_SPLIT && len <= MAX_WORD_LENGTH) 
+  {
     word_info wi;
     
-    wi.upcase = utf8_isupper(w);
-    strNormalize(s);
-    MurmurHash(s, &wi.form);
+    wi.upcase = upcase;
+    wi.form = form;
+    wi.hash = form;
+    if (m_bKeepNorms || (m_plem && m_bLazyLemma)) {
+      if (m_norms.size() <= vWords.size())
+        m_norms.resize(vWords.size() + 1);
+      m_norms[vWords.size()].assign(norm);
+    }
+    if (m_plem && !m_bLazyLemma)
+      wi.hash = lemmaHash(form, norm);
     
-    if (m_plem && m_plem->FirstForm(s, &fform))
-        MurmurHash(fform, &wi.hash);
-    else
-        MurmurHash(s, &wi.hash);
-     
     vWords.push_back(wi);
   }
 }
 
+uint32_t PhraseSplitterBase::lemmatize(unsigned i)
+{
+  word_info &wi = vWords[i];
+  if (m_plem && m_bLazyLemma)
+    wi.hash = lemmaHash(wi.form, m_norms[i]);
+  return wi.hash;
+}
+
+/// @brief hash of first form of word (by lemma cache if any)
+/// @arg[in] form - hash of normalized word
+/// @arg[in] norm - normalized word
+uint32_t PhraseSplitterBase::lemmaHash(uint32_t form, const std::string &norm)
+{
+  uint32_t lemma = form; // the word is it's first form
+  
+  if (m_bypass && LemmaCache::isBypassed(norm, m_bypass)) {
+    m_lemstat.bypassed++;
+    return form;
+  }
+  if (m_pcache && m_pcache->lookup(form, lemma)) {
+    m_lemstat.hits++;
+    return lemma;
+  }
+  
+  if (m_plem->FirstForm(norm, &m_fform) && m_fform != norm)
+    lemma = MurmurHash32A(m_fform.data(), m_fform.length());
+  
+  if (m_pcache) {
+    m_lemstat.misses++;
+    if (m_pcache->insert(form, lemma))
+      m_lemstat.evictions++;
+  }
+  return lemma;
+}
+
 }
@@ -15,28 +15,38 @@ using namespace std;
 namespace gogo 
 {
 
+/// @brief split phrase to words: runs of letters and digits
 void PhraseSplitterPlain::splitPhrase(const string &phrase)
 {
-    const char *s = phrase.c_str();
-    int32_t length = phrase.length();
-
-    UnicodeString ustring;
-    for (int32_t i = 0; i < length;)
-    {
-        UChar32 c;
-        U8_NEXT(s, i, length, c);
-
-        if (u_isalnum(c)) {
-            ustring += c;
-        }
-        else if (!ustring.isEmpty()) {
-            addWord(ustring);
-            ustring.truncate(0);
-        }
-    }
+    splitText(phrase.c_str(), phrase.length(), CODEPAGE_UTF8);
+}
 
-    if (!ustring.isEmpty())
-        addWord(ustring);
+unsigned PhraseSplitterPlain::split(const char *s, size_t len, codepage_t cp)
+{
+    vWords.clear();
+    splitText(s, len, cp);
+    return vWords.size();
+}
+
+void PhraseSplitterPlain::splitText(const char *s, size_t len, codepage_t cp)
+{
+    Utf8Tokenizer::word w;
+
+    // word is normalized and hashed in one pass, the string is for lemmatizer only
+    std::string *pnorm = needsNormalized() ? &m_norm : NULL;
+    if (cp == CODEPAGE_UTF8) {
+      m_tokenizer.reset(s, len);
+      while (m_tokenizer.next(w, m_hash, pnorm))
+          addWord(w.len, m_hash.end(), m_norm, w.upcase);
+      return;
+    }
+    
+    // single-byte text: words are hashed as UTF-8 ones and limited by UTF-8 length
+    if (m_sbTokenizer.codepage() != cp)
+      m_sbTokenizer = SingleByteTokenizer(cp);
+    m_sbTokenizer.reset(s, len);
+    while (m_sbTokenizer.next(w, m_hash, pnorm))
+        addWord(m_sbTokenizer.utf8Length(w), m_hash.end(), m_norm, w.upcase);
 }
 
 } // namespace gogo
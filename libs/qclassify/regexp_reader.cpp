@@ -6,7 +6,7 @@
 //------------------------------------------------------------
 #include <string>
 #include <iostream>
-#include <map>
+#include <vector>
 
 #include "defs.hpp"
 #include "qclassify_impl.hpp"
@@ -17,46 +17,65 @@ namespace gogo
 
 PhraseRegExReader::~PhraseRegExReader()
 {
-  std::map<unsigned, pcre *>::iterator it;
-  
-  for (it = m_regs.begin(); it != m_regs.end(); it++) {
-    pcre_free(it->second);
+  for (unsigned i = 0; i < m_regs.size(); i++) {
+    if (m_regs[i])
+      pcre_free(m_regs[i]);
   }
 }
   
 void PhraseRegExReader::load(MemReader &mrd)
 {
-  uint32_t n;
   const char *pcre_err;
   int   erroffset;
   
-  mrd >> n;
-  while(n--) {
+  for (unsigned i = 0; i < m_regs.size(); i++) {
+    if (m_regs[i])
+      pcre_free(m_regs[i]);
+  }
+  
+  m_presence.load(mrd);
+  m_regs.assign(m_presence.count(), NULL);
+  m_sources.resize(m_presence.count());
+  m_ncompiled = 0;
+  for (unsigned i = 0; i < m_presence.count(); i++) {
     uint8_t  flags;
-    uint32_t id;
     std::string   re;
     
-    mrd >> id >> flags >> re;
-    pcre *reg = pcre_compile(re.c_str(), PCRE_UTF8 | PhraseRegExp::decompressPCRE_flags(flags), 
+    m_sources[i] = mrd.get();
+    mrd >> flags >> re;
+    m_regs[i] = pcre_compile(re.c_str(), PCRE_UTF8 | PhraseRegExp::decompressPCRE_flags(flags), 
                              &pcre_err, &erroffset, NULL);
-    if (!reg) {
+    if (!m_regs[i]) {
       std::cerr << "Failed to compile saved RE: " << pcre_err << std::endl;
     }
-    else {
-      m_regs.insert(std::make_pair<unsigned, pcre *>(id, reg));
-    }
+    else
+      m_ncompiled++;
   }
 }
 
+/// @brief get saved RE of phrase (phraseID)
+/// @arg[out] re - regular expression
+/// @arg[out] flags - compressed PCRE flags
+/// @return false if phrase has no RE
+bool PhraseRegExReader::getSource(unsigned phraseID, std::string &re, uint8_t &flags) const
+{
+  unsigned slot;
+  if (!m_presence.rank(phraseID, slot))
+    return false;
+  
+  MemReader mrd(m_sources[slot]);
+  mrd >> flags >> re;
+  return true;
+}
+
 /// @brief match string (s) against compiled RE of phrase (phraseID)
 /// @return -1 if phraseID regexp not exist, 0 - not matched; 1 - OK.
 int PhraseRegExReader::match(unsigned phraseID, const std::string &s) const
 {
-  std::map<unsigned, pcre *>::const_iterator it;
+  unsigned slot;
   
-  it = m_regs.find(phraseID);
-  if (it != m_regs.end()) {
-    return (pcre_exec (it->second, NULL, (char *) s.c_str(), s.length(), 0, 0, NULL, 0) == -1) ? 0 : 1;
+  if (m_presence.rank(phraseID, slot) && m_regs[slot]) {
+    return (pcre_exec (m_regs[slot], NULL, (char *) s.c_str(), s.length(), 0, 0, NULL, 0) == -1) ? 0 : 1;
   }
   return (-1);
 }
@@ -43,20 +43,33 @@ void PhraseRegExpWriter::optimize(const vector<unsigned> &vshift)
   m_regs = regsNew;
 }
 
+/// @brief build bitmap of phrase IDs
+void PhraseRegExpWriter::prepareExport() const
+{
+  map<unsigned, phrase_regexp_t>::const_iterator it;
+  
+  m_presence.clear();
+  for (it = m_regs.begin(); it != m_regs.end(); it++)
+    m_presence.set(it->first);
+}
+
 // format:
-// [# of RE:4][[ID][FLAG:1,REGULAR EXPRESSIONS(zero-end)]:Nx4]
+// [PHRASE_ID_BITMAP][[FLAG:1,REGULAR EXPRESSIONS(zero-end)] x N]
+// RE records are ordered by phrase ID
 size_t PhraseRegExpWriter::size() const {
-  return sizeof(uint32_t) + (m_regs.size() * (sizeof(uint32_t) + 1)) + m_reSize;
+  prepareExport();
+  return m_presence.size() + m_regs.size() + m_reSize;
 }
 
 void PhraseRegExpWriter::save(MemWriter &mwr)
 {
   map<unsigned, phrase_regexp_t>::const_iterator it;
   
-  mwr << (uint32_t)m_regs.size();
+  prepareExport();
+  m_presence.save(mwr);
   for (it = m_regs.begin(); it != m_regs.end(); it++) {
     const phrase_regexp_t &re_rec = it->second;
-    mwr << (uint32_t)it->first << re_rec.flags << re_rec.re;
+    mwr << re_rec.flags << re_rec.re;
   }
 }
 
@@ -6,7 +6,7 @@
 //------------------------------------------------------------
 
 #include <map>
-#include "utils/hash_array.hpp"
+#include "utils/rank_bitmap.hpp"
 #include "qclassify.hpp"
 
 namespace gogo
@@ -34,37 +34,47 @@ void QCScatteredStringsWriter::optimize(const std::vector<unsigned> &vshift)
 }
 
 /// @brief prepare export creating offset hash_array
+// user data is mostly a few templates, so equal strings share offset
 void QCScatteredStringsWriter::prepareExport() const
 {
   if (m_bDirty) {
-    m_id2offset.init(m_stings.size());
+    std::map<std::string, uint32_t> offsets;
     std::map<uint32_t, std::string>::const_iterator it;
-
+    
+    m_presence.clear();
+    m_offsets.clear();
+    m_unique.clear();
     m_acclen = 0;
     for (it = m_stings.begin(); it != m_stings.end(); it++) {
-      m_id2offset.add(it->first, m_acclen);
-      m_acclen += it->second.length() + 1;
+      std::pair<std::map<std::string, uint32_t>::iterator, bool> ins = 
+          offsets.insert(std::make_pair(it->second, (uint32_t)m_acclen));
+      if (ins.second) {
+        m_unique.push_back(&it->second);
+        m_acclen += it->second.length() + 1;
+      }
+      m_presence.set(it->first);
+      m_offsets.push_back(ins.first->second);
     }
     
     m_bDirty = false;
   }
 }
 
-// format: [OFFSET_MAP][STR_SIZE:4][STRINGS:m_acclen]
+// format: [ID_BITMAP][OFFSETS][STR_SIZE:8][STRINGS:m_acclen]
 size_t QCScatteredStringsWriter::size() const {
   prepareExport();
-  return m_id2offset.size() + sizeof(uint32_t) + m_acclen;
+  return m_presence.size() + m_offsets.size() + sizeof(uint64_t) + m_acclen;
 }
 
 void QCScatteredStringsWriter::save(MemWriter &mwr) 
 {
   prepareExport();
-  m_id2offset.save(mwr);
-  mwr << (uint32_t)m_acclen;
+  m_presence.save(mwr);
+  m_offsets.save(mwr);
+  mwr << (uint64_t)m_acclen;
   
-  std::map<uint32_t, std::string>::const_iterator it;
-  for (it = m_stings.begin(); it != m_stings.end(); it++)
-    mwr << it->second;
+  for (unsigned i = 0; i < m_unique.size(); i++)
+    mwr << *m_unique[i];
 }
 
 //////////////////////////////////////////////////////////////
@@ -73,21 +83,22 @@ void QCScatteredStringsWriter::save(MemWriter &mwr)
 
 void QCScatteredStringsReader::load(MemReader &mrd) 
 {
-  uint32_t sz;
+  uint64_t sz;
   
-  m_id2offset.load(mrd);
+  m_presence.load(mrd);
+  m_offsets.load(mrd);
   mrd >> sz;
-  m_pBase = mrd.get();
+  m_offsets.setBase(mrd.get());
   mrd.advance(sz);
 }
 
 const char *QCScatteredStringsReader::get(unsigned id) const throw()
 {
-  uint32_t offset;
-  if (!m_id2offset.search(id, offset))
+  unsigned slot;
+  if (!m_presence.rank(id, slot))
     return NULL;
   
-  return m_pBase + offset;
+  return m_offsets[slot];
 }
 
 } // namespace gogo
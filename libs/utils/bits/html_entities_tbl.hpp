@@ -0,0 +1,1054 @@
+//--------------------------------------------------------------------------------------------------
+/// @file  html_entities_tbl.hpp
+/// @brief HTML5 named character references and their perfect hash
+//--------------------------------------------------------------------------------------------------
+
+#ifndef HTML_ENTITIES_TBL_HPP__
+#define HTML_ENTITIES_TBL_HPP__
+
+// generated from the WHATWG list of named character references (the ones ended by ';')
+//
+// HTML_ENTITIES       - {name without '&' and ';', code point, second code point or 0} ordered by name
+// HTML_ENTITY_SEEDS   - seed of bucket: bucket is FNV-1a hash of name % HTML_ENTITY_BUCKETS
+// HTML_ENTITY_SLOTS   - entity index of slot (-1 - free): slot is html_entity_slot(hash, seed)
+
+static const unsigned HTML_ENTITY_NAME_MAX = 31;
+static const unsigned HTML_ENTITY_BUCKETS  = 1024;
+static const unsigned HTML_ENTITY_SLOT_BITS = 12;
+
+struct html_entity {
+  const char *name;
+  uint32_t   c1;
+  uint32_t   c2;
+};
+
+static inline uint32_t html_entity_hash(const char *s, size_t len)
+{
+  uint32_t h = 2166136261U;
+  for (size_t i = 0; i < len; i++)
+    h = (h ^ (unsigned char)s[i]) * 16777619U;
+  return h;
+}
+
+static inline uint32_t html_entity_slot(uint32_t hash, uint32_t seed)
+{
+  return ((hash ^ (seed * 0x9E3779B1U)) * 0x85EBCA6BU) >> (32 - HTML_ENTITY_SLOT_BITS);
+}
+
+static const html_entity HTML_ENTITIES[2125] = 
+{
+  {"AElig", 0x00C6, 0x0000}, {"AMP", 0x0026, 0x0000}, {"Aacute", 0x00C1, 0x0000},
+  {"Abreve", 0x0102, 0x0000}, {"Acirc", 0x00C2, 0x0000}, {"Acy", 0x0410, 0x0000},
+  {"Afr", 0x1D504, 0x0000}, {"Agrave", 0x00C0, 0x0000}, {"Alpha", 0x0391, 0x0000},
+  {"Amacr", 0x0100, 0x0000}, {"And", 0x2A53, 0x0000}, {"Aogon", 0x0104, 0x0000},
+  {"Aopf", 0x1D538, 0x0000}, {"ApplyFunction", 0x2061, 0x0000}, {"Aring", 0x00C5, 0x0000},
+  {"Ascr", 0x1D49C, 0x0000}, {"Assign", 0x2254, 0x0000}, {"Atilde", 0x00C3, 0x0000},
+  {"Auml", 0x00C4, 0x0000}, {"Backslash", 0x2216, 0x0000}, {"Barv", 0x2AE7, 0x0000},
+  {"Barwed", 0x2306, 0x0000}, {"Bcy", 0x0411, 0x0000}, {"Because", 0x2235, 0x0000},
+  {"Bernoullis", 0x212C, 0x0000}, {"Beta", 0x0392, 0x0000}, {"Bfr", 0x1D505, 0x0000},
+  {"Bopf", 0x1D539, 0x0000}, {"Breve", 0x02D8, 0x0000}, {"Bscr", 0x212C, 0x0000},
+  {"Bumpeq", 0x224E, 0x0000}, {"CHcy", 0x0427, 0x0000}, {"COPY", 0x00A9, 0x0000},
+  {"Cacute", 0x0106, 0x0000}, {"Cap", 0x22D2, 0x0000}, {"CapitalDifferentialD", 0x2145, 0x0000},
+  {"Cayleys", 0x212D, 0x0000}, {"Ccaron", 0x010C, 0x0000}, {"Ccedil", 0x00C7, 0x0000},
+  {"Ccirc", 0x0108, 0x0000}, {"Cconint", 0x2230, 0x0000}, {"Cdot", 0x010A, 0x0000},
+  {"Cedilla", 0x00B8, 0x0000}, {"CenterDot", 0x00B7, 0x0000}, {"Cfr", 0x212D, 0x0000},
+  {"Chi", 0x03A7, 0x0000}, {"CircleDot", 0x2299, 0x0000}, {"CircleMinus", 0x2296, 0x0000},
+  {"CirclePlus", 0x2295, 0x0000}, {"CircleTimes", 0x2297, 0x0000},
+  {"ClockwiseContourIntegral", 0x2232, 0x0000}, {"CloseCurlyDoubleQuote", 0x201D, 0x0000},
+  {"CloseCurlyQuote", 0x2019, 0x0000}, {"Colon", 0x2237, 0x0000}, {"Colone", 0x2A74, 0x0000},
+  {"Congruent", 0x2261, 0x0000}, {"Conint", 0x222F, 0x0000}, {"ContourIntegral", 0x222E, 0x0000},
+  {"Copf", 0x2102, 0x0000}, {"Coproduct", 0x2210, 0x0000},
+  {"CounterClockwiseContourIntegral", 0x2233, 0x0000}, {"Cross", 0x2A2F, 0x0000},
+  {"Cscr", 0x1D49E, 0x0000}, {"Cup", 0x22D3, 0x0000}, {"CupCap", 0x224D, 0x0000},
+  {"DD", 0x2145, 0x0000}, {"DDotrahd", 0x2911, 0x0000}, {"DJcy", 0x0402, 0x0000},
+  {"DScy", 0x0405, 0x0000}, {"DZcy", 0x040F, 0x0000}, {"Dagger", 0x2021, 0x0000},
+  {"Darr", 0x21A1, 0x0000}, {"Dashv", 0x2AE4, 0x0000}, {"Dcaron", 0x010E, 0x0000},
+  {"Dcy", 0x0414, 0x0000}, {"Del", 0x2207, 0x0000}, {"Delta", 0x0394, 0x0000},
+  {"Dfr", 0x1D507, 0x0000}, {"DiacriticalAcute", 0x00B4, 0x0000},
+  {"DiacriticalDot", 0x02D9, 0x0000}, {"DiacriticalDoubleAcute", 0x02DD, 0x0000},
+  {"DiacriticalGrave", 0x0060, 0x0000}, {"DiacriticalTilde", 0x02DC, 0x0000},
+  {"Diamond", 0x22C4, 0x0000}, {"DifferentialD", 0x2146, 0x0000}, {"Dopf", 0x1D53B, 0x0000},
+  {"Dot", 0x00A8, 0x0000}, {"DotDot", 0x20DC, 0x0000}, {"DotEqual", 0x2250, 0x0000},
+  {"DoubleContourIntegral", 0x222F, 0x0000}, {"DoubleDot", 0x00A8, 0x0000},
+  {"DoubleDownArrow", 0x21D3, 0x0000}, {"DoubleLeftArrow", 0x21D0, 0x0000},
+  {"DoubleLeftRightArrow", 0x21D4, 0x0000}, {"DoubleLeftTee", 0x2AE4, 0x0000},
+  {"DoubleLongLeftArrow", 0x27F8, 0x0000}, {"DoubleLongLeftRightArrow", 0x27FA, 0x0000},
+  {"DoubleLongRightArrow", 0x27F9, 0x0000}, {"DoubleRightArrow", 0x21D2, 0x0000},
+  {"DoubleRightTee", 0x22A8, 0x0000}, {"DoubleUpArrow", 0x21D1, 0x0000},
+  {"DoubleUpDownArrow", 0x21D5, 0x0000}, {"DoubleVerticalBar", 0x2225, 0x0000},
+  {"DownArrow", 0x2193, 0x0000}, {"DownArrowBar", 0x2913, 0x0000},
+  {"DownArrowUpArrow", 0x21F5, 0x0000}, {"DownBreve", 0x0311, 0x0000},
+  {"DownLeftRightVector", 0x2950, 0x0000}, {"DownLeftTeeVector", 0x295E, 0x0000},
+  {"DownLeftVector", 0x21BD, 0x0000}, {"DownLeftVectorBar", 0x2956, 0x0000},
+  {"DownRightTeeVector", 0x295F, 0x0000}, {"DownRightVector", 0x21C1, 0x0000},
+  {"DownRightVectorBar", 0x2957, 0x0000}, {"DownTee", 0x22A4, 0x0000},
+  {"DownTeeArrow", 0x21A7, 0x0000}, {"Downarrow", 0x21D3, 0x0000}, {"Dscr", 0x1D49F, 0x0000},
+  {"Dstrok", 0x0110, 0x0000}, {"ENG", 0x014A, 0x0000}, {"ETH", 0x00D0, 0x0000},
+  {"Eacute", 0x00C9, 0x0000}, {"Ecaron", 0x011A, 0x0000}, {"Ecirc", 0x00CA, 0x0000},
+  {"Ecy", 0x042D, 0x0000}, {"Edot", 0x0116, 0x0000}, {"Efr", 0x1D508, 0x0000},
+  {"Egrave", 0x00C8, 0x0000}, {"Element", 0x2208, 0x0000}, {"Emacr", 0x0112, 0x0000},
+  {"EmptySmallSquare", 0x25FB, 0x0000}, {"EmptyVerySmallSquare", 0x25AB, 0x0000},
+  {"Eogon", 0x0118, 0x0000}, {"Eopf", 0x1D53C, 0x0000}, {"Epsilon", 0x0395, 0x0000},
+  {"Equal", 0x2A75, 0x0000}, {"EqualTilde", 0x2242, 0x0000}, {"Equilibrium", 0x21CC, 0x0000},
+  {"Escr", 0x2130, 0x0000}, {"Esim", 0x2A73, 0x0000}, {"Eta", 0x0397, 0x0000},
+  {"Euml", 0x00CB, 0x0000}, {"Exists", 0x2203, 0x0000}, {"ExponentialE", 0x2147, 0x0000},
+  {"Fcy", 0x0424, 0x0000}, {"Ffr", 0x1D509, 0x0000}, {"FilledSmallSquare", 0x25FC, 0x0000},
+  {"FilledVerySmallSquare", 0x25AA, 0x0000}, {"Fopf", 0x1D53D, 0x0000}, {"ForAll", 0x2200, 0x0000},
+  {"Fouriertrf", 0x2131, 0x0000}, {"Fscr", 0x2131, 0x0000}, {"GJcy", 0x0403, 0x0000},
+  {"GT", 0x003E, 0x0000}, {"Gamma", 0x0393, 0x0000}, {"Gammad", 0x03DC, 0x0000},
+  {"Gbreve", 0x011E, 0x0000}, {"Gcedil", 0x0122, 0x0000}, {"Gcirc", 0x011C, 0x0000},
+  {"Gcy", 0x0413, 0x0000}, {"Gdot", 0x0120, 0x0000}, {"Gfr", 0x1D50A, 0x0000},
+  {"Gg", 0x22D9, 0x0000}, {"Gopf", 0x1D53E, 0x0000}, {"GreaterEqual", 0x2265, 0x0000},
+  {"GreaterEqualLess", 0x22DB, 0x0000}, {"GreaterFullEqual", 0x2267, 0x0000},
+  {"GreaterGreater", 0x2AA2, 0x0000}, {"GreaterLess", 0x2277, 0x0000},
+  {"GreaterSlantEqual", 0x2A7E, 0x0000}, {"GreaterTilde", 0x2273, 0x0000},
+  {"Gscr", 0x1D4A2, 0x0000}, {"Gt", 0x226B, 0x0000}, {"HARDcy", 0x042A, 0x0000},
+  {"Hacek", 0x02C7, 0x0000}, {"Hat", 0x005E, 0x0000}, {"Hcirc", 0x0124, 0x0000},
+  {"Hfr", 0x210C, 0x0000}, {"HilbertSpace", 0x210B, 0x0000}, {"Hopf", 0x210D, 0x0000},
+  {"HorizontalLine", 0x2500, 0x0000}, {"Hscr", 0x210B, 0x0000}, {"Hstrok", 0x0126, 0x0000},
+  {"HumpDownHump", 0x224E, 0x0000}, {"HumpEqual", 0x224F, 0x0000}, {"IEcy", 0x0415, 0x0000},
+  {"IJlig", 0x0132, 0x0000}, {"IOcy", 0x0401, 0x0000}, {"Iacute", 0x00CD, 0x0000},
+  {"Icirc", 0x00CE, 0x0000}, {"Icy", 0x0418, 0x0000}, {"Idot", 0x0130, 0x0000},
+  {"Ifr", 0x2111, 0x0000}, {"Igrave", 0x00CC, 0x0000}, {"Im", 0x2111, 0x0000},
+  {"Imacr", 0x012A, 0x0000}, {"ImaginaryI", 0x2148, 0x0000}, {"Implies", 0x21D2, 0x0000},
+  {"Int", 0x222C, 0x0000}, {"Integral", 0x222B, 0x0000}, {"Intersection", 0x22C2, 0x0000},
+  {"InvisibleComma", 0x2063, 0x0000}, {"InvisibleTimes", 0x2062, 0x0000},
+  {"Iogon", 0x012E, 0x0000}, {"Iopf", 0x1D540, 0x0000}, {"Iota", 0x0399, 0x0000},
+  {"Iscr", 0x2110, 0x0000}, {"Itilde", 0x0128, 0x0000}, {"Iukcy", 0x0406, 0x0000},
+  {"Iuml", 0x00CF, 0x0000}, {"Jcirc", 0x0134, 0x0000}, {"Jcy", 0x0419, 0x0000},
+  {"Jfr", 0x1D50D, 0x0000}, {"Jopf", 0x1D541, 0x0000}, {"Jscr", 0x1D4A5, 0x0000},
+  {"Jsercy", 0x0408, 0x0000}, {"Jukcy", 0x0404, 0x0000}, {"KHcy", 0x0425, 0x0000},
+  {"KJcy", 0x040C, 0x0000}, {"Kappa", 0x039A, 0x0000}, {"Kcedil", 0x0136, 0x0000},
+  {"Kcy", 0x041A, 0x0000}, {"Kfr", 0x1D50E, 0x0000}, {"Kopf", 0x1D542, 0x0000},
+  {"Kscr", 0x1D4A6, 0x0000}, {"LJcy", 0x0409, 0x0000}, {"LT", 0x003C, 0x0000},
+  {"Lacute", 0x0139, 0x0000}, {"Lambda", 0x039B, 0x0000}, {"Lang", 0x27EA, 0x0000},
+  {"Laplacetrf", 0x2112, 0x0000}, {"Larr", 0x219E, 0x0000}, {"Lcaron", 0x013D, 0x0000},
+  {"Lcedil", 0x013B, 0x0000}, {"Lcy", 0x041B, 0x0000}, {"LeftAngleBracket", 0x27E8, 0x0000},
+  {"LeftArrow", 0x2190, 0x0000}, {"LeftArrowBar", 0x21E4, 0x0000},
+  {"LeftArrowRightArrow", 0x21C6, 0x0000}, {"LeftCeiling", 0x2308, 0x0000},
+  {"LeftDoubleBracket", 0x27E6, 0x0000}, {"LeftDownTeeVector", 0x2961, 0x0000},
+  {"LeftDownVector", 0x21C3, 0x0000}, {"LeftDownVectorBar", 0x2959, 0x0000},
+  {"LeftFloor", 0x230A, 0x0000}, {"LeftRightArrow", 0x2194, 0x0000},
+  {"LeftRightVector", 0x294E, 0x0000}, {"LeftTee", 0x22A3, 0x0000},
+  {"LeftTeeArrow", 0x21A4, 0x0000}, {"LeftTeeVector", 0x295A, 0x0000},
+  {"LeftTriangle", 0x22B2, 0x0000}, {"LeftTriangleBar", 0x29CF, 0x0000},
+  {"LeftTriangleEqual", 0x22B4, 0x0000}, {"LeftUpDownVector", 0x2951, 0x0000},
+  {"LeftUpTeeVector", 0x2960, 0x0000}, {"LeftUpVector", 0x21BF, 0x0000},
+  {"LeftUpVectorBar", 0x2958, 0x0000}, {"LeftVector", 0x21BC, 0x0000},
+  {"LeftVectorBar", 0x2952, 0x0000}, {"Leftarrow", 0x21D0, 0x0000},
+  {"Leftrightarrow", 0x21D4, 0x0000}, {"LessEqualGreater", 0x22DA, 0x0000},
+  {"LessFullEqual", 0x2266, 0x0000}, {"LessGreater", 0x2276, 0x0000}, {"LessLess", 0x2AA1, 0x0000},
+  {"LessSlantEqual", 0x2A7D, 0x0000}, {"LessTilde", 0x2272, 0x0000}, {"Lfr", 0x1D50F, 0x0000},
+  {"Ll", 0x22D8, 0x0000}, {"Lleftarrow", 0x21DA, 0x0000}, {"Lmidot", 0x013F, 0x0000},
+  {"LongLeftArrow", 0x27F5, 0x0000}, {"LongLeftRightArrow", 0x27F7, 0x0000},
+  {"LongRightArrow", 0x27F6, 0x0000}, {"Longleftarrow", 0x27F8, 0x0000},
+  {"Longleftrightarrow", 0x27FA, 0x0000}, {"Longrightarrow", 0x27F9, 0x0000},
+  {"Lopf", 0x1D543, 0x0000}, {"LowerLeftArrow", 0x2199, 0x0000},
+  {"LowerRightArrow", 0x2198, 0x0000}, {"Lscr", 0x2112, 0x0000}, {"Lsh", 0x21B0, 0x0000},
+  {"Lstrok", 0x0141, 0x0000}, {"Lt", 0x226A, 0x0000}, {"Map", 0x2905, 0x0000},
+  {"Mcy", 0x041C, 0x0000}, {"MediumSpace", 0x205F, 0x0000}, {"Mellintrf", 0x2133, 0x0000},
+  {"Mfr", 0x1D510, 0x0000}, {"MinusPlus", 0x2213, 0x0000}, {"Mopf", 0x1D544, 0x0000},
+  {"Mscr", 0x2133, 0x0000}, {"Mu", 0x039C, 0x0000}, {"NJcy", 0x040A, 0x0000},
+  {"Nacute", 0x0143, 0x0000}, {"Ncaron", 0x0147, 0x0000}, {"Ncedil", 0x0145, 0x0000},
+  {"Ncy", 0x041D, 0x0000}, {"NegativeMediumSpace", 0x200B, 0x0000},
+  {"NegativeThickSpace", 0x200B, 0x0000}, {"NegativeThinSpace", 0x200B, 0x0000},
+  {"NegativeVeryThinSpace", 0x200B, 0x0000}, {"NestedGreaterGreater", 0x226B, 0x0000},
+  {"NestedLessLess", 0x226A, 0x0000}, {"NewLine", 0x000A, 0x0000}, {"Nfr", 0x1D511, 0x0000},
+  {"NoBreak", 0x2060, 0x0000}, {"NonBreakingSpace", 0x00A0, 0x0000}, {"Nopf", 0x2115, 0x0000},
+  {"Not", 0x2AEC, 0x0000}, {"NotCongruent", 0x2262, 0x0000}, {"NotCupCap", 0x226D, 0x0000},
+  {"NotDoubleVerticalBar", 0x2226, 0x0000}, {"NotElement", 0x2209, 0x0000},
+  {"NotEqual", 0x2260, 0x0000}, {"NotEqualTilde", 0x2242, 0x0338}, {"NotExists", 0x2204, 0x0000},
+  {"NotGreater", 0x226F, 0x0000}, {"NotGreaterEqual", 0x2271, 0x0000},
+  {"NotGreaterFullEqual", 0x2267, 0x0338}, {"NotGreaterGreater", 0x226B, 0x0338},
+  {"NotGreaterLess", 0x2279, 0x0000}, {"NotGreaterSlantEqual", 0x2A7E, 0x0338},
+  {"NotGreaterTilde", 0x2275, 0x0000}, {"NotHumpDownHump", 0x224E, 0x0338},
+  {"NotHumpEqual", 0x224F, 0x0338}, {"NotLeftTriangle", 0x22EA, 0x0000},
+  {"NotLeftTriangleBar", 0x29CF, 0x0338}, {"NotLeftTriangleEqual", 0x22EC, 0x0000},
+  {"NotLess", 0x226E, 0x0000}, {"NotLessEqual", 0x2270, 0x0000},
+  {"NotLessGreater", 0x2278, 0x0000}, {"NotLessLess", 0x226A, 0x0338},
+  {"NotLessSlantEqual", 0x2A7D, 0x0338}, {"NotLessTilde", 0x2274, 0x0000},
+  {"NotNestedGreaterGreater", 0x2AA2, 0x0338}, {"NotNestedLessLess", 0x2AA1, 0x0338},
+  {"NotPrecedes", 0x2280, 0x0000}, {"NotPrecedesEqual", 0x2AAF, 0x0338},
+  {"NotPrecedesSlantEqual", 0x22E0, 0x0000}, {"NotReverseElement", 0x220C, 0x0000},
+  {"NotRightTriangle", 0x22EB, 0x0000}, {"NotRightTriangleBar", 0x29D0, 0x0338},
+  {"NotRightTriangleEqual", 0x22ED, 0x0000}, {"NotSquareSubset", 0x228F, 0x0338},
+  {"NotSquareSubsetEqual", 0x22E2, 0x0000}, {"NotSquareSuperset", 0x2290, 0x0338},
+  {"NotSquareSupersetEqual", 0x22E3, 0x0000}, {"NotSubset", 0x2282, 0x20D2},
+  {"NotSubsetEqual", 0x2288, 0x0000}, {"NotSucceeds", 0x2281, 0x0000},
+  {"NotSucceedsEqual", 0x2AB0, 0x0338}, {"NotSucceedsSlantEqual", 0x22E1, 0x0000},
+  {"NotSucceedsTilde", 0x227F, 0x0338}, {"NotSuperset", 0x2283, 0x20D2},
+  {"NotSupersetEqual", 0x2289, 0x0000}, {"NotTilde", 0x2241, 0x0000},
+  {"NotTildeEqual", 0x2244, 0x0000}, {"NotTildeFullEqual", 0x2247, 0x0000},
+  {"NotTildeTilde", 0x2249, 0x0000}, {"NotVerticalBar", 0x2224, 0x0000}, {"Nscr", 0x1D4A9, 0x0000},
+  {"Ntilde", 0x00D1, 0x0000}, {"Nu", 0x039D, 0x0000}, {"OElig", 0x0152, 0x0000},
+  {"Oacute", 0x00D3, 0x0000}, {"Ocirc", 0x00D4, 0x0000}, {"Ocy", 0x041E, 0x0000},
+  {"Odblac", 0x0150, 0x0000}, {"Ofr", 0x1D512, 0x0000}, {"Ograve", 0x00D2, 0x0000},
+  {"Omacr", 0x014C, 0x0000}, {"Omega", 0x03A9, 0x0000}, {"Omicron", 0x039F, 0x0000},
+  {"Oopf", 0x1D546, 0x0000}, {"OpenCurlyDoubleQuote", 0x201C, 0x0000},
+  {"OpenCurlyQuote", 0x2018, 0x0000}, {"Or", 0x2A54, 0x0000}, {"Oscr", 0x1D4AA, 0x0000},
+  {"Oslash", 0x00D8, 0x0000}, {"Otilde", 0x00D5, 0x0000}, {"Otimes", 0x2A37, 0x0000},
+  {"Ouml", 0x00D6, 0x0000}, {"OverBar", 0x203E, 0x0000}, {"OverBrace", 0x23DE, 0x0000},
+  {"OverBracket", 0x23B4, 0x0000}, {"OverParenthesis", 0x23DC, 0x0000},
+  {"PartialD", 0x2202, 0x0000}, {"Pcy", 0x041F, 0x0000}, {"Pfr", 0x1D513, 0x0000},
+  {"Phi", 0x03A6, 0x0000}, {"Pi", 0x03A0, 0x0000}, {"PlusMinus", 0x00B1, 0x0000},
+  {"Poincareplane", 0x210C, 0x0000}, {"Popf", 0x2119, 0x0000}, {"Pr", 0x2ABB, 0x0000},
+  {"Precedes", 0x227A, 0x0000}, {"PrecedesEqual", 0x2AAF, 0x0000},
+  {"PrecedesSlantEqual", 0x227C, 0x0000}, {"PrecedesTilde", 0x227E, 0x0000},
+  {"Prime", 0x2033, 0x0000}, {"Product", 0x220F, 0x0000}, {"Proportion", 0x2237, 0x0000},
+  {"Proportional", 0x221D, 0x0000}, {"Pscr", 0x1D4AB, 0x0000}, {"Psi", 0x03A8, 0x0000},
+  {"QUOT", 0x0022, 0x0000}, {"Qfr", 0x1D514, 0x0000}, {"Qopf", 0x211A, 0x0000},
+  {"Qscr", 0x1D4AC, 0x0000}, {"RBarr", 0x2910, 0x0000}, {"REG", 0x00AE, 0x0000},
+  {"Racute", 0x0154, 0x0000}, {"Rang", 0x27EB, 0x0000}, {"Rarr", 0x21A0, 0x0000},
+  {"Rarrtl", 0x2916, 0x0000}, {"Rcaron", 0x0158, 0x0000}, {"Rcedil", 0x0156, 0x0000},
+  {"Rcy", 0x0420, 0x0000}, {"Re", 0x211C, 0x0000}, {"ReverseElement", 0x220B, 0x0000},
+  {"ReverseEquilibrium", 0x21CB, 0x0000}, {"ReverseUpEquilibrium", 0x296F, 0x0000},
+  {"Rfr", 0x211C, 0x0000}, {"Rho", 0x03A1, 0x0000}, {"RightAngleBracket", 0x27E9, 0x0000},
+  {"RightArrow", 0x2192, 0x0000}, {"RightArrowBar", 0x21E5, 0x0000},
+  {"RightArrowLeftArrow", 0x21C4, 0x0000}, {"RightCeiling", 0x2309, 0x0000},
+  {"RightDoubleBracket", 0x27E7, 0x0000}, {"RightDownTeeVector", 0x295D, 0x0000},
+  {"RightDownVector", 0x21C2, 0x0000}, {"RightDownVectorBar", 0x2955, 0x0000},
+  {"RightFloor", 0x230B, 0x0000}, {"RightTee", 0x22A2, 0x0000}, {"RightTeeArrow", 0x21A6, 0x0000},
+  {"RightTeeVector", 0x295B, 0x0000}, {"RightTriangle", 0x22B3, 0x0000},
+  {"RightTriangleBar", 0x29D0, 0x0000}, {"RightTriangleEqual", 0x22B5, 0x0000},
+  {"RightUpDownVector", 0x294F, 0x0000}, {"RightUpTeeVector", 0x295C, 0x0000},
+  {"RightUpVector", 0x21BE, 0x0000}, {"RightUpVectorBar", 0x2954, 0x0000},
+  {"RightVector", 0x21C0, 0x0000}, {"RightVectorBar", 0x2953, 0x0000},
+  {"Rightarrow", 0x21D2, 0x0000}, {"Ropf", 0x211D, 0x0000}, {"RoundImplies", 0x2970, 0x0000},
+  {"Rrightarrow", 0x21DB, 0x0000}, {"Rscr", 0x211B, 0x0000}, {"Rsh", 0x21B1, 0x0000},
+  {"RuleDelayed", 0x29F4, 0x0000}, {"SHCHcy", 0x0429, 0x0000}, {"SHcy", 0x0428, 0x0000},
+  {"SOFTcy", 0x042C, 0x0000}, {"Sacute", 0x015A, 0x0000}, {"Sc", 0x2ABC, 0x0000},
+  {"Scaron", 0x0160, 0x0000}, {"Scedil", 0x015E, 0x0000}, {"Scirc", 0x015C, 0x0000},
+  {"Scy", 0x0421, 0x0000}, {"Sfr", 0x1D516, 0x0000}, {"ShortDownArrow", 0x2193, 0x0000},
+  {"ShortLeftArrow", 0x2190, 0x0000}, {"ShortRightArrow", 0x2192, 0x0000},
+  {"ShortUpArrow", 0x2191, 0x0000}, {"Sigma", 0x03A3, 0x0000}, {"SmallCircle", 0x2218, 0x0000},
+  {"Sopf", 0x1D54A, 0x0000}, {"Sqrt", 0x221A, 0x0000}, {"Square", 0x25A1, 0x0000},
+  {"SquareIntersection", 0x2293, 0x0000}, {"SquareSubset", 0x228F, 0x0000},
+  {"SquareSubsetEqual", 0x2291, 0x0000}, {"SquareSuperset", 0x2290, 0x0000},
+  {"SquareSupersetEqual", 0x2292, 0x0000}, {"SquareUnion", 0x2294, 0x0000},
+  {"Sscr", 0x1D4AE, 0x0000}, {"Star", 0x22C6, 0x0000}, {"Sub", 0x22D0, 0x0000},
+  {"Subset", 0x22D0, 0x0000}, {"SubsetEqual", 0x2286, 0x0000}, {"Succeeds", 0x227B, 0x0000},
+  {"SucceedsEqual", 0x2AB0, 0x0000}, {"SucceedsSlantEqual", 0x227D, 0x0000},
+  {"SucceedsTilde", 0x227F, 0x0000}, {"SuchThat", 0x220B, 0x0000}, {"Sum", 0x2211, 0x0000},
+  {"Sup", 0x22D1, 0x0000}, {"Superset", 0x2283, 0x0000}, {"SupersetEqual", 0x2287, 0x0000},
+  {"Supset", 0x22D1, 0x0000}, {"THORN", 0x00DE, 0x0000}, {"TRADE", 0x2122, 0x0000},
+  {"TSHcy", 0x040B, 0x0000}, {"TScy", 0x0426, 0x0000}, {"Tab", 0x0009, 0x0000},
+  {"Tau", 0x03A4, 0x0000}, {"Tcaron", 0x0164, 0x0000}, {"Tcedil", 0x0162, 0x0000},
+  {"Tcy", 0x0422, 0x0000}, {"Tfr", 0x1D517, 0x0000}, {"Therefore", 0x2234, 0x0000},
+  {"Theta", 0x0398, 0x0000}, {"ThickSpace", 0x205F, 0x200A}, {"ThinSpace", 0x2009, 0x0000},
+  {"Tilde", 0x223C, 0x0000}, {"TildeEqual", 0x2243, 0x0000}, {"TildeFullEqual", 0x2245, 0x0000},
+  {"TildeTilde", 0x2248, 0x0000}, {"Topf", 0x1D54B, 0x0000}, {"TripleDot", 0x20DB, 0x0000},
+  {"Tscr", 0x1D4AF, 0x0000}, {"Tstrok", 0x0166, 0x0000}, {"Uacute", 0x00DA, 0x0000},
+  {"Uarr", 0x219F, 0x0000}, {"Uarrocir", 0x2949, 0x0000}, {"Ubrcy", 0x040E, 0x0000},
+  {"Ubreve", 0x016C, 0x0000}, {"Ucirc", 0x00DB, 0x0000}, {"Ucy", 0x0423, 0x0000},
+  {"Udblac", 0x0170, 0x0000}, {"Ufr", 0x1D518, 0x0000}, {"Ugrave", 0x00D9, 0x0000},
+  {"Umacr", 0x016A, 0x0000}, {"UnderBar", 0x005F, 0x0000}, {"UnderBrace", 0x23DF, 0x0000},
+  {"UnderBracket", 0x23B5, 0x0000}, {"UnderParenthesis", 0x23DD, 0x0000},
+  {"Union", 0x22C3, 0x0000}, {"UnionPlus", 0x228E, 0x0000}, {"Uogon", 0x0172, 0x0000},
+  {"Uopf", 0x1D54C, 0x0000}, {"UpArrow", 0x2191, 0x0000}, {"UpArrowBar", 0x2912, 0x0000},
+  {"UpArrowDownArrow", 0x21C5, 0x0000}, {"UpDownArrow", 0x2195, 0x0000},
+  {"UpEquilibrium", 0x296E, 0x0000}, {"UpTee", 0x22A5, 0x0000}, {"UpTeeArrow", 0x21A5, 0x0000},
+  {"Uparrow", 0x21D1, 0x0000}, {"Updownarrow", 0x21D5, 0x0000}, {"UpperLeftArrow", 0x2196, 0x0000},
+  {"UpperRightArrow", 0x2197, 0x0000}, {"Upsi", 0x03D2, 0x0000}, {"Upsilon", 0x03A5, 0x0000},
+  {"Uring", 0x016E, 0x0000}, {"Uscr", 0x1D4B0, 0x0000}, {"Utilde", 0x0168, 0x0000},
+  {"Uuml", 0x00DC, 0x0000}, {"VDash", 0x22AB, 0x0000}, {"Vbar", 0x2AEB, 0x0000},
+  {"Vcy", 0x0412, 0x0000}, {"Vdash", 0x22A9, 0x0000}, {"Vdashl", 0x2AE6, 0x0000},
+  {"Vee", 0x22C1, 0x0000}, {"Verbar", 0x2016, 0x0000}, {"Vert", 0x2016, 0x0000},
+  {"VerticalBar", 0x2223, 0x0000}, {"VerticalLine", 0x007C, 0x0000},
+  {"VerticalSeparator", 0x2758, 0x0000}, {"VerticalTilde", 0x2240, 0x0000},
+  {"VeryThinSpace", 0x200A, 0x0000}, {"Vfr", 0x1D519, 0x0000}, {"Vopf", 0x1D54D, 0x0000},
+  {"Vscr", 0x1D4B1, 0x0000}, {"Vvdash", 0x22AA, 0x0000}, {"Wcirc", 0x0174, 0x0000},
+  {"Wedge", 0x22C0, 0x0000}, {"Wfr", 0x1D51A, 0x0000}, {"Wopf", 0x1D54E, 0x0000},
+  {"Wscr", 0x1D4B2, 0x0000}, {"Xfr", 0x1D51B, 0x0000}, {"Xi", 0x039E, 0x0000},
+  {"Xopf", 0x1D54F, 0x0000}, {"Xscr", 0x1D4B3, 0x0000}, {"YAcy", 0x042F, 0x0000},
+  {"YIcy", 0x0407, 0x0000}, {"YUcy", 0x042E, 0x0000}, {"Yacute", 0x00DD, 0x0000},
+  {"Ycirc", 0x0176, 0x0000}, {"Ycy", 0x042B, 0x0000}, {"Yfr", 0x1D51C, 0x0000},
+  {"Yopf", 0x1D550, 0x0000}, {"Yscr", 0x1D4B4, 0x0000}, {"Yuml", 0x0178, 0x0000},
+  {"ZHcy", 0x0416, 0x0000}, {"Zacute", 0x0179, 0x0000}, {"Zcaron", 0x017D, 0x0000},
+  {"Zcy", 0x0417, 0x0000}, {"Zdot", 0x017B, 0x0000}, {"ZeroWidthSpace", 0x200B, 0x0000},
+  {"Zeta", 0x0396, 0x0000}, {"Zfr", 0x2128, 0x0000}, {"Zopf", 0x2124, 0x0000},
+  {"Zscr", 0x1D4B5, 0x0000}, {"aacute", 0x00E1, 0x0000}, {"abreve", 0x0103, 0x0000},
+  {"ac", 0x223E, 0x0000}, {"acE", 0x223E, 0x0333}, {"acd", 0x223F, 0x0000},
+  {"acirc", 0x00E2, 0x0000}, {"acute", 0x00B4, 0x0000}, {"acy", 0x0430, 0x0000},
+  {"aelig", 0x00E6, 0x0000}, {"af", 0x2061, 0x0000}, {"afr", 0x1D51E, 0x0000},
+  {"agrave", 0x00E0, 0x0000}, {"alefsym", 0x2135, 0x0000}, {"aleph", 0x2135, 0x0000},
+  {"alpha", 0x03B1, 0x0000}, {"amacr", 0x0101, 0x0000}, {"amalg", 0x2A3F, 0x0000},
+  {"amp", 0x0026, 0x0000}, {"and", 0x2227, 0x0000}, {"andand", 0x2A55, 0x0000},
+  {"andd", 0x2A5C, 0x0000}, {"andslope", 0x2A58, 0x0000}, {"andv", 0x2A5A, 0x0000},
+  {"ang", 0x2220, 0x0000}, {"ange", 0x29A4, 0x0000}, {"angle", 0x2220, 0x0000},
+  {"angmsd", 0x2221, 0x0000}, {"angmsdaa", 0x29A8, 0x0000}, {"angmsdab", 0x29A9, 0x0000},
+  {"angmsdac", 0x29AA, 0x0000}, {"angmsdad", 0x29AB, 0x0000}, {"angmsdae", 0x29AC, 0x0000},
+  {"angmsdaf", 0x29AD, 0x0000}, {"angmsdag", 0x29AE, 0x0000}, {"angmsdah", 0x29AF, 0x0000},
+  {"angrt", 0x221F, 0x0000}, {"angrtvb", 0x22BE, 0x0000}, {"angrtvbd", 0x299D, 0x0000},
+  {"angsph", 0x2222, 0x0000}, {"angst", 0x00C5, 0x0000}, {"angzarr", 0x237C, 0x0000},
+  {"aogon", 0x0105, 0x0000}, {"aopf", 0x1D552, 0x0000}, {"ap", 0x2248, 0x0000},
+  {"apE", 0x2A70, 0x0000}, {"apacir", 0x2A6F, 0x0000}, {"ape", 0x224A, 0x0000},
+  {"apid", 0x224B, 0x0000}, {"apos", 0x0027, 0x0000}, {"approx", 0x2248, 0x0000},
+  {"approxeq", 0x224A, 0x0000}, {"aring", 0x00E5, 0x0000}, {"ascr", 0x1D4B6, 0x0000},
+  {"ast", 0x002A, 0x0000}, {"asymp", 0x2248, 0x0000}, {"asympeq", 0x224D, 0x0000},
+  {"atilde", 0x00E3, 0x0000}, {"auml", 0x00E4, 0x0000}, {"awconint", 0x2233, 0x0000},
+  {"awint", 0x2A11, 0x0000}, {"bNot", 0x2AED, 0x0000}, {"backcong", 0x224C, 0x0000},
+  {"backepsilon", 0x03F6, 0x0000}, {"backprime", 0x2035, 0x0000}, {"backsim", 0x223D, 0x0000},
+  {"backsimeq", 0x22CD, 0x0000}, {"barvee", 0x22BD, 0x0000}, {"barwed", 0x2305, 0x0000},
+  {"barwedge", 0x2305, 0x0000}, {"bbrk", 0x23B5, 0x0000}, {"bbrktbrk", 0x23B6, 0x0000},
+  {"bcong", 0x224C, 0x0000}, {"bcy", 0x0431, 0x0000}, {"bdquo", 0x201E, 0x0000},
+  {"becaus", 0x2235, 0x0000}, {"because", 0x2235, 0x0000}, {"bemptyv", 0x29B0, 0x0000},
+  {"bepsi", 0x03F6, 0x0000}, {"bernou", 0x212C, 0x0000}, {"beta", 0x03B2, 0x0000},
+  {"beth", 0x2136, 0x0000}, {"between", 0x226C, 0x0000}, {"bfr", 0x1D51F, 0x0000},
+  {"bigcap", 0x22C2, 0x0000}, {"bigcirc", 0x25EF, 0x0000}, {"bigcup", 0x22C3, 0x0000},
+  {"bigodot", 0x2A00, 0x0000}, {"bigoplus", 0x2A01, 0x0000}, {"bigotimes", 0x2A02, 0x0000},
+  {"bigsqcup", 0x2A06, 0x0000}, {"bigstar", 0x2605, 0x0000}, {"bigtriangledown", 0x25BD, 0x0000},
+  {"bigtriangleup", 0x25B3, 0x0000}, {"biguplus", 0x2A04, 0x0000}, {"bigvee", 0x22C1, 0x0000},
+  {"bigwedge", 0x22C0, 0x0000}, {"bkarow", 0x290D, 0x0000}, {"blacklozenge", 0x29EB, 0x0000},
+  {"blacksquare", 0x25AA, 0x0000}, {"blacktriangle", 0x25B4, 0x0000},
+  {"blacktriangledown", 0x25BE, 0x0000}, {"blacktriangleleft", 0x25C2, 0x0000},
+  {"blacktriangleright", 0x25B8, 0x0000}, {"blank", 0x2423, 0x0000}, {"blk12", 0x2592, 0x0000},
+  {"blk14", 0x2591, 0x0000}, {"blk34", 0x2593, 0x0000}, {"block", 0x2588, 0x0000},
+  {"bne", 0x003D, 0x20E5}, {"bnequiv", 0x2261, 0x20E5}, {"bnot", 0x2310, 0x0000},
+  {"bopf", 0x1D553, 0x0000}, {"bot", 0x22A5, 0x0000}, {"bottom", 0x22A5, 0x0000},
+  {"bowtie", 0x22C8, 0x0000}, {"boxDL", 0x2557, 0x0000}, {"boxDR", 0x2554, 0x0000},
+  {"boxDl", 0x2556, 0x0000}, {"boxDr", 0x2553, 0x0000}, {"boxH", 0x2550, 0x0000},
+  {"boxHD", 0x2566, 0x0000}, {"boxHU", 0x2569, 0x0000}, {"boxHd", 0x2564, 0x0000},
+  {"boxHu", 0x2567, 0x0000}, {"boxUL", 0x255D, 0x0000}, {"boxUR", 0x255A, 0x0000},
+  {"boxUl", 0x255C, 0x0000}, {"boxUr", 0x2559, 0x0000}, {"boxV", 0x2551, 0x0000},
+  {"boxVH", 0x256C, 0x0000}, {"boxVL", 0x2563, 0x0000}, {"boxVR", 0x2560, 0x0000},
+  {"boxVh", 0x256B, 0x0000}, {"boxVl", 0x2562, 0x0000}, {"boxVr", 0x255F, 0x0000},
+  {"boxbox", 0x29C9, 0x0000}, {"boxdL", 0x2555, 0x0000}, {"boxdR", 0x2552, 0x0000},
+  {"boxdl", 0x2510, 0x0000}, {"boxdr", 0x250C, 0x0000}, {"boxh", 0x2500, 0x0000},
+  {"boxhD", 0x2565, 0x0000}, {"boxhU", 0x2568, 0x0000}, {"boxhd", 0x252C, 0x0000},
+  {"boxhu", 0x2534, 0x0000}, {"boxminus", 0x229F, 0x0000}, {"boxplus", 0x229E, 0x0000},
+  {"boxtimes", 0x22A0, 0x0000}, {"boxuL", 0x255B, 0x0000}, {"boxuR", 0x2558, 0x0000},
+  {"boxul", 0x2518, 0x0000}, {"boxur", 0x2514, 0x0000}, {"boxv", 0x2502, 0x0000},
+  {"boxvH", 0x256A, 0x0000}, {"boxvL", 0x2561, 0x0000}, {"boxvR", 0x255E, 0x0000},
+  {"boxvh", 0x253C, 0x0000}, {"boxvl", 0x2524, 0x0000}, {"boxvr", 0x251C, 0x0000},
+  {"bprime", 0x2035, 0x0000}, {"breve", 0x02D8, 0x0000}, {"brvbar", 0x00A6, 0x0000},
+  {"bscr", 0x1D4B7, 0x0000}, {"bsemi", 0x204F, 0x0000}, {"bsim", 0x223D, 0x0000},
+  {"bsime", 0x22CD, 0x0000}, {"bsol", 0x005C, 0x0000}, {"bsolb", 0x29C5, 0x0000},
+  {"bsolhsub", 0x27C8, 0x0000}, {"bull", 0x2022, 0x0000}, {"bullet", 0x2022, 0x0000},
+  {"bump", 0x224E, 0x0000}, {"bumpE", 0x2AAE, 0x0000}, {"bumpe", 0x224F, 0x0000},
+  {"bumpeq", 0x224F, 0x0000}, {"cacute", 0x0107, 0x0000}, {"cap", 0x2229, 0x0000},
+  {"capand", 0x2A44, 0x0000}, {"capbrcup", 0x2A49, 0x0000}, {"capcap", 0x2A4B, 0x0000},
+  {"capcup", 0x2A47, 0x0000}, {"capdot", 0x2A40, 0x0000}, {"caps", 0x2229, 0xFE00},
+  {"caret", 0x2041, 0x0000}, {"caron", 0x02C7, 0x0000}, {"ccaps", 0x2A4D, 0x0000},
+  {"ccaron", 0x010D, 0x0000}, {"ccedil", 0x00E7, 0x0000}, {"ccirc", 0x0109, 0x0000},
+  {"ccups", 0x2A4C, 0x0000}, {"ccupssm", 0x2A50, 0x0000}, {"cdot", 0x010B, 0x0000},
+  {"cedil", 0x00B8, 0x0000}, {"cemptyv", 0x29B2, 0x0000}, {"cent", 0x00A2, 0x0000},
+  {"centerdot", 0x00B7, 0x0000}, {"cfr", 0x1D520, 0x0000}, {"chcy", 0x0447, 0x0000},
+  {"check", 0x2713, 0x0000}, {"checkmark", 0x2713, 0x0000}, {"chi", 0x03C7, 0x0000},
+  {"cir", 0x25CB, 0x0000}, {"cirE", 0x29C3, 0x0000}, {"circ", 0x02C6, 0x0000},
+  {"circeq", 0x2257, 0x0000}, {"circlearrowleft", 0x21BA, 0x0000},
+  {"circlearrowright", 0x21BB, 0x0000}, {"circledR", 0x00AE, 0x0000}, {"circledS", 0x24C8, 0x0000},
+  {"circledast", 0x229B, 0x0000}, {"circledcirc", 0x229A, 0x0000}, {"circleddash", 0x229D, 0x0000},
+  {"cire", 0x2257, 0x0000}, {"cirfnint", 0x2A10, 0x0000}, {"cirmid", 0x2AEF, 0x0000},
+  {"cirscir", 0x29C2, 0x0000}, {"clubs", 0x2663, 0x0000}, {"clubsuit", 0x2663, 0x0000},
+  {"colon", 0x003A, 0x0000}, {"colone", 0x2254, 0x0000}, {"coloneq", 0x2254, 0x0000},
+  {"comma", 0x002C, 0x0000}, {"commat", 0x0040, 0x0000}, {"comp", 0x2201, 0x0000},
+  {"compfn", 0x2218, 0x0000}, {"complement", 0x2201, 0x0000}, {"complexes", 0x2102, 0x0000},
+  {"cong", 0x2245, 0x0000}, {"congdot", 0x2A6D, 0x0000}, {"conint", 0x222E, 0x0000},
+  {"copf", 0x1D554, 0x0000}, {"coprod", 0x2210, 0x0000}, {"copy", 0x00A9, 0x0000},
+  {"copysr", 0x2117, 0x0000}, {"crarr", 0x21B5, 0x0000}, {"cross", 0x2717, 0x0000},
+  {"cscr", 0x1D4B8, 0x0000}, {"csub", 0x2ACF, 0x0000}, {"csube", 0x2AD1, 0x0000},
+  {"csup", 0x2AD0, 0x0000}, {"csupe", 0x2AD2, 0x0000}, {"ctdot", 0x22EF, 0x0000},
+  {"cudarrl", 0x2938, 0x0000}, {"cudarrr", 0x2935, 0x0000}, {"cuepr", 0x22DE, 0x0000},
+  {"cuesc", 0x22DF, 0x0000}, {"cularr", 0x21B6, 0x0000}, {"cularrp", 0x293D, 0x0000},
+  {"cup", 0x222A, 0x0000}, {"cupbrcap", 0x2A48, 0x0000}, {"cupcap", 0x2A46, 0x0000},
+  {"cupcup", 0x2A4A, 0x0000}, {"cupdot", 0x228D, 0x0000}, {"cupor", 0x2A45, 0x0000},
+  {"cups", 0x222A, 0xFE00}, {"curarr", 0x21B7, 0x0000}, {"curarrm", 0x293C, 0x0000},
+  {"curlyeqprec", 0x22DE, 0x0000}, {"curlyeqsucc", 0x22DF, 0x0000}, {"curlyvee", 0x22CE, 0x0000},
+  {"curlywedge", 0x22CF, 0x0000}, {"curren", 0x00A4, 0x0000}, {"curvearrowleft", 0x21B6, 0x0000},
+  {"curvearrowright", 0x21B7, 0x0000}, {"cuvee", 0x22CE, 0x0000}, {"cuwed", 0x22CF, 0x0000},
+  {"cwconint", 0x2232, 0x0000}, {"cwint", 0x2231, 0x0000}, {"cylcty", 0x232D, 0x0000},
+  {"dArr", 0x21D3, 0x0000}, {"dHar", 0x2965, 0x0000}, {"dagger", 0x2020, 0x0000},
+  {"daleth", 0x2138, 0x0000}, {"darr", 0x2193, 0x0000}, {"dash", 0x2010, 0x0000},
+  {"dashv", 0x22A3, 0x0000}, {"dbkarow", 0x290F, 0x0000}, {"dblac", 0x02DD, 0x0000},
+  {"dcaron", 0x010F, 0x0000}, {"dcy", 0x0434, 0x0000}, {"dd", 0x2146, 0x0000},
+  {"ddagger", 0x2021, 0x0000}, {"ddarr", 0x21CA, 0x0000}, {"ddotseq", 0x2A77, 0x0000},
+  {"deg", 0x00B0, 0x0000}, {"delta", 0x03B4, 0x0000}, {"demptyv", 0x29B1, 0x0000},
+  {"dfisht", 0x297F, 0x0000}, {"dfr", 0x1D521, 0x0000}, {"dharl", 0x21C3, 0x0000},
+  {"dharr", 0x21C2, 0x0000}, {"diam", 0x22C4, 0x0000}, {"diamond", 0x22C4, 0x0000},
+  {"diamondsuit", 0x2666, 0x0000}, {"diams", 0x2666, 0x0000}, {"die", 0x00A8, 0x0000},
+  {"digamma", 0x03DD, 0x0000}, {"disin", 0x22F2, 0x0000}, {"div", 0x00F7, 0x0000},
+  {"divide", 0x00F7, 0x0000}, {"divideontimes", 0x22C7, 0x0000}, {"divonx", 0x22C7, 0x0000},
+  {"djcy", 0x0452, 0x0000}, {"dlcorn", 0x231E, 0x0000}, {"dlcrop", 0x230D, 0x0000},
+  {"dollar", 0x0024, 0x0000}, {"dopf", 0x1D555, 0x0000}, {"dot", 0x02D9, 0x0000},
+  {"doteq", 0x2250, 0x0000}, {"doteqdot", 0x2251, 0x0000}, {"dotminus", 0x2238, 0x0000},
+  {"dotplus", 0x2214, 0x0000}, {"dotsquare", 0x22A1, 0x0000}, {"doublebarwedge", 0x2306, 0x0000},
+  {"downarrow", 0x2193, 0x0000}, {"downdownarrows", 0x21CA, 0x0000},
+  {"downharpoonleft", 0x21C3, 0x0000}, {"downharpoonright", 0x21C2, 0x0000},
+  {"drbkarow", 0x2910, 0x0000}, {"drcorn", 0x231F, 0x0000}, {"drcrop", 0x230C, 0x0000},
+  {"dscr", 0x1D4B9, 0x0000}, {"dscy", 0x0455, 0x0000}, {"dsol", 0x29F6, 0x0000},
+  {"dstrok", 0x0111, 0x0000}, {"dtdot", 0x22F1, 0x0000}, {"dtri", 0x25BF, 0x0000},
+  {"dtrif", 0x25BE, 0x0000}, {"duarr", 0x21F5, 0x0000}, {"duhar", 0x296F, 0x0000},
+  {"dwangle", 0x29A6, 0x0000}, {"dzcy", 0x045F, 0x0000}, {"dzigrarr", 0x27FF, 0x0000},
+  {"eDDot", 0x2A77, 0x0000}, {"eDot", 0x2251, 0x0000}, {"eacute", 0x00E9, 0x0000},
+  {"easter", 0x2A6E, 0x0000}, {"ecaron", 0x011B, 0x0000}, {"ecir", 0x2256, 0x0000},
+  {"ecirc", 0x00EA, 0x0000}, {"ecolon", 0x2255, 0x0000}, {"ecy", 0x044D, 0x0000},
+  {"edot", 0x0117, 0x0000}, {"ee", 0x2147, 0x0000}, {"efDot", 0x2252, 0x0000},
+  {"efr", 0x1D522, 0x0000}, {"eg", 0x2A9A, 0x0000}, {"egrave", 0x00E8, 0x0000},
+  {"egs", 0x2A96, 0x0000}, {"egsdot", 0x2A98, 0x0000}, {"el", 0x2A99, 0x0000},
+  {"elinters", 0x23E7, 0x0000}, {"ell", 0x2113, 0x0000}, {"els", 0x2A95, 0x0000},
+  {"elsdot", 0x2A97, 0x0000}, {"emacr", 0x0113, 0x0000}, {"empty", 0x2205, 0x0000},
+  {"emptyset", 0x2205, 0x0000}, {"emptyv", 0x2205, 0x0000}, {"emsp", 0x2003, 0x0000},
+  {"emsp13", 0x2004, 0x0000}, {"emsp14", 0x2005, 0x0000}, {"eng", 0x014B, 0x0000},
+  {"ensp", 0x2002, 0x0000}, {"eogon", 0x0119, 0x0000}, {"eopf", 0x1D556, 0x0000},
+  {"epar", 0x22D5, 0x0000}, {"eparsl", 0x29E3, 0x0000}, {"eplus", 0x2A71, 0x0000},
+  {"epsi", 0x03B5, 0x0000}, {"epsilon", 0x03B5, 0x0000}, {"epsiv", 0x03F5, 0x0000},
+  {"eqcirc", 0x2256, 0x0000}, {"eqcolon", 0x2255, 0x0000}, {"eqsim", 0x2242, 0x0000},
+  {"eqslantgtr", 0x2A96, 0x0000}, {"eqslantless", 0x2A95, 0x0000}, {"equals", 0x003D, 0x0000},
+  {"equest", 0x225F, 0x0000}, {"equiv", 0x2261, 0x0000}, {"equivDD", 0x2A78, 0x0000},
+  {"eqvparsl", 0x29E5, 0x0000}, {"erDot", 0x2253, 0x0000}, {"erarr", 0x2971, 0x0000},
+  {"escr", 0x212F, 0x0000}, {"esdot", 0x2250, 0x0000}, {"esim", 0x2242, 0x0000},
+  {"eta", 0x03B7, 0x0000}, {"eth", 0x00F0, 0x0000}, {"euml", 0x00EB, 0x0000},
+  {"euro", 0x20AC, 0x0000}, {"excl", 0x0021, 0x0000}, {"exist", 0x2203, 0x0000},
+  {"expectation", 0x2130, 0x0000}, {"exponentiale", 0x2147, 0x0000},
+  {"fallingdotseq", 0x2252, 0x0000}, {"fcy", 0x0444, 0x0000}, {"female", 0x2640, 0x0000},
+  {"ffilig", 0xFB03, 0x0000}, {"fflig", 0xFB00, 0x0000}, {"ffllig", 0xFB04, 0x0000},
+  {"ffr", 0x1D523, 0x0000}, {"filig", 0xFB01, 0x0000}, {"fjlig", 0x0066, 0x006A},
+  {"flat", 0x266D, 0x0000}, {"fllig", 0xFB02, 0x0000}, {"fltns", 0x25B1, 0x0000},
+  {"fnof", 0x0192, 0x0000}, {"fopf", 0x1D557, 0x0000}, {"forall", 0x2200, 0x0000},
+  {"fork", 0x22D4, 0x0000}, {"forkv", 0x2AD9, 0x0000}, {"fpartint", 0x2A0D, 0x0000},
+  {"frac12", 0x00BD, 0x0000}, {"frac13", 0x2153, 0x0000}, {"frac14", 0x00BC, 0x0000},
+  {"frac15", 0x2155, 0x0000}, {"frac16", 0x2159, 0x0000}, {"frac18", 0x215B, 0x0000},
+  {"frac23", 0x2154, 0x0000}, {"frac25", 0x2156, 0x0000}, {"frac34", 0x00BE, 0x0000},
+  {"frac35", 0x2157, 0x0000}, {"frac38", 0x215C, 0x0000}, {"frac45", 0x2158, 0x0000},
+  {"frac56", 0x215A, 0x0000}, {"frac58", 0x215D, 0x0000}, {"frac78", 0x215E, 0x0000},
+  {"frasl", 0x2044, 0x0000}, {"frown", 0x2322, 0x0000}, {"fscr", 0x1D4BB, 0x0000},
+  {"gE", 0x2267, 0x0000}, {"gEl", 0x2A8C, 0x0000}, {"gacute", 0x01F5, 0x0000},
+  {"gamma", 0x03B3, 0x0000}, {"gammad", 0x03DD, 0x0000}, {"gap", 0x2A86, 0x0000},
+  {"gbreve", 0x011F, 0x0000}, {"gcirc", 0x011D, 0x0000}, {"gcy", 0x0433, 0x0000},
+  {"gdot", 0x0121, 0x0000}, {"ge", 0x2265, 0x0000}, {"gel", 0x22DB, 0x0000},
+  {"geq", 0x2265, 0x0000}, {"geqq", 0x2267, 0x0000}, {"geqslant", 0x2A7E, 0x0000},
+  {"ges", 0x2A7E, 0x0000}, {"gescc", 0x2AA9, 0x0000}, {"gesdot", 0x2A80, 0x0000},
+  {"gesdoto", 0x2A82, 0x0000}, {"gesdotol", 0x2A84, 0x0000}, {"gesl", 0x22DB, 0xFE00},
+  {"gesles", 0x2A94, 0x0000}, {"gfr", 0x1D524, 0x0000}, {"gg", 0x226B, 0x0000},
+  {"ggg", 0x22D9, 0x0000}, {"gimel", 0x2137, 0x0000}, {"gjcy", 0x0453, 0x0000},
+  {"gl", 0x2277, 0x0000}, {"glE", 0x2A92, 0x0000}, {"gla", 0x2AA5, 0x0000},
+  {"glj", 0x2AA4, 0x0000}, {"gnE", 0x2269, 0x0000}, {"gnap", 0x2A8A, 0x0000},
+  {"gnapprox", 0x2A8A, 0x0000}, {"gne", 0x2A88, 0x0000}, {"gneq", 0x2A88, 0x0000},
+  {"gneqq", 0x2269, 0x0000}, {"gnsim", 0x22E7, 0x0000}, {"gopf", 0x1D558, 0x0000},
+  {"grave", 0x0060, 0x0000}, {"gscr", 0x210A, 0x0000}, {"gsim", 0x2273, 0x0000},
+  {"gsime", 0x2A8E, 0x0000}, {"gsiml", 0x2A90, 0x0000}, {"gt", 0x003E, 0x0000},
+  {"gtcc", 0x2AA7, 0x0000}, {"gtcir", 0x2A7A, 0x0000}, {"gtdot", 0x22D7, 0x0000},
+  {"gtlPar", 0x2995, 0x0000}, {"gtquest", 0x2A7C, 0x0000}, {"gtrapprox", 0x2A86, 0x0000},
+  {"gtrarr", 0x2978, 0x0000}, {"gtrdot", 0x22D7, 0x0000}, {"gtreqless", 0x22DB, 0x0000},
+  {"gtreqqless", 0x2A8C, 0x0000}, {"gtrless", 0x2277, 0x0000}, {"gtrsim", 0x2273, 0x0000},
+  {"gvertneqq", 0x2269, 0xFE00}, {"gvnE", 0x2269, 0xFE00}, {"hArr", 0x21D4, 0x0000},
+  {"hairsp", 0x200A, 0x0000}, {"half", 0x00BD, 0x0000}, {"hamilt", 0x210B, 0x0000},
+  {"hardcy", 0x044A, 0x0000}, {"harr", 0x2194, 0x0000}, {"harrcir", 0x2948, 0x0000},
+  {"harrw", 0x21AD, 0x0000}, {"hbar", 0x210F, 0x0000}, {"hcirc", 0x0125, 0x0000},
+  {"hearts", 0x2665, 0x0000}, {"heartsuit", 0x2665, 0x0000}, {"hellip", 0x2026, 0x0000},
+  {"hercon", 0x22B9, 0x0000}, {"hfr", 0x1D525, 0x0000}, {"hksearow", 0x2925, 0x0000},
+  {"hkswarow", 0x2926, 0x0000}, {"hoarr", 0x21FF, 0x0000}, {"homtht", 0x223B, 0x0000},
+  {"hookleftarrow", 0x21A9, 0x0000}, {"hookrightarrow", 0x21AA, 0x0000}, {"hopf", 0x1D559, 0x0000},
+  {"horbar", 0x2015, 0x0000}, {"hscr", 0x1D4BD, 0x0000}, {"hslash", 0x210F, 0x0000},
+  {"hstrok", 0x0127, 0x0000}, {"hybull", 0x2043, 0x0000}, {"hyphen", 0x2010, 0x0000},
+  {"iacute", 0x00ED, 0x0000}, {"ic", 0x2063, 0x0000}, {"icirc", 0x00EE, 0x0000},
+  {"icy", 0x0438, 0x0000}, {"iecy", 0x0435, 0x0000}, {"iexcl", 0x00A1, 0x0000},
+  {"iff", 0x21D4, 0x0000}, {"ifr", 0x1D526, 0x0000}, {"igrave", 0x00EC, 0x0000},
+  {"ii", 0x2148, 0x0000}, {"iiiint", 0x2A0C, 0x0000}, {"iiint", 0x222D, 0x0000},
+  {"iinfin", 0x29DC, 0x0000}, {"iiota", 0x2129, 0x0000}, {"ijlig", 0x0133, 0x0000},
+  {"imacr", 0x012B, 0x0000}, {"image", 0x2111, 0x0000}, {"imagline", 0x2110, 0x0000},
+  {"imagpart", 0x2111, 0x0000}, {"imath", 0x0131, 0x0000}, {"imof", 0x22B7, 0x0000},
+  {"imped", 0x01B5, 0x0000}, {"in", 0x2208, 0x0000}, {"incare", 0x2105, 0x0000},
+  {"infin", 0x221E, 0x0000}, {"infintie", 0x29DD, 0x0000}, {"inodot", 0x0131, 0x0000},
+  {"int", 0x222B, 0x0000}, {"intcal", 0x22BA, 0x0000}, {"integers", 0x2124, 0x0000},
+  {"intercal", 0x22BA, 0x0000}, {"intlarhk", 0x2A17, 0x0000}, {"intprod", 0x2A3C, 0x0000},
+  {"iocy", 0x0451, 0x0000}, {"iogon", 0x012F, 0x0000}, {"iopf", 0x1D55A, 0x0000},
+  {"iota", 0x03B9, 0x0000}, {"iprod", 0x2A3C, 0x0000}, {"iquest", 0x00BF, 0x0000},
+  {"iscr", 0x1D4BE, 0x0000}, {"isin", 0x2208, 0x0000}, {"isinE", 0x22F9, 0x0000},
+  {"isindot", 0x22F5, 0x0000}, {"isins", 0x22F4, 0x0000}, {"isinsv", 0x22F3, 0x0000},
+  {"isinv", 0x2208, 0x0000}, {"it", 0x2062, 0x0000}, {"itilde", 0x0129, 0x0000},
+  {"iukcy", 0x0456, 0x0000}, {"iuml", 0x00EF, 0x0000}, {"jcirc", 0x0135, 0x0000},
+  {"jcy", 0x0439, 0x0000}, {"jfr", 0x1D527, 0x0000}, {"jmath", 0x0237, 0x0000},
+  {"jopf", 0x1D55B, 0x0000}, {"jscr", 0x1D4BF, 0x0000}, {"jsercy", 0x0458, 0x0000},
+  {"jukcy", 0x0454, 0x0000}, {"kappa", 0x03BA, 0x0000}, {"kappav", 0x03F0, 0x0000},
+  {"kcedil", 0x0137, 0x0000}, {"kcy", 0x043A, 0x0000}, {"kfr", 0x1D528, 0x0000},
+  {"kgreen", 0x0138, 0x0000}, {"khcy", 0x0445, 0x0000}, {"kjcy", 0x045C, 0x0000},
+  {"kopf", 0x1D55C, 0x0000}, {"kscr", 0x1D4C0, 0x0000}, {"lAarr", 0x21DA, 0x0000},
+  {"lArr", 0x21D0, 0x0000}, {"lAtail", 0x291B, 0x0000}, {"lBarr", 0x290E, 0x0000},
+  {"lE", 0x2266, 0x0000}, {"lEg", 0x2A8B, 0x0000}, {"lHar", 0x2962, 0x0000},
+  {"lacute", 0x013A, 0x0000}, {"laemptyv", 0x29B4, 0x0000}, {"lagran", 0x2112, 0x0000},
+  {"lambda", 0x03BB, 0x0000}, {"lang", 0x27E8, 0x0000}, {"langd", 0x2991, 0x0000},
+  {"langle", 0x27E8, 0x0000}, {"lap", 0x2A85, 0x0000}, {"laquo", 0x00AB, 0x0000},
+  {"larr", 0x2190, 0x0000}, {"larrb", 0x21E4, 0x0000}, {"larrbfs", 0x291F, 0x0000},
+  {"larrfs", 0x291D, 0x0000}, {"larrhk", 0x21A9, 0x0000}, {"larrlp", 0x21AB, 0x0000},
+  {"larrpl", 0x2939, 0x0000}, {"larrsim", 0x2973, 0x0000}, {"larrtl", 0x21A2, 0x0000},
+  {"lat", 0x2AAB, 0x0000}, {"latail", 0x2919, 0x0000}, {"late", 0x2AAD, 0x0000},
+  {"lates", 0x2AAD, 0xFE00}, {"lbarr", 0x290C, 0x0000}, {"lbbrk", 0x2772, 0x0000},
+  {"lbrace", 0x007B, 0x0000}, {"lbrack", 0x005B, 0x0000}, {"lbrke", 0x298B, 0x0000},
+  {"lbrksld", 0x298F, 0x0000}, {"lbrkslu", 0x298D, 0x0000}, {"lcaron", 0x013E, 0x0000},
+  {"lcedil", 0x013C, 0x0000}, {"lceil", 0x2308, 0x0000}, {"lcub", 0x007B, 0x0000},
+  {"lcy", 0x043B, 0x0000}, {"ldca", 0x2936, 0x0000}, {"ldquo", 0x201C, 0x0000},
+  {"ldquor", 0x201E, 0x0000}, {"ldrdhar", 0x2967, 0x0000}, {"ldrushar", 0x294B, 0x0000},
+  {"ldsh", 0x21B2, 0x0000}, {"le", 0x2264, 0x0000}, {"leftarrow", 0x2190, 0x0000},
+  {"leftarrowtail", 0x21A2, 0x0000}, {"leftharpoondown", 0x21BD, 0x0000},
+  {"leftharpoonup", 0x21BC, 0x0000}, {"leftleftarrows", 0x21C7, 0x0000},
+  {"leftrightarrow", 0x2194, 0x0000}, {"leftrightarrows", 0x21C6, 0x0000},
+  {"leftrightharpoons", 0x21CB, 0x0000}, {"leftrightsquigarrow", 0x21AD, 0x0000},
+  {"leftthreetimes", 0x22CB, 0x0000}, {"leg", 0x22DA, 0x0000}, {"leq", 0x2264, 0x0000},
+  {"leqq", 0x2266, 0x0000}, {"leqslant", 0x2A7D, 0x0000}, {"les", 0x2A7D, 0x0000},
+  {"lescc", 0x2AA8, 0x0000}, {"lesdot", 0x2A7F, 0x0000}, {"lesdoto", 0x2A81, 0x0000},
+  {"lesdotor", 0x2A83, 0x0000}, {"lesg", 0x22DA, 0xFE00}, {"lesges", 0x2A93, 0x0000},
+  {"lessapprox", 0x2A85, 0x0000}, {"lessdot", 0x22D6, 0x0000}, {"lesseqgtr", 0x22DA, 0x0000},
+  {"lesseqqgtr", 0x2A8B, 0x0000}, {"lessgtr", 0x2276, 0x0000}, {"lesssim", 0x2272, 0x0000},
+  {"lfisht", 0x297C, 0x0000}, {"lfloor", 0x230A, 0x0000}, {"lfr", 0x1D529, 0x0000},
+  {"lg", 0x2276, 0x0000}, {"lgE", 0x2A91, 0x0000}, {"lhard", 0x21BD, 0x0000},
+  {"lharu", 0x21BC, 0x0000}, {"lharul", 0x296A, 0x0000}, {"lhblk", 0x2584, 0x0000},
+  {"ljcy", 0x0459, 0x0000}, {"ll", 0x226A, 0x0000}, {"llarr", 0x21C7, 0x0000},
+  {"llcorner", 0x231E, 0x0000}, {"llhard", 0x296B, 0x0000}, {"lltri", 0x25FA, 0x0000},
+  {"lmidot", 0x0140, 0x0000}, {"lmoust", 0x23B0, 0x0000}, {"lmoustache", 0x23B0, 0x0000},
+  {"lnE", 0x2268, 0x0000}, {"lnap", 0x2A89, 0x0000}, {"lnapprox", 0x2A89, 0x0000},
+  {"lne", 0x2A87, 0x0000}, {"lneq", 0x2A87, 0x0000}, {"lneqq", 0x2268, 0x0000},
+  {"lnsim", 0x22E6, 0x0000}, {"loang", 0x27EC, 0x0000}, {"loarr", 0x21FD, 0x0000},
+  {"lobrk", 0x27E6, 0x0000}, {"longleftarrow", 0x27F5, 0x0000},
+  {"longleftrightarrow", 0x27F7, 0x0000}, {"longmapsto", 0x27FC, 0x0000},
+  {"longrightarrow", 0x27F6, 0x0000}, {"looparrowleft", 0x21AB, 0x0000},
+  {"looparrowright", 0x21AC, 0x0000}, {"lopar", 0x2985, 0x0000}, {"lopf", 0x1D55D, 0x0000},
+  {"loplus", 0x2A2D, 0x0000}, {"lotimes", 0x2A34, 0x0000}, {"lowast", 0x2217, 0x0000},
+  {"lowbar", 0x005F, 0x0000}, {"loz", 0x25CA, 0x0000}, {"lozenge", 0x25CA, 0x0000},
+  {"lozf", 0x29EB, 0x0000}, {"lpar", 0x0028, 0x0000}, {"lparlt", 0x2993, 0x0000},
+  {"lrarr", 0x21C6, 0x0000}, {"lrcorner", 0x231F, 0x0000}, {"lrhar", 0x21CB, 0x0000},
+  {"lrhard", 0x296D, 0x0000}, {"lrm", 0x200E, 0x0000}, {"lrtri", 0x22BF, 0x0000},
+  {"lsaquo", 0x2039, 0x0000}, {"lscr", 0x1D4C1, 0x0000}, {"lsh", 0x21B0, 0x0000},
+  {"lsim", 0x2272, 0x0000}, {"lsime", 0x2A8D, 0x0000}, {"lsimg", 0x2A8F, 0x0000},
+  {"lsqb", 0x005B, 0x0000}, {"lsquo", 0x2018, 0x0000}, {"lsquor", 0x201A, 0x0000},
+  {"lstrok", 0x0142, 0x0000}, {"lt", 0x003C, 0x0000}, {"ltcc", 0x2AA6, 0x0000},
+  {"ltcir", 0x2A79, 0x0000}, {"ltdot", 0x22D6, 0x0000}, {"lthree", 0x22CB, 0x0000},
+  {"ltimes", 0x22C9, 0x0000}, {"ltlarr", 0x2976, 0x0000}, {"ltquest", 0x2A7B, 0x0000},
+  {"ltrPar", 0x2996, 0x0000}, {"ltri", 0x25C3, 0x0000}, {"ltrie", 0x22B4, 0x0000},
+  {"ltrif", 0x25C2, 0x0000}, {"lurdshar", 0x294A, 0x0000}, {"luruhar", 0x2966, 0x0000},
+  {"lvertneqq", 0x2268, 0xFE00}, {"lvnE", 0x2268, 0xFE00}, {"mDDot", 0x223A, 0x0000},
+  {"macr", 0x00AF, 0x0000}, {"male", 0x2642, 0x0000}, {"malt", 0x2720, 0x0000},
+  {"maltese", 0x2720, 0x0000}, {"map", 0x21A6, 0x0000}, {"mapsto", 0x21A6, 0x0000},
+  {"mapstodown", 0x21A7, 0x0000}, {"mapstoleft", 0x21A4, 0x0000}, {"mapstoup", 0x21A5, 0x0000},
+  {"marker", 0x25AE, 0x0000}, {"mcomma", 0x2A29, 0x0000}, {"mcy", 0x043C, 0x0000},
+  {"mdash", 0x2014, 0x0000}, {"measuredangle", 0x2221, 0x0000}, {"mfr", 0x1D52A, 0x0000},
+  {"mho", 0x2127, 0x0000}, {"micro", 0x00B5, 0x0000}, {"mid", 0x2223, 0x0000},
+  {"midast", 0x002A, 0x0000}, {"midcir", 0x2AF0, 0x0000}, {"middot", 0x00B7, 0x0000},
+  {"minus", 0x2212, 0x0000}, {"minusb", 0x229F, 0x0000}, {"minusd", 0x2238, 0x0000},
+  {"minusdu", 0x2A2A, 0x0000}, {"mlcp", 0x2ADB, 0x0000}, {"mldr", 0x2026, 0x0000},
+  {"mnplus", 0x2213, 0x0000}, {"models", 0x22A7, 0x0000}, {"mopf", 0x1D55E, 0x0000},
+  {"mp", 0x2213, 0x0000}, {"mscr", 0x1D4C2, 0x0000}, {"mstpos", 0x223E, 0x0000},
+  {"mu", 0x03BC, 0x0000}, {"multimap", 0x22B8, 0x0000}, {"mumap", 0x22B8, 0x0000},
+  {"nGg", 0x22D9, 0x0338}, {"nGt", 0x226B, 0x20D2}, {"nGtv", 0x226B, 0x0338},
+  {"nLeftarrow", 0x21CD, 0x0000}, {"nLeftrightarrow", 0x21CE, 0x0000}, {"nLl", 0x22D8, 0x0338},
+  {"nLt", 0x226A, 0x20D2}, {"nLtv", 0x226A, 0x0338}, {"nRightarrow", 0x21CF, 0x0000},
+  {"nVDash", 0x22AF, 0x0000}, {"nVdash", 0x22AE, 0x0000}, {"nabla", 0x2207, 0x0000},
+  {"nacute", 0x0144, 0x0000}, {"nang", 0x2220, 0x20D2}, {"nap", 0x2249, 0x0000},
+  {"napE", 0x2A70, 0x0338}, {"napid", 0x224B, 0x0338}, {"napos", 0x0149, 0x0000},
+  {"napprox", 0x2249, 0x0000}, {"natur", 0x266E, 0x0000}, {"natural", 0x266E, 0x0000},
+  {"naturals", 0x2115, 0x0000}, {"nbsp", 0x00A0, 0x0000}, {"nbump", 0x224E, 0x0338},
+  {"nbumpe", 0x224F, 0x0338}, {"ncap", 0x2A43, 0x0000}, {"ncaron", 0x0148, 0x0000},
+  {"ncedil", 0x0146, 0x0000}, {"ncong", 0x2247, 0x0000}, {"ncongdot", 0x2A6D, 0x0338},
+  {"ncup", 0x2A42, 0x0000}, {"ncy", 0x043D, 0x0000}, {"ndash", 0x2013, 0x0000},
+  {"ne", 0x2260, 0x0000}, {"neArr", 0x21D7, 0x0000}, {"nearhk", 0x2924, 0x0000},
+  {"nearr", 0x2197, 0x0000}, {"nearrow", 0x2197, 0x0000}, {"nedot", 0x2250, 0x0338},
+  {"nequiv", 0x2262, 0x0000}, {"nesear", 0x2928, 0x0000}, {"nesim", 0x2242, 0x0338},
+  {"nexist", 0x2204, 0x0000}, {"nexists", 0x2204, 0x0000}, {"nfr", 0x1D52B, 0x0000},
+  {"ngE", 0x2267, 0x0338}, {"nge", 0x2271, 0x0000}, {"ngeq", 0x2271, 0x0000},
+  {"ngeqq", 0x2267, 0x0338}, {"ngeqslant", 0x2A7E, 0x0338}, {"nges", 0x2A7E, 0x0338},
+  {"ngsim", 0x2275, 0x0000}, {"ngt", 0x226F, 0x0000}, {"ngtr", 0x226F, 0x0000},
+  {"nhArr", 0x21CE, 0x0000}, {"nharr", 0x21AE, 0x0000}, {"nhpar", 0x2AF2, 0x0000},
+  {"ni", 0x220B, 0x0000}, {"nis", 0x22FC, 0x0000}, {"nisd", 0x22FA, 0x0000},
+  {"niv", 0x220B, 0x0000}, {"njcy", 0x045A, 0x0000}, {"nlArr", 0x21CD, 0x0000},
+  {"nlE", 0x2266, 0x0338}, {"nlarr", 0x219A, 0x0000}, {"nldr", 0x2025, 0x0000},
+  {"nle", 0x2270, 0x0000}, {"nleftarrow", 0x219A, 0x0000}, {"nleftrightarrow", 0x21AE, 0x0000},
+  {"nleq", 0x2270, 0x0000}, {"nleqq", 0x2266, 0x0338}, {"nleqslant", 0x2A7D, 0x0338},
+  {"nles", 0x2A7D, 0x0338}, {"nless", 0x226E, 0x0000}, {"nlsim", 0x2274, 0x0000},
+  {"nlt", 0x226E, 0x0000}, {"nltri", 0x22EA, 0x0000}, {"nltrie", 0x22EC, 0x0000},
+  {"nmid", 0x2224, 0x0000}, {"nopf", 0x1D55F, 0x0000}, {"not", 0x00AC, 0x0000},
+  {"notin", 0x2209, 0x0000}, {"notinE", 0x22F9, 0x0338}, {"notindot", 0x22F5, 0x0338},
+  {"notinva", 0x2209, 0x0000}, {"notinvb", 0x22F7, 0x0000}, {"notinvc", 0x22F6, 0x0000},
+  {"notni", 0x220C, 0x0000}, {"notniva", 0x220C, 0x0000}, {"notnivb", 0x22FE, 0x0000},
+  {"notnivc", 0x22FD, 0x0000}, {"npar", 0x2226, 0x0000}, {"nparallel", 0x2226, 0x0000},
+  {"nparsl", 0x2AFD, 0x20E5}, {"npart", 0x2202, 0x0338}, {"npolint", 0x2A14, 0x0000},
+  {"npr", 0x2280, 0x0000}, {"nprcue", 0x22E0, 0x0000}, {"npre", 0x2AAF, 0x0338},
+  {"nprec", 0x2280, 0x0000}, {"npreceq", 0x2AAF, 0x0338}, {"nrArr", 0x21CF, 0x0000},
+  {"nrarr", 0x219B, 0x0000}, {"nrarrc", 0x2933, 0x0338}, {"nrarrw", 0x219D, 0x0338},
+  {"nrightarrow", 0x219B, 0x0000}, {"nrtri", 0x22EB, 0x0000}, {"nrtrie", 0x22ED, 0x0000},
+  {"nsc", 0x2281, 0x0000}, {"nsccue", 0x22E1, 0x0000}, {"nsce", 0x2AB0, 0x0338},
+  {"nscr", 0x1D4C3, 0x0000}, {"nshortmid", 0x2224, 0x0000}, {"nshortparallel", 0x2226, 0x0000},
+  {"nsim", 0x2241, 0x0000}, {"nsime", 0x2244, 0x0000}, {"nsimeq", 0x2244, 0x0000},
+  {"nsmid", 0x2224, 0x0000}, {"nspar", 0x2226, 0x0000}, {"nsqsube", 0x22E2, 0x0000},
+  {"nsqsupe", 0x22E3, 0x0000}, {"nsub", 0x2284, 0x0000}, {"nsubE", 0x2AC5, 0x0338},
+  {"nsube", 0x2288, 0x0000}, {"nsubset", 0x2282, 0x20D2}, {"nsubseteq", 0x2288, 0x0000},
+  {"nsubseteqq", 0x2AC5, 0x0338}, {"nsucc", 0x2281, 0x0000}, {"nsucceq", 0x2AB0, 0x0338},
+  {"nsup", 0x2285, 0x0000}, {"nsupE", 0x2AC6, 0x0338}, {"nsupe", 0x2289, 0x0000},
+  {"nsupset", 0x2283, 0x20D2}, {"nsupseteq", 0x2289, 0x0000}, {"nsupseteqq", 0x2AC6, 0x0338},
+  {"ntgl", 0x2279, 0x0000}, {"ntilde", 0x00F1, 0x0000}, {"ntlg", 0x2278, 0x0000},
+  {"ntriangleleft", 0x22EA, 0x0000}, {"ntrianglelefteq", 0x22EC, 0x0000},
+  {"ntriangleright", 0x22EB, 0x0000}, {"ntrianglerighteq", 0x22ED, 0x0000}, {"nu", 0x03BD, 0x0000},
+  {"num", 0x0023, 0x0000}, {"numero", 0x2116, 0x0000}, {"numsp", 0x2007, 0x0000},
+  {"nvDash", 0x22AD, 0x0000}, {"nvHarr", 0x2904, 0x0000}, {"nvap", 0x224D, 0x20D2},
+  {"nvdash", 0x22AC, 0x0000}, {"nvge", 0x2265, 0x20D2}, {"nvgt", 0x003E, 0x20D2},
+  {"nvinfin", 0x29DE, 0x0000}, {"nvlArr", 0x2902, 0x0000}, {"nvle", 0x2264, 0x20D2},
+  {"nvlt", 0x003C, 0x20D2}, {"nvltrie", 0x22B4, 0x20D2}, {"nvrArr", 0x2903, 0x0000},
+  {"nvrtrie", 0x22B5, 0x20D2}, {"nvsim", 0x223C, 0x20D2}, {"nwArr", 0x21D6, 0x0000},
+  {"nwarhk", 0x2923, 0x0000}, {"nwarr", 0x2196, 0x0000}, {"nwarrow", 0x2196, 0x0000},
+  {"nwnear", 0x2927, 0x0000}, {"oS", 0x24C8, 0x0000}, {"oacute", 0x00F3, 0x0000},
+  {"oast", 0x229B, 0x0000}, {"ocir", 0x229A, 0x0000}, {"ocirc", 0x00F4, 0x0000},
+  {"ocy", 0x043E, 0x0000}, {"odash", 0x229D, 0x0000}, {"odblac", 0x0151, 0x0000},
+  {"odiv", 0x2A38, 0x0000}, {"odot", 0x2299, 0x0000}, {"odsold", 0x29BC, 0x0000},
+  {"oelig", 0x0153, 0x0000}, {"ofcir", 0x29BF, 0x0000}, {"ofr", 0x1D52C, 0x0000},
+  {"ogon", 0x02DB, 0x0000}, {"ograve", 0x00F2, 0x0000}, {"ogt", 0x29C1, 0x0000},
+  {"ohbar", 0x29B5, 0x0000}, {"ohm", 0x03A9, 0x0000}, {"oint", 0x222E, 0x0000},
+  {"olarr", 0x21BA, 0x0000}, {"olcir", 0x29BE, 0x0000}, {"olcross", 0x29BB, 0x0000},
+  {"oline", 0x203E, 0x0000}, {"olt", 0x29C0, 0x0000}, {"omacr", 0x014D, 0x0000},
+  {"omega", 0x03C9, 0x0000}, {"omicron", 0x03BF, 0x0000}, {"omid", 0x29B6, 0x0000},
+  {"ominus", 0x2296, 0x0000}, {"oopf", 0x1D560, 0x0000}, {"opar", 0x29B7, 0x0000},
+  {"operp", 0x29B9, 0x0000}, {"oplus", 0x2295, 0x0000}, {"or", 0x2228, 0x0000},
+  {"orarr", 0x21BB, 0x0000}, {"ord", 0x2A5D, 0x0000}, {"order", 0x2134, 0x0000},
+  {"orderof", 0x2134, 0x0000}, {"ordf", 0x00AA, 0x0000}, {"ordm", 0x00BA, 0x0000},
+  {"origof", 0x22B6, 0x0000}, {"oror", 0x2A56, 0x0000}, {"orslope", 0x2A57, 0x0000},
+  {"orv", 0x2A5B, 0x0000}, {"oscr", 0x2134, 0x0000}, {"oslash", 0x00F8, 0x0000},
+  {"osol", 0x2298, 0x0000}, {"otilde", 0x00F5, 0x0000}, {"otimes", 0x2297, 0x0000},
+  {"otimesas", 0x2A36, 0x0000}, {"ouml", 0x00F6, 0x0000}, {"ovbar", 0x233D, 0x0000},
+  {"par", 0x2225, 0x0000}, {"para", 0x00B6, 0x0000}, {"parallel", 0x2225, 0x0000},
+  {"parsim", 0x2AF3, 0x0000}, {"parsl", 0x2AFD, 0x0000}, {"part", 0x2202, 0x0000},
+  {"pcy", 0x043F, 0x0000}, {"percnt", 0x0025, 0x0000}, {"period", 0x002E, 0x0000},
+  {"permil", 0x2030, 0x0000}, {"perp", 0x22A5, 0x0000}, {"pertenk", 0x2031, 0x0000},
+  {"pfr", 0x1D52D, 0x0000}, {"phi", 0x03C6, 0x0000}, {"phiv", 0x03D5, 0x0000},
+  {"phmmat", 0x2133, 0x0000}, {"phone", 0x260E, 0x0000}, {"pi", 0x03C0, 0x0000},
+  {"pitchfork", 0x22D4, 0x0000}, {"piv", 0x03D6, 0x0000}, {"planck", 0x210F, 0x0000},
+  {"planckh", 0x210E, 0x0000}, {"plankv", 0x210F, 0x0000}, {"plus", 0x002B, 0x0000},
+  {"plusacir", 0x2A23, 0x0000}, {"plusb", 0x229E, 0x0000}, {"pluscir", 0x2A22, 0x0000},
+  {"plusdo", 0x2214, 0x0000}, {"plusdu", 0x2A25, 0x0000}, {"pluse", 0x2A72, 0x0000},
+  {"plusmn", 0x00B1, 0x0000}, {"plussim", 0x2A26, 0x0000}, {"plustwo", 0x2A27, 0x0000},
+  {"pm", 0x00B1, 0x0000}, {"pointint", 0x2A15, 0x0000}, {"popf", 0x1D561, 0x0000},
+  {"pound", 0x00A3, 0x0000}, {"pr", 0x227A, 0x0000}, {"prE", 0x2AB3, 0x0000},
+  {"prap", 0x2AB7, 0x0000}, {"prcue", 0x227C, 0x0000}, {"pre", 0x2AAF, 0x0000},
+  {"prec", 0x227A, 0x0000}, {"precapprox", 0x2AB7, 0x0000}, {"preccurlyeq", 0x227C, 0x0000},
+  {"preceq", 0x2AAF, 0x0000}, {"precnapprox", 0x2AB9, 0x0000}, {"precneqq", 0x2AB5, 0x0000},
+  {"precnsim", 0x22E8, 0x0000}, {"precsim", 0x227E, 0x0000}, {"prime", 0x2032, 0x0000},
+  {"primes", 0x2119, 0x0000}, {"prnE", 0x2AB5, 0x0000}, {"prnap", 0x2AB9, 0x0000},
+  {"prnsim", 0x22E8, 0x0000}, {"prod", 0x220F, 0x0000}, {"profalar", 0x232E, 0x0000},
+  {"profline", 0x2312, 0x0000}, {"profsurf", 0x2313, 0x0000}, {"prop", 0x221D, 0x0000},
+  {"propto", 0x221D, 0x0000}, {"prsim", 0x227E, 0x0000}, {"prurel", 0x22B0, 0x0000},
+  {"pscr", 0x1D4C5, 0x0000}, {"psi", 0x03C8, 0x0000}, {"puncsp", 0x2008, 0x0000},
+  {"qfr", 0x1D52E, 0x0000}, {"qint", 0x2A0C, 0x0000}, {"qopf", 0x1D562, 0x0000},
+  {"qprime", 0x2057, 0x0000}, {"qscr", 0x1D4C6, 0x0000}, {"quaternions", 0x210D, 0x0000},
+  {"quatint", 0x2A16, 0x0000}, {"quest", 0x003F, 0x0000}, {"questeq", 0x225F, 0x0000},
+  {"quot", 0x0022, 0x0000}, {"rAarr", 0x21DB, 0x0000}, {"rArr", 0x21D2, 0x0000},
+  {"rAtail", 0x291C, 0x0000}, {"rBarr", 0x290F, 0x0000}, {"rHar", 0x2964, 0x0000},
+  {"race", 0x223D, 0x0331}, {"racute", 0x0155, 0x0000}, {"radic", 0x221A, 0x0000},
+  {"raemptyv", 0x29B3, 0x0000}, {"rang", 0x27E9, 0x0000}, {"rangd", 0x2992, 0x0000},
+  {"range", 0x29A5, 0x0000}, {"rangle", 0x27E9, 0x0000}, {"raquo", 0x00BB, 0x0000},
+  {"rarr", 0x2192, 0x0000}, {"rarrap", 0x2975, 0x0000}, {"rarrb", 0x21E5, 0x0000},
+  {"rarrbfs", 0x2920, 0x0000}, {"rarrc", 0x2933, 0x0000}, {"rarrfs", 0x291E, 0x0000},
+  {"rarrhk", 0x21AA, 0x0000}, {"rarrlp", 0x21AC, 0x0000}, {"rarrpl", 0x2945, 0x0000},
+  {"rarrsim", 0x2974, 0x0000}, {"rarrtl", 0x21A3, 0x0000}, {"rarrw", 0x219D, 0x0000},
+  {"ratail", 0x291A, 0x0000}, {"ratio", 0x2236, 0x0000}, {"rationals", 0x211A, 0x0000},
+  {"rbarr", 0x290D, 0x0000}, {"rbbrk", 0x2773, 0x0000}, {"rbrace", 0x007D, 0x0000},
+  {"rbrack", 0x005D, 0x0000}, {"rbrke", 0x298C, 0x0000}, {"rbrksld", 0x298E, 0x0000},
+  {"rbrkslu", 0x2990, 0x0000}, {"rcaron", 0x0159, 0x0000}, {"rcedil", 0x0157, 0x0000},
+  {"rceil", 0x2309, 0x0000}, {"rcub", 0x007D, 0x0000}, {"rcy", 0x0440, 0x0000},
+  {"rdca", 0x2937, 0x0000}, {"rdldhar", 0x2969, 0x0000}, {"rdquo", 0x201D, 0x0000},
+  {"rdquor", 0x201D, 0x0000}, {"rdsh", 0x21B3, 0x0000}, {"real", 0x211C, 0x0000},
+  {"realine", 0x211B, 0x0000}, {"realpart", 0x211C, 0x0000}, {"reals", 0x211D, 0x0000},
+  {"rect", 0x25AD, 0x0000}, {"reg", 0x00AE, 0x0000}, {"rfisht", 0x297D, 0x0000},
+  {"rfloor", 0x230B, 0x0000}, {"rfr", 0x1D52F, 0x0000}, {"rhard", 0x21C1, 0x0000},
+  {"rharu", 0x21C0, 0x0000}, {"rharul", 0x296C, 0x0000}, {"rho", 0x03C1, 0x0000},
+  {"rhov", 0x03F1, 0x0000}, {"rightarrow", 0x2192, 0x0000}, {"rightarrowtail", 0x21A3, 0x0000},
+  {"rightharpoondown", 0x21C1, 0x0000}, {"rightharpoonup", 0x21C0, 0x0000},
+  {"rightleftarrows", 0x21C4, 0x0000}, {"rightleftharpoons", 0x21CC, 0x0000},
+  {"rightrightarrows", 0x21C9, 0x0000}, {"rightsquigarrow", 0x219D, 0x0000},
+  {"rightthreetimes", 0x22CC, 0x0000}, {"ring", 0x02DA, 0x0000}, {"risingdotseq", 0x2253, 0x0000},
+  {"rlarr", 0x21C4, 0x0000}, {"rlhar", 0x21CC, 0x0000}, {"rlm", 0x200F, 0x0000},
+  {"rmoust", 0x23B1, 0x0000}, {"rmoustache", 0x23B1, 0x0000}, {"rnmid", 0x2AEE, 0x0000},
+  {"roang", 0x27ED, 0x0000}, {"roarr", 0x21FE, 0x0000}, {"robrk", 0x27E7, 0x0000},
+  {"ropar", 0x2986, 0x0000}, {"ropf", 0x1D563, 0x0000}, {"roplus", 0x2A2E, 0x0000},
+  {"rotimes", 0x2A35, 0x0000}, {"rpar", 0x0029, 0x0000}, {"rpargt", 0x2994, 0x0000},
+  {"rppolint", 0x2A12, 0x0000}, {"rrarr", 0x21C9, 0x0000}, {"rsaquo", 0x203A, 0x0000},
+  {"rscr", 0x1D4C7, 0x0000}, {"rsh", 0x21B1, 0x0000}, {"rsqb", 0x005D, 0x0000},
+  {"rsquo", 0x2019, 0x0000}, {"rsquor", 0x2019, 0x0000}, {"rthree", 0x22CC, 0x0000},
+  {"rtimes", 0x22CA, 0x0000}, {"rtri", 0x25B9, 0x0000}, {"rtrie", 0x22B5, 0x0000},
+  {"rtrif", 0x25B8, 0x0000}, {"rtriltri", 0x29CE, 0x0000}, {"ruluhar", 0x2968, 0x0000},
+  {"rx", 0x211E, 0x0000}, {"sacute", 0x015B, 0x0000}, {"sbquo", 0x201A, 0x0000},
+  {"sc", 0x227B, 0x0000}, {"scE", 0x2AB4, 0x0000}, {"scap", 0x2AB8, 0x0000},
+  {"scaron", 0x0161, 0x0000}, {"sccue", 0x227D, 0x0000}, {"sce", 0x2AB0, 0x0000},
+  {"scedil", 0x015F, 0x0000}, {"scirc", 0x015D, 0x0000}, {"scnE", 0x2AB6, 0x0000},
+  {"scnap", 0x2ABA, 0x0000}, {"scnsim", 0x22E9, 0x0000}, {"scpolint", 0x2A13, 0x0000},
+  {"scsim", 0x227F, 0x0000}, {"scy", 0x0441, 0x0000}, {"sdot", 0x22C5, 0x0000},
+  {"sdotb", 0x22A1, 0x0000}, {"sdote", 0x2A66, 0x0000}, {"seArr", 0x21D8, 0x0000},
+  {"searhk", 0x2925, 0x0000}, {"searr", 0x2198, 0x0000}, {"searrow", 0x2198, 0x0000},
+  {"sect", 0x00A7, 0x0000}, {"semi", 0x003B, 0x0000}, {"seswar", 0x2929, 0x0000},
+  {"setminus", 0x2216, 0x0000}, {"setmn", 0x2216, 0x0000}, {"sext", 0x2736, 0x0000},
+  {"sfr", 0x1D530, 0x0000}, {"sfrown", 0x2322, 0x0000}, {"sharp", 0x266F, 0x0000},
+  {"shchcy", 0x0449, 0x0000}, {"shcy", 0x0448, 0x0000}, {"shortmid", 0x2223, 0x0000},
+  {"shortparallel", 0x2225, 0x0000}, {"shy", 0x00AD, 0x0000}, {"sigma", 0x03C3, 0x0000},
+  {"sigmaf", 0x03C2, 0x0000}, {"sigmav", 0x03C2, 0x0000}, {"sim", 0x223C, 0x0000},
+  {"simdot", 0x2A6A, 0x0000}, {"sime", 0x2243, 0x0000}, {"simeq", 0x2243, 0x0000},
+  {"simg", 0x2A9E, 0x0000}, {"simgE", 0x2AA0, 0x0000}, {"siml", 0x2A9D, 0x0000},
+  {"simlE", 0x2A9F, 0x0000}, {"simne", 0x2246, 0x0000}, {"simplus", 0x2A24, 0x0000},
+  {"simrarr", 0x2972, 0x0000}, {"slarr", 0x2190, 0x0000}, {"smallsetminus", 0x2216, 0x0000},
+  {"smashp", 0x2A33, 0x0000}, {"smeparsl", 0x29E4, 0x0000}, {"smid", 0x2223, 0x0000},
+  {"smile", 0x2323, 0x0000}, {"smt", 0x2AAA, 0x0000}, {"smte", 0x2AAC, 0x0000},
+  {"smtes", 0x2AAC, 0xFE00}, {"softcy", 0x044C, 0x0000}, {"sol", 0x002F, 0x0000},
+  {"solb", 0x29C4, 0x0000}, {"solbar", 0x233F, 0x0000}, {"sopf", 0x1D564, 0x0000},
+  {"spades", 0x2660, 0x0000}, {"spadesuit", 0x2660, 0x0000}, {"spar", 0x2225, 0x0000},
+  {"sqcap", 0x2293, 0x0000}, {"sqcaps", 0x2293, 0xFE00}, {"sqcup", 0x2294, 0x0000},
+  {"sqcups", 0x2294, 0xFE00}, {"sqsub", 0x228F, 0x0000}, {"sqsube", 0x2291, 0x0000},
+  {"sqsubset", 0x228F, 0x0000}, {"sqsubseteq", 0x2291, 0x0000}, {"sqsup", 0x2290, 0x0000},
+  {"sqsupe", 0x2292, 0x0000}, {"sqsupset", 0x2290, 0x0000}, {"sqsupseteq", 0x2292, 0x0000},
+  {"squ", 0x25A1, 0x0000}, {"square", 0x25A1, 0x0000}, {"squarf", 0x25AA, 0x0000},
+  {"squf", 0x25AA, 0x0000}, {"srarr", 0x2192, 0x0000}, {"sscr", 0x1D4C8, 0x0000},
+  {"ssetmn", 0x2216, 0x0000}, {"ssmile", 0x2323, 0x0000}, {"sstarf", 0x22C6, 0x0000},
+  {"star", 0x2606, 0x0000}, {"starf", 0x2605, 0x0000}, {"straightepsilon", 0x03F5, 0x0000},
+  {"straightphi", 0x03D5, 0x0000}, {"strns", 0x00AF, 0x0000}, {"sub", 0x2282, 0x0000},
+  {"subE", 0x2AC5, 0x0000}, {"subdot", 0x2ABD, 0x0000}, {"sube", 0x2286, 0x0000},
+  {"subedot", 0x2AC3, 0x0000}, {"submult", 0x2AC1, 0x0000}, {"subnE", 0x2ACB, 0x0000},
+  {"subne", 0x228A, 0x0000}, {"subplus", 0x2ABF, 0x0000}, {"subrarr", 0x2979, 0x0000},
+  {"subset", 0x2282, 0x0000}, {"subseteq", 0x2286, 0x0000}, {"subseteqq", 0x2AC5, 0x0000},
+  {"subsetneq", 0x228A, 0x0000}, {"subsetneqq", 0x2ACB, 0x0000}, {"subsim", 0x2AC7, 0x0000},
+  {"subsub", 0x2AD5, 0x0000}, {"subsup", 0x2AD3, 0x0000}, {"succ", 0x227B, 0x0000},
+  {"succapprox", 0x2AB8, 0x0000}, {"succcurlyeq", 0x227D, 0x0000}, {"succeq", 0x2AB0, 0x0000},
+  {"succnapprox", 0x2ABA, 0x0000}, {"succneqq", 0x2AB6, 0x0000}, {"succnsim", 0x22E9, 0x0000},
+  {"succsim", 0x227F, 0x0000}, {"sum", 0x2211, 0x0000}, {"sung", 0x266A, 0x0000},
+  {"sup", 0x2283, 0x0000}, {"sup1", 0x00B9, 0x0000}, {"sup2", 0x00B2, 0x0000},
+  {"sup3", 0x00B3, 0x0000}, {"supE", 0x2AC6, 0x0000}, {"supdot", 0x2ABE, 0x0000},
+  {"supdsub", 0x2AD8, 0x0000}, {"supe", 0x2287, 0x0000}, {"supedot", 0x2AC4, 0x0000},
+  {"suphsol", 0x27C9, 0x0000}, {"suphsub", 0x2AD7, 0x0000}, {"suplarr", 0x297B, 0x0000},
+  {"supmult", 0x2AC2, 0x0000}, {"supnE", 0x2ACC, 0x0000}, {"supne", 0x228B, 0x0000},
+  {"supplus", 0x2AC0, 0x0000}, {"supset", 0x2283, 0x0000}, {"supseteq", 0x2287, 0x0000},
+  {"supseteqq", 0x2AC6, 0x0000}, {"supsetneq", 0x228B, 0x0000}, {"supsetneqq", 0x2ACC, 0x0000},
+  {"supsim", 0x2AC8, 0x0000}, {"supsub", 0x2AD4, 0x0000}, {"supsup", 0x2AD6, 0x0000},
+  {"swArr", 0x21D9, 0x0000}, {"swarhk", 0x2926, 0x0000}, {"swarr", 0x2199, 0x0000},
+  {"swarrow", 0x2199, 0x0000}, {"swnwar", 0x292A, 0x0000}, {"szlig", 0x00DF, 0x0000},
+  {"target", 0x2316, 0x0000}, {"tau", 0x03C4, 0x0000}, {"tbrk", 0x23B4, 0x0000},
+  {"tcaron", 0x0165, 0x0000}, {"tcedil", 0x0163, 0x0000}, {"tcy", 0x0442, 0x0000},
+  {"tdot", 0x20DB, 0x0000}, {"telrec", 0x2315, 0x0000}, {"tfr", 0x1D531, 0x0000},
+  {"there4", 0x2234, 0x0000}, {"therefore", 0x2234, 0x0000}, {"theta", 0x03B8, 0x0000},
+  {"thetasym", 0x03D1, 0x0000}, {"thetav", 0x03D1, 0x0000}, {"thickapprox", 0x2248, 0x0000},
+  {"thicksim", 0x223C, 0x0000}, {"thinsp", 0x2009, 0x0000}, {"thkap", 0x2248, 0x0000},
+  {"thksim", 0x223C, 0x0000}, {"thorn", 0x00FE, 0x0000}, {"tilde", 0x02DC, 0x0000},
+  {"times", 0x00D7, 0x0000}, {"timesb", 0x22A0, 0x0000}, {"timesbar", 0x2A31, 0x0000},
+  {"timesd", 0x2A30, 0x0000}, {"tint", 0x222D, 0x0000}, {"toea", 0x2928, 0x0000},
+  {"top", 0x22A4, 0x0000}, {"topbot", 0x2336, 0x0000}, {"topcir", 0x2AF1, 0x0000},
+  {"topf", 0x1D565, 0x0000}, {"topfork", 0x2ADA, 0x0000}, {"tosa", 0x2929, 0x0000},
+  {"tprime", 0x2034, 0x0000}, {"trade", 0x2122, 0x0000}, {"triangle", 0x25B5, 0x0000},
+  {"triangledown", 0x25BF, 0x0000}, {"triangleleft", 0x25C3, 0x0000},
+  {"trianglelefteq", 0x22B4, 0x0000}, {"triangleq", 0x225C, 0x0000},
+  {"triangleright", 0x25B9, 0x0000}, {"trianglerighteq", 0x22B5, 0x0000},
+  {"tridot", 0x25EC, 0x0000}, {"trie", 0x225C, 0x0000}, {"triminus", 0x2A3A, 0x0000},
+  {"triplus", 0x2A39, 0x0000}, {"trisb", 0x29CD, 0x0000}, {"tritime", 0x2A3B, 0x0000},
+  {"trpezium", 0x23E2, 0x0000}, {"tscr", 0x1D4C9, 0x0000}, {"tscy", 0x0446, 0x0000},
+  {"tshcy", 0x045B, 0x0000}, {"tstrok", 0x0167, 0x0000}, {"twixt", 0x226C, 0x0000},
+  {"twoheadleftarrow", 0x219E, 0x0000}, {"twoheadrightarrow", 0x21A0, 0x0000},
+  {"uArr", 0x21D1, 0x0000}, {"uHar", 0x2963, 0x0000}, {"uacute", 0x00FA, 0x0000},
+  {"uarr", 0x2191, 0x0000}, {"ubrcy", 0x045E, 0x0000}, {"ubreve", 0x016D, 0x0000},
+  {"ucirc", 0x00FB, 0x0000}, {"ucy", 0x0443, 0x0000}, {"udarr", 0x21C5, 0x0000},
+  {"udblac", 0x0171, 0x0000}, {"udhar", 0x296E, 0x0000}, {"ufisht", 0x297E, 0x0000},
+  {"ufr", 0x1D532, 0x0000}, {"ugrave", 0x00F9, 0x0000}, {"uharl", 0x21BF, 0x0000},
+  {"uharr", 0x21BE, 0x0000}, {"uhblk", 0x2580, 0x0000}, {"ulcorn", 0x231C, 0x0000},
+  {"ulcorner", 0x231C, 0x0000}, {"ulcrop", 0x230F, 0x0000}, {"ultri", 0x25F8, 0x0000},
+  {"umacr", 0x016B, 0x0000}, {"uml", 0x00A8, 0x0000}, {"uogon", 0x0173, 0x0000},
+  {"uopf", 0x1D566, 0x0000}, {"uparrow", 0x2191, 0x0000}, {"updownarrow", 0x2195, 0x0000},
+  {"upharpoonleft", 0x21BF, 0x0000}, {"upharpoonright", 0x21BE, 0x0000}, {"uplus", 0x228E, 0x0000},
+  {"upsi", 0x03C5, 0x0000}, {"upsih", 0x03D2, 0x0000}, {"upsilon", 0x03C5, 0x0000},
+  {"upuparrows", 0x21C8, 0x0000}, {"urcorn", 0x231D, 0x0000}, {"urcorner", 0x231D, 0x0000},
+  {"urcrop", 0x230E, 0x0000}, {"uring", 0x016F, 0x0000}, {"urtri", 0x25F9, 0x0000},
+  {"uscr", 0x1D4CA, 0x0000}, {"utdot", 0x22F0, 0x0000}, {"utilde", 0x0169, 0x0000},
+  {"utri", 0x25B5, 0x0000}, {"utrif", 0x25B4, 0x0000}, {"uuarr", 0x21C8, 0x0000},
+  {"uuml", 0x00FC, 0x0000}, {"uwangle", 0x29A7, 0x0000}, {"vArr", 0x21D5, 0x0000},
+  {"vBar", 0x2AE8, 0x0000}, {"vBarv", 0x2AE9, 0x0000}, {"vDash", 0x22A8, 0x0000},
+  {"vangrt", 0x299C, 0x0000}, {"varepsilon", 0x03F5, 0x0000}, {"varkappa", 0x03F0, 0x0000},
+  {"varnothing", 0x2205, 0x0000}, {"varphi", 0x03D5, 0x0000}, {"varpi", 0x03D6, 0x0000},
+  {"varpropto", 0x221D, 0x0000}, {"varr", 0x2195, 0x0000}, {"varrho", 0x03F1, 0x0000},
+  {"varsigma", 0x03C2, 0x0000}, {"varsubsetneq", 0x228A, 0xFE00},
+  {"varsubsetneqq", 0x2ACB, 0xFE00}, {"varsupsetneq", 0x228B, 0xFE00},
+  {"varsupsetneqq", 0x2ACC, 0xFE00}, {"vartheta", 0x03D1, 0x0000},
+  {"vartriangleleft", 0x22B2, 0x0000}, {"vartriangleright", 0x22B3, 0x0000},
+  {"vcy", 0x0432, 0x0000}, {"vdash", 0x22A2, 0x0000}, {"vee", 0x2228, 0x0000},
+  {"veebar", 0x22BB, 0x0000}, {"veeeq", 0x225A, 0x0000}, {"vellip", 0x22EE, 0x0000},
+  {"verbar", 0x007C, 0x0000}, {"vert", 0x007C, 0x0000}, {"vfr", 0x1D533, 0x0000},
+  {"vltri", 0x22B2, 0x0000}, {"vnsub", 0x2282, 0x20D2}, {"vnsup", 0x2283, 0x20D2},
+  {"vopf", 0x1D567, 0x0000}, {"vprop", 0x221D, 0x0000}, {"vrtri", 0x22B3, 0x0000},
+  {"vscr", 0x1D4CB, 0x0000}, {"vsubnE", 0x2ACB, 0xFE00}, {"vsubne", 0x228A, 0xFE00},
+  {"vsupnE", 0x2ACC, 0xFE00}, {"vsupne", 0x228B, 0xFE00}, {"vzigzag", 0x299A, 0x0000},
+  {"wcirc", 0x0175, 0x0000}, {"wedbar", 0x2A5F, 0x0000}, {"wedge", 0x2227, 0x0000},
+  {"wedgeq", 0x2259, 0x0000}, {"weierp", 0x2118, 0x0000}, {"wfr", 0x1D534, 0x0000},
+  {"wopf", 0x1D568, 0x0000}, {"wp", 0x2118, 0x0000}, {"wr", 0x2240, 0x0000},
+  {"wreath", 0x2240, 0x0000}, {"wscr", 0x1D4CC, 0x0000}, {"xcap", 0x22C2, 0x0000},
+  {"xcirc", 0x25EF, 0x0000}, {"xcup", 0x22C3, 0x0000}, {"xdtri", 0x25BD, 0x0000},
+  {"xfr", 0x1D535, 0x0000}, {"xhArr", 0x27FA, 0x0000}, {"xharr", 0x27F7, 0x0000},
+  {"xi", 0x03BE, 0x0000}, {"xlArr", 0x27F8, 0x0000}, {"xlarr", 0x27F5, 0x0000},
+  {"xmap", 0x27FC, 0x0000}, {"xnis", 0x22FB, 0x0000}, {"xodot", 0x2A00, 0x0000},
+  {"xopf", 0x1D569, 0x0000}, {"xoplus", 0x2A01, 0x0000}, {"xotime", 0x2A02, 0x0000},
+  {"xrArr", 0x27F9, 0x0000}, {"xrarr", 0x27F6, 0x0000}, {"xscr", 0x1D4CD, 0x0000},
+  {"xsqcup", 0x2A06, 0x0000}, {"xuplus", 0x2A04, 0x0000}, {"xutri", 0x25B3, 0x0000},
+  {"xvee", 0x22C1, 0x0000}, {"xwedge", 0x22C0, 0x0000}, {"yacute", 0x00FD, 0x0000},
+  {"yacy", 0x044F, 0x0000}, {"ycirc", 0x0177, 0x0000}, {"ycy", 0x044B, 0x0000},
+  {"yen", 0x00A5, 0x0000}, {"yfr", 0x1D536, 0x0000}, {"yicy", 0x0457, 0x0000},
+  {"yopf", 0x1D56A, 0x0000}, {"yscr", 0x1D4CE, 0x0000}, {"yucy", 0x044E, 0x0000},
+  {"yuml", 0x00FF, 0x0000}, {"zacute", 0x017A, 0x0000}, {"zcaron", 0x017E, 0x0000},
+  {"zcy", 0x0437, 0x0000}, {"zdot", 0x017C, 0x0000}, {"zeetrf", 0x2128, 0x0000},
+  {"zeta", 0x03B6, 0x0000}, {"zfr", 0x1D537, 0x0000}, {"zhcy", 0x0436, 0x0000},
+  {"zigrarr", 0x21DD, 0x0000}, {"zopf", 0x1D56B, 0x0000}, {"zscr", 0x1D4CF, 0x0000},
+  {"zwj", 0x200D, 0x0000}, {"zwnj", 0x200C, 0x0000}
+};
+
+static const uint8_t HTML_ENTITY_SEEDS[1024] = 
+{
+  0, 0, 3, 0, 3, 0, 5, 0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0,
+  0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 1, 1, 6, 3, 0,
+  4, 6, 1, 2, 0, 1, 1, 5, 0, 0, 5, 0, 2, 0, 0, 0, 2, 0, 0, 1,
+  0, 0, 0, 2, 1, 0, 0, 0, 1, 1, 0, 2, 0, 3, 0, 0, 0, 1, 0, 0,
+  2, 0, 0, 2, 0, 1, 0, 1, 1, 2, 0, 2, 0, 0, 2, 0, 1, 3, 0, 0,
+  2, 2, 2, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 5, 2, 0, 0, 0, 1,
+  0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+  0, 0, 2, 1, 0, 0, 1, 0, 0, 2, 3, 2, 0, 0, 0, 0, 0, 1, 4, 2,
+  1, 0, 3, 2, 0, 0, 0, 0, 2, 0, 0, 1, 0, 1, 2, 0, 1, 0, 1, 0,
+  0, 1, 0, 0, 1, 1, 0, 0, 1, 2, 1, 0, 0, 0, 3, 5, 2, 0, 0, 0,
+  2, 0, 3, 0, 1, 0, 4, 0, 2, 0, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0,
+  0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 2, 1,
+  2, 3, 0, 0, 1, 0, 0, 0, 1, 1, 3, 0, 0, 2, 0, 0, 1, 0, 1, 1,
+  0, 0, 2, 3, 2, 0, 0, 0, 0, 0, 0, 1, 1, 2, 1, 2, 0, 4, 0, 0,
+  0, 0, 0, 0, 0, 7, 0, 0, 1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0,
+  0, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 2, 0, 3, 0, 4,
+  0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 9, 0, 0, 0, 1,
+  1, 0, 0, 2, 0, 1, 1, 0, 1, 3, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0,
+  1, 0, 0, 1, 1, 2, 2, 0, 1, 1, 0, 2, 0, 0, 1, 1, 1, 1, 0, 0,
+  0, 0, 0, 0, 0, 0, 1, 2, 1, 2, 0, 5, 1, 1, 1, 2, 0, 2, 1, 1,
+  1, 2, 0, 0, 3, 1, 1, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 3,
+  0, 0, 1, 1, 1, 1, 0, 1, 4, 0, 1, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+  0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 5, 1, 2, 1, 0,
+  2, 0, 1, 3, 0, 1, 4, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 2,
+  0, 0, 2, 1, 7, 0, 1, 4, 0, 1, 2, 0, 1, 0, 0, 0, 1, 2, 0, 1,
+  0, 5, 0, 2, 1, 6, 0, 0, 0, 0, 1, 3, 4, 0, 0, 1, 1, 0, 6, 1,
+  1, 1, 0, 0, 0, 2, 0, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 2,
+  2, 0, 0, 0, 0, 2, 1, 1, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+  0, 1, 1, 1, 0, 0, 0, 2, 4, 1, 1, 0, 4, 0, 0, 2, 0, 0, 0, 7,
+  0, 0, 2, 0, 2, 3, 0, 3, 0, 0, 0, 0, 0, 0, 2, 5, 0, 0, 2, 0,
+  1, 0, 0, 2, 2, 0, 2, 0, 0, 0, 0, 4, 0, 0, 0, 0, 1, 1, 0, 0,
+  0, 1, 0, 0, 2, 0, 2, 2, 0, 0, 2, 1, 3, 1, 0, 0, 6, 0, 0, 0,
+  0, 1, 1, 6, 0, 3, 5, 6, 1, 1, 0, 0, 3, 0, 0, 1, 0, 2, 3, 3,
+  1, 0, 2, 1, 2, 3, 1, 0, 5, 0, 1, 1, 0, 0, 0, 2, 0, 0, 1, 0,
+  0, 0, 2, 0, 4, 0, 5, 1, 4, 2, 1, 0, 1, 0, 0, 0, 0, 1, 0, 1,
+  0, 0, 5, 0, 2, 1, 1, 2, 0, 0, 0, 0, 4, 0, 6, 0, 0, 5, 3, 4,
+  4, 0, 0, 0, 4, 0, 0, 3, 7, 0, 0, 8, 4, 0, 4, 2, 0, 0, 2, 2,
+  0, 0, 0, 1, 1, 0, 3, 6, 8, 0, 2, 5, 0, 3, 2, 0, 0, 6, 0, 1,
+  0, 0, 0, 0, 0, 0, 3, 0, 2, 0, 1, 1, 6, 0, 0, 5, 0, 1, 2, 1,
+  1, 1, 0, 2, 0, 1, 3, 1, 0, 1, 0, 2, 2, 0, 3, 0, 0, 0, 1, 3,
+  0, 0, 1, 0, 2, 0, 1, 5, 0, 0, 2, 3, 1, 0, 0, 1, 2, 2, 0, 0,
+  4, 0, 2, 0, 0, 0, 0, 1, 1, 2, 3, 0, 0, 2, 1, 1, 0, 3, 0, 0,
+  2, 12, 1, 1, 0, 0, 3, 0, 0, 0, 0, 3, 0, 2, 0, 1, 0, 3, 1, 4,
+  2, 0, 9, 2, 0, 0, 0, 1, 0, 0, 0, 0, 1, 3, 0, 0, 1, 0, 2, 0,
+  0, 2, 0, 0, 2, 1, 4, 2, 1, 2, 0, 3, 2, 1, 8, 0, 0, 0, 2, 0,
+  0, 4, 2, 5, 0, 2, 1, 0, 5, 0, 1, 1, 1, 2, 0, 0, 2, 0, 3, 0,
+  3, 0, 1, 0, 0, 1, 0, 2, 4, 4, 0, 2, 2, 5, 7, 1, 6, 3, 3, 0,
+  3, 0, 4, 18, 0, 0, 1, 2, 3, 0, 0, 1, 0, 0, 9, 4, 9, 0, 0, 0,
+  3, 0, 0, 3, 0, 0, 1, 2, 1, 0, 1, 0, 1, 1, 3, 0, 0, 6, 1, 0,
+  5, 0, 4, 2, 0, 2, 2, 3, 0, 1, 0, 1, 0, 1, 1, 1, 2, 0, 5, 5,
+  2, 2, 0, 0, 1, 0, 0, 1, 0, 0, 0, 2, 2, 5, 2, 0, 0, 0, 1, 0,
+  1, 0, 2, 0
+};
+
+static const int16_t HTML_ENTITY_SLOTS[4096] = 
+{
+  1168, 1332, -1, 707, 1746, 1942, -1, 942, -1, 1035, 2019, 498, 18, -1, 659, -1, 6, -1, -1, -1,
+  -1, -1, 1524, 1596, -1, 1080, 1722, 854, 16, -1, 58, -1, 1771, 191, 1032, 104, -1, -1, -1, 1361,
+  2064, -1, -1, 1046, -1, 665, 1098, -1, -1, 1479, 1644, 913, -1, 1139, 675, -1, 322, 1564, -1, -1,
+  -1, -1, -1, -1, 1295, -1, 1315, -1, 454, 1707, -1, 651, 2013, -1, -1, 1214, -1, -1, -1, 1739,
+  1903, 1331, 1526, 1444, 2000, 1015, -1, -1, -1, -1, 1554, -1, -1, -1, 1495, 1873, 949, -1, -1, 253,
+  1492, -1, 1128, 2096, 1619, 1704, 1842, 1341, -1, 1061, -1, -1, 1981, 958, 548, -1, 1227, 845, -1, 1932,
+  214, 1342, -1, -1, -1, 826, 103, 1668, -1, -1, 800, 450, 174, 911, -1, 2048, -1, -1, -1, -1,
+  2062, -1, -1, 1622, 1218, 609, -1, 1680, -1, 863, -1, 1110, 943, 2091, -1, 1286, 2076, 786, 195, -1,
+  1237, 1929, 1261, 1228, 960, -1, 1654, -1, -1, 1703, -1, -1, 1078, -1, 240, -1, -1, 1300, 1484, 1778,
+  -1, -1, 1042, 597, -1, 2113, 1723, -1, -1, -1, 1947, 99, -1, -1, 833, 674, -1, 721, -1, -1,
+  1468, 1282, -1, -1, 1927, -1, -1, 277, -1, -1, 1964, -1, 1316, -1, -1, -1, -1, -1, 918, -1,
+  1507, -1, -1, 1880, -1, -1, -1, 844, -1, -1, 407, 912, 1380, -1, -1, 1826, 1367, 1366, -1, -1,
+  263, 480, 27, -1, 884, 1872, -1, -1, -1, -1, 952, 163, 1996, 442, -1, -1, -1, 1102, -1, 83,
+  -1, 1797, 1666, -1, 1424, 626, -1, 1034, -1, 1071, 416, -1, 172, 2047, 1593, -1, -1, -1, 276, -1,
+  -1, 1007, -1, -1, -1, 568, 1673, -1, -1, -1, -1, -1, -1, 1740, 1488, -1, -1, 469, -1, -1,
+  -1, -1, -1, 2079, -1, -1, -1, -1, 1326, -1, -1, 933, 2042, -1, 1314, 763, -1, -1, -1, 2111,
+  1175, 718, 1226, 1085, 2073, 1933, -1, 341, -1, -1, 1250, 1026, 256, -1, -1, 1799, -1, -1, -1, 1937,
+  1773, -1, -1, -1, 1122, 1798, 829, 1844, -1, 1327, -1, 1565, -1, -1, -1, 1624, 274, 51, 491, 2095,
+  2099, -1, 972, -1, 610, 1369, -1, 159, 1876, 840, 1774, 834, -1, 1317, -1, -1, 986, 768, -1, 23,
+  -1, 281, -1, 586, 832, 1909, -1, -1, 2122, 179, 166, 1640, -1, -1, -1, 514, 1020, -1, 1154, 1221,
+  -1, -1, -1, 1721, 1685, 2008, -1, 226, -1, 1851, 813, 149, 885, 1476, -1, 2050, 797, -1, -1, 516,
+  -1, 1602, -1, -1, -1, 1919, 1229, -1, -1, -1, -1, -1, -1, -1, 1892, -1, -1, 570, -1, -1,
+  -1, 1785, 1051, 131, 608, -1, 525, 259, 2106, -1, -1, 418, 1961, -1, 458, 1017, 1230, 275, -1, 1611,
+  824, 1199, -1, -1, -1, 1232, -1, -1, -1, 1931, 788, 523, 487, 1485, 185, -1, 1689, -1, 742, -1,
+  781, 2123, 196, 1280, 602, 278, 308, 63, -1, 1536, -1, 108, 44, -1, -1, 1195, -1, -1, -1, 1775,
+  730, 120, 1330, -1, 112, 1456, -1, 382, 1320, 406, 1868, -1, 808, 619, -1, -1, 1449, -1, -1, 317,
+  -1, -1, -1, -1, -1, 793, -1, 93, 1847, 1514, 2068, 643, 1349, -1, 1373, 2039, 1423, -1, 961, -1,
+  -1, 351, 1795, 536, -1, 1070, 68, 1297, -1, 1334, -1, -1, 66, -1, -1, -1, -1, 954, 1181, -1,
+  -1, -1, -1, -1, 296, -1, 1434, -1, -1, 1865, -1, 646, -1, -1, 475, -1, 419, 819, 1744, 1561,
+  719, -1, -1, 1163, 683, 1581, 1574, 1652, 162, -1, -1, -1, 524, 1217, -1, -1, -1, 668, -1, -1,
+  -1, -1, 1396, 244, -1, 2014, 724, -1, -1, 251, -1, -1, -1, -1, 1473, 74, -1, 1483, -1, 1500,
+  1291, 1697, 38, 773, -1, -1, -1, -1, 2072, -1, -1, 449, -1, -1, -1, -1, 739, -1, 428, 1417,
+  1364, -1, -1, -1, 49, 858, -1, -1, 1585, -1, -1, -1, 1164, 517, 1669, -1, 177, 1542, 2010, 380,
+  501, 1594, 1047, 1530, 1190, 417, 1794, -1, 1767, -1, -1, -1, 554, 170, 1156, -1, 1934, -1, 1422, 1409,
+  -1, -1, 778, 1733, -1, 1815, -1, -1, -1, -1, -1, -1, 1171, -1, -1, -1, 1675, 1403, 1936, 520,
+  -1, -1, -1, -1, 201, 1264, 1274, 1901, 1337, -1, 2025, -1, -1, 1222, -1, -1, 303, -1, -1, -1,
+  64, -1, -1, 1683, -1, 612, 1220, -1, -1, 157, -1, 1151, 302, 1838, -1, 1531, 1532, -1, 702, 1234,
+  -1, 427, 809, 857, 1296, 1959, -1, -1, 1166, 62, -1, 653, 1200, -1, 1187, -1, 1717, 462, 1130, -1,
+  1926, 871, -1, -1, -1, -1, 749, 125, -1, 550, -1, 1457, -1, 931, 69, 1804, -1, -1, 814, 1994,
+  580, 917, -1, 2108, -1, 1174, 1494, 1898, 817, 569, -1, -1, -1, 1827, 1088, 1967, 1251, -1, -1, 2120,
+  -1, 748, 1692, 1696, -1, 598, 1620, -1, -1, -1, -1, -1, 42, 1323, -1, 1657, -1, 305, 630, -1,
+  -1, 1866, -1, -1, 753, 839, -1, 444, -1, 178, 756, -1, 1076, 1945, 571, -1, 621, -1, 738, -1,
+  -1, 459, 872, -1, -1, -1, -1, 299, -1, -1, -1, -1, -1, 1618, -1, -1, -1, -1, -1, 1277,
+  784, 614, -1, 463, -1, -1, 204, -1, 896, 1276, -1, 1579, 1515, -1, 500, 1285, -1, -1, 1747, -1,
+  725, 1464, 887, -1, -1, -1, 1273, 1625, -1, -1, 2020, 400, 1913, -1, 1362, -1, -1, 1787, 1519, 1092,
+  -1, -1, -1, 1558, -1, 1512, -1, 1144, -1, -1, 962, -1, 312, 1972, 1874, -1, 430, 1821, -1, 95,
+  -1, -1, 343, -1, -1, -1, -1, 2043, -1, -1, 708, -1, 1505, 1732, -1, 1924, 1027, 1923, -1, -1,
+  1999, -1, 408, 97, 1938, 113, 825, -1, -1, -1, -1, 2067, 692, 641, -1, 629, -1, 206, -1, -1,
+  -1, 901, -1, 1805, 880, -1, 1576, -1, -1, 361, -1, 438, -1, 736, 1813, -1, 1971, -1, 766, -1,
+  94, -1, -1, -1, -1, 572, -1, -1, 181, -1, 582, 882, -1, -1, 318, 985, -1, -1, 203, 246,
+  711, -1, -1, 1089, 955, -1, 1189, 1405, 1127, -1, 0, 679, 2046, -1, 1430, 677, 86, -1, -1, 1266,
+  1145, -1, 176, -1, 5, -1, 304, -1, 134, -1, 1203, 2033, -1, 424, -1, -1, 1917, 1796, 1257, -1,
+  1099, -1, -1, 156, 440, -1, -1, -1, 10, 1447, -1, -1, 1639, 1513, -1, -1, 1674, 1896, 2115, 1399,
+  579, 48, -1, 346, 1759, 1302, -1, 1869, 938, -1, 1231, 1356, 937, 893, 1202, 713, 506, 794, -1, -1,
+  109, 194, 1126, -1, -1, 1825, 1247, -1, -1, -1, 1481, -1, -1, -1, 186, -1, 1005, -1, -1, -1,
+  1376, -1, -1, -1, 1066, 733, -1, -1, 1600, 782, -1, -1, 2103, -1, 759, 171, 1260, 1708, -1, 1496,
+  925, 2003, 970, 1278, -1, 77, 396, 1725, -1, 1045, -1, 1877, -1, -1, 1781, 807, -1, -1, -1, -1,
+  -1, -1, 294, -1, 115, -1, -1, 662, 79, 2007, -1, -1, 877, 82, -1, 981, 897, -1, -1, -1,
+  2107, 639, -1, 1968, -1, 1155, -1, -1, 810, -1, 1008, 1329, -1, 1572, 1946, 324, -1, 1989, 1614, 1406,
+  1249, -1, 1454, -1, 1516, 1906, 1503, 2002, -1, 1025, 1750, 816, -1, 1491, -1, 1177, -1, -1, 357, 1048,
+  -1, 2032, -1, -1, -1, -1, 1039, -1, 1209, -1, -1, -1, -1, -1, -1, -1, 437, 1525, -1, -1,
+  -1, 140, -1, -1, 9, 1686, 223, -1, 587, 1096, 344, 1402, 199, 592, -1, 13, 1322, -1, 2035, 1548,
+  -1, 830, 672, 667, 1082, 261, 1432, -1, 1807, 100, -1, -1, 1828, -1, 1169, -1, -1, -1, 1854, 476,
+  347, 1780, -1, 368, 1982, 160, 775, -1, -1, 1245, 1808, 90, 128, 1191, 1455, -1, 546, -1, -1, 920,
+  -1, -1, 504, 1566, -1, -1, -1, -1, -1, -1, 423, 328, 545, 2109, -1, 878, 879, -1, -1, 1372,
+  1253, -1, 1549, 761, -1, -1, -1, -1, -1, -1, 526, 217, 632, 1477, 144, -1, 359, 207, -1, 311,
+  -1, -1, 210, -1, -1, 1546, 1860, -1, -1, 497, -1, 1248, -1, -1, -1, 2012, -1, -1, -1, -1,
+  184, 1688, -1, 1853, -1, 1819, 867, 92, 1789, -1, -1, -1, -1, -1, -1, -1, 932, -1, 1173, -1,
+  360, -1, -1, -1, 285, -1, 993, 664, 1560, -1, -1, 1691, -1, -1, -1, 1081, 1386, 577, 732, 1939,
+  1307, -1, -1, -1, 875, 866, 2027, -1, 1279, -1, 269, -1, -1, 2080, -1, 1213, 1563, 1621, -1, -1,
+  573, -1, -1, -1, -1, 637, -1, 669, -1, -1, -1, -1, -1, 1664, 1616, 628, 1387, 1197, 1985, -1,
+  468, -1, 2041, 1407, -1, -1, 846, 118, 2061, -1, -1, 453, 1446, 1388, 1693, -1, -1, -1, -1, -1,
+  1997, -1, -1, 1889, 1720, -1, 465, -1, -1, -1, 1943, 1459, -1, 1678, -1, -1, 84, 715, -1, 2045,
+  -1, 941, -1, 54, 560, 1577, -1, 1451, -1, 787, 292, 2055, 224, 146, -1, -1, 1161, -1, 1112, -1,
+  995, 2063, 509, -1, -1, -1, 696, 321, 1452, 67, 45, 735, -1, -1, -1, 601, 802, 17, -1, 2051,
+  -1, -1, -1, -1, -1, -1, 33, 135, 929, 455, -1, 1638, -1, 607, 421, 88, -1, -1, -1, -1,
+  698, 1415, -1, 1055, 533, 1992, -1, 373, -1, -1, 1612, 764, -1, 1835, -1, 843, 936, -1, -1, -1,
+  -1, -1, -1, -1, -1, 1256, 926, -1, 1233, -1, -1, 1820, -1, 1758, -1, -1, -1, 645, -1, -1,
+  -1, 704, -1, -1, -1, 1121, -1, -1, -1, 1240, -1, 1765, 25, -1, 432, -1, 1410, 1029, 1958, -1,
+  -1, 1659, 1371, 2069, -1, -1, 31, -1, -1, -1, -1, -1, 273, -1, -1, -1, -1, 1578, 182, -1,
+  -1, 1287, 1631, 1590, -1, 521, 1246, -1, -1, 412, -1, 335, 790, 566, 2087, 1538, -1, 1881, -1, -1,
+  1219, -1, 72, -1, -1, 876, -1, 1861, -1, -1, 544, -1, 1308, -1, -1, -1, 1255, -1, 377, -1,
+  -1, 70, -1, 900, -1, 2066, 1384, -1, 528, 258, -1, 944, -1, -1, 371, -1, 1979, -1, 1254, 145,
+  -1, 1271, 1990, 279, 1390, 620, 1676, -1, 723, -1, 540, -1, -1, 852, -1, -1, -1, 242, 940, 666,
+  1448, -1, 198, 617, -1, -1, 1433, 922, 1895, 208, 770, 859, -1, -1, -1, 2009, 652, -1, 365, -1,
+  1508, -1, 354, -1, -1, 603, -1, -1, -1, 1610, 1138, -1, 1306, 701, -1, 446, 1855, 1857, 1993, -1,
+  -1, 1573, -1, 1319, -1, -1, -1, -1, -1, -1, 1073, -1, -1, -1, -1, 1751, -1, 531, -1, -1,
+  -1, -1, 15, 921, 1598, -1, 1204, -1, -1, 1152, -1, 1335, 1955, 1642, -1, -1, -1, -1, -1, 1978,
+  -1, 151, 456, -1, -1, 1567, -1, -1, -1, 1655, 1113, -1, 1682, 221, -1, -1, 1131, 1743, -1, 848,
+  1427, 530, -1, 1074, 333, 1093, -1, -1, 1534, -1, -1, -1, -1, -1, -1, -1, 381, 631, 1734, 1738,
+  1834, -1, -1, 1118, 492, 399, 1338, -1, 1522, 356, -1, -1, 389, 881, 691, -1, 1911, -1, 1393, -1,
+  1608, 313, 1238, -1, -1, 599, -1, 473, -1, 828, -1, -1, 547, -1, -1, 1413, 596, -1, -1, 1741,
+  1487, 1836, 1724, -1, -1, -1, 1555, 951, 283, -1, -1, 1575, 32, 110, -1, 1580, -1, -1, 895, 1517,
+  288, -1, -1, 395, 527, 29, -1, 1472, -1, -1, -1, 1462, 680, -1, 1129, 1270, 433, -1, -1, -1,
+  1148, 1466, 336, 353, -1, -1, 1289, 1609, 1132, -1, 448, -1, 332, 1509, -1, 293, -1, -1, -1, 994,
+  -1, -1, -1, 534, 827, 1983, 387, -1, 853, -1, -1, 948, -1, -1, -1, 957, -1, 1832, 1087, 1809,
+  -1, 1044, -1, 1897, 1313, -1, 370, 494, 342, -1, -1, 78, 868, 2044, 1948, -1, 8, -1, 2015, -1,
+  57, -1, -1, -1, 212, 300, -1, 1823, 132, -1, 264, -1, -1, 1465, -1, 35, -1, 96, -1, 1223,
+  -1, -1, 1957, -1, 1348, -1, -1, 36, 1036, -1, -1, 1355, 1520, -1, -1, -1, -1, -1, 180, 1004,
+  -1, -1, -1, -1, 1107, -1, -1, 1038, 106, 65, -1, 402, 20, -1, 2090, -1, -1, -1, -1, -1,
+  538, 1188, 693, 127, 238, 1185, -1, 383, 511, -1, -1, 1848, 1194, 1079, 1864, 1779, -1, -1, -1, -1,
+  -1, -1, 1894, 485, -1, -1, 1436, -1, 1324, 1974, 1718, -1, 2030, -1, -1, -1, 989, 507, 916, 903,
+  -1, 478, 1059, -1, 1550, -1, -1, 1084, 1216, 2097, 2006, 855, -1, -1, -1, 1905, 138, -1, 1489, -1,
+  -1, 323, -1, 1777, -1, -1, 193, 578, 1791, -1, -1, -1, -1, 1010, 26, 798, -1, 1529, -1, 1023,
+  635, -1, -1, 1953, 1863, 590, 133, -1, -1, -1, 564, 252, 271, 1179, -1, 1170, 684, 403, 426, 431,
+  -1, 886, -1, -1, -1, -1, 946, 1114, -1, 726, 289, -1, 1941, 1940, -1, -1, -1, 722, -1, 61,
+  -1, 2100, 1719, -1, -1, -1, 1311, -1, 386, 513, -1, -1, 1425, -1, -1, -1, -1, 337, -1, -1,
+  46, 1116, 1471, -1, 1011, -1, 976, 1242, -1, 678, -1, -1, -1, -1, 1006, -1, -1, 489, -1, 1105,
+  1713, 575, -1, 1350, 1679, -1, 34, 1401, 1480, 964, 1705, -1, 1811, 837, -1, 1498, 345, -1, 1310, 2104,
+  -1, 924, -1, 1141, -1, 2083, 611, -1, 422, 384, -1, -1, -1, 1871, -1, -1, -1, 1662, 2086, 1192,
+  -1, 1318, -1, -1, 301, -1, -1, 21, -1, 1987, -1, 2121, -1, -1, 364, 124, 1980, -1, -1, 1763,
+  -1, -1, 673, 510, -1, -1, 1075, 1426, -1, 1716, 37, -1, -1, -1, -1, 785, -1, -1, 1710, -1,
+  -1, -1, 746, 870, -1, 537, 1435, -1, -1, -1, 1049, -1, 967, 535, 1259, -1, 1103, -1, 539, -1,
+  165, -1, 1748, 945, 262, -1, -1, -1, -1, -1, -1, -1, 338, 581, 727, 1368, 122, 376, -1, 591,
+  -1, -1, -1, 1150, 1460, -1, -1, -1, 1292, 561, 1782, 1592, 452, -1, 1293, -1, 306, 1935, 1736, -1,
+  189, -1, -1, -1, 270, 1031, 1589, -1, -1, 898, 1641, 1539, -1, -1, -1, 865, 1632, 697, -1, 1900,
+  -1, 1830, -1, -1, 232, -1, -1, -1, 1591, -1, 215, 1915, 1269, -1, 1412, -1, -1, 1149, -1, -1,
+  1656, 767, -1, 1768, 391, -1, -1, 831, -1, 1627, 1303, -1, -1, 1442, -1, 2065, -1, 467, 1501, 2089,
+  102, -1, -1, -1, 1801, 1428, -1, 1698, 1649, -1, 315, -1, 1153, -1, 1165, -1, -1, 1469, -1, -1,
+  1018, -1, 1183, -1, -1, -1, 806, -1, 1262, -1, -1, 1418, -1, 1343, 1952, 647, 85, 1694, -1, -1,
+  239, -1, -1, 1208, -1, -1, -1, 1547, -1, -1, -1, -1, -1, -1, -1, -1, 1772, 139, -1, 556,
+  1159, -1, -1, -1, -1, 705, 1699, -1, 716, 953, -1, 2024, 1677, 1283, -1, -1, 1845, -1, -1, -1,
+  1695, 616, 508, 1949, 990, -1, 1988, -1, -1, -1, -1, 22, 2, -1, -1, -1, -1, 1658, 1215, 519,
+  1196, 777, 2074, 1, -1, -1, -1, 481, 282, -1, -1, -1, -1, -1, -1, 623, -1, -1, -1, 52,
+  -1, 1305, -1, -1, -1, 390, -1, 1527, 2075, 12, -1, -1, 1395, 1360, -1, -1, 1586, -1, 982, -1,
+  747, 209, -1, -1, -1, 1421, 905, -1, 1617, -1, -1, -1, -1, 2040, 1400, -1, 703, 928, -1, 584,
+  1537, 1101, -1, 168, 250, 2060, -1, 297, -1, -1, 1769, 1033, 1629, -1, 700, -1, 935, 1382, 1665, -1,
+  331, -1, 934, -1, 606, -1, 2037, -1, 1962, 914, -1, -1, 1831, -1, -1, -1, 298, -1, -1, 636,
+  2110, -1, -1, -1, 192, -1, -1, 2084, 1556, -1, 414, 789, 1420, -1, -1, 624, -1, -1, 823, 1886,
+  -1, -1, 280, -1, -1, -1, -1, -1, 1053, -1, -1, 1097, -1, 1752, -1, 190, -1, 505, 482, -1,
+  -1, 11, 754, -1, 116, -1, 1595, -1, -1, 1133, 1143, 1885, -1, -1, 1714, 783, -1, 1268, 1730, 1198,
+  -1, -1, -1, -1, -1, 2094, -1, 1607, 1950, 1499, 694, 477, 1375, -1, 143, -1, -1, -1, 1358, 1037,
+  -1, -1, 757, -1, -1, 792, 765, -1, 2023, -1, 1510, 1615, 965, 434, 1000, -1, 1907, 563, 779, -1,
+  1700, -1, -1, 2016, -1, -1, 791, 1028, -1, 1475, -1, 460, 1764, 488, 1309, -1, 1210, 1351, 1841, -1,
+  -1, 1157, -1, -1, 1272, 627, -1, -1, 247, 1783, 47, 1753, -1, -1, 213, -1, 1653, -1, 1236, -1,
+  -1, -1, 1728, -1, -1, 295, -1, -1, 1333, 441, 1559, -1, -1, 891, -1, 555, -1, -1, 231, -1,
+  211, 1535, -1, -1, -1, -1, -1, 98, -1, -1, 310, -1, 470, 553, -1, 1756, 1523, 490, -1, -1,
+  1069, 1735, 515, 634, 1788, 1528, 923, 1965, 219, -1, 919, 1862, 939, -1, -1, 137, 43, 1562, 1604, 188,
+  393, -1, 1670, -1, 1518, 856, 992, 1762, 1944, -1, 2082, 695, -1, 1557, 710, 851, 760, -1, 1687, 1671,
+  -1, -1, 755, -1, 1635, -1, 392, -1, -1, 111, 549, -1, -1, 1090, -1, 307, -1, 1211, -1, 243,
+  -1, 979, 1050, 1267, -1, -1, -1, 650, -1, 1973, -1, 425, -1, 1818, 1235, -1, 2049, 907, 1878, 1755,
+  73, -1, -1, 1543, -1, 1135, 257, -1, 1012, 1064, 512, 1504, -1, 1258, -1, 1837, 334, -1, -1, -1,
+  -1, -1, 1146, -1, 648, 1431, -1, -1, 2117, 1630, 367, 588, 1966, 1298, -1, -1, 1470, 2053, -1, 1814,
+  -1, -1, -1, 1212, 1849, -1, 175, -1, 818, 50, 963, 1761, 2022, -1, -1, 1378, 241, 978, -1, -1,
+  -1, 1660, 91, -1, 230, 1850, 1784, 1346, -1, 909, 2028, -1, -1, -1, -1, 329, 1533, -1, -1, 55,
+  -1, 1879, -1, -1, -1, 39, -1, -1, 1385, -1, 237, -1, 200, -1, 987, 142, 493, 1354, 2054, -1,
+  227, 1147, -1, 2058, -1, 1833, 1389, -1, 1998, 1124, -1, 737, 1960, -1, 1731, -1, 762, 233, -1, -1,
+  -1, -1, 1991, 968, 349, 117, 1443, -1, 1336, -1, -1, -1, -1, 799, -1, -1, -1, 1265, -1, -1,
+  -1, -1, -1, 1429, -1, 1160, -1, 1727, -1, 415, -1, 2057, -1, 1353, -1, 594, 720, 436, 821, -1,
+  -1, -1, 542, -1, 89, -1, 690, -1, 388, -1, -1, -1, 1672, -1, -1, -1, 1634, -1, 1013, -1,
+  2004, -1, -1, 167, -1, -1, -1, 1921, -1, -1, -1, -1, 205, -1, 752, -1, -1, 1461, 1241, 984,
+  -1, -1, -1, -1, -1, -1, -1, -1, 1224, -1, 445, -1, -1, 714, 1111, 1374, -1, -1, 1977, 1239,
+  -1, 1754, 873, 59, 1060, 649, -1, 841, 849, 187, 80, 902, 1205, -1, 1072, -1, -1, 847, 1054, -1,
+  1182, 996, -1, 835, -1, 496, -1, -1, 1930, 235, 908, -1, 1437, 309, -1, -1, -1, 2031, 1786, 2105,
+  81, -1, 1584, 41, 466, 1117, -1, -1, -1, -1, -1, 1812, -1, 618, 1243, -1, -1, 2116, -1, -1,
+  -1, -1, 1186, -1, 1193, -1, -1, 558, 1822, 1062, 815, -1, 1803, 795, 1506, 2114, 1975, 1729, -1, 1057,
+  -1, -1, 874, 862, -1, -1, -1, -1, -1, 1661, -1, -1, 529, 1540, 740, 1225, -1, -1, 1065, -1,
+  -1, -1, 1711, -1, -1, 183, -1, -1, -1, 1123, 499, 562, 796, 860, -1, 1650, 404, 1643, 709, 894,
+  -1, 687, -1, 30, -1, 325, -1, 771, 899, -1, 1684, -1, 904, -1, -1, -1, 559, -1, -1, 405,
+  -1, -1, 1252, -1, 366, 464, 101, -1, -1, 1441, 1136, -1, 522, 1737, 1180, -1, 574, -1, -1, 671,
+  717, 1344, 1014, 1908, 776, 1325, 1569, -1, -1, 850, -1, -1, 1843, -1, -1, -1, 1916, -1, 576, -1,
+  447, -1, 1206, 272, 622, -1, -1, -1, 1667, 1792, 959, 1142, -1, -1, 220, -1, -1, -1, -1, 363,
+  -1, 1817, -1, 372, 774, 712, -1, 2021, -1, 479, -1, 1438, 2093, 706, -1, -1, 1167, 1884, -1, -1,
+  1603, -1, 2081, -1, 1394, -1, -1, 1647, -1, 1893, 1601, 355, 216, -1, -1, 154, -1, -1, -1, 1497,
+  -1, 1458, 1636, -1, 141, 595, -1, -1, 2118, -1, -1, 1275, 2078, 975, 1095, 147, -1, -1, 1411, 265,
+  1392, -1, 1613, 685, 409, 129, 502, -1, -1, 2119, -1, -1, 1839, -1, -1, 1888, -1, 1067, -1, 1912,
+  330, -1, 1891, 443, -1, 2052, 1742, -1, 1770, 225, -1, 532, -1, 1377, 1068, -1, 728, -1, -1, 686,
+  -1, -1, 2085, -1, 1052, 980, 889, -1, -1, -1, -1, 316, 1875, -1, -1, 518, -1, -1, -1, -1,
+  915, 1263, -1, 552, 1790, -1, -1, 87, -1, 966, 1134, 2001, -1, 1125, 805, -1, 1829, -1, -1, -1,
+  -1, 1340, 362, -1, -1, 1379, 1345, -1, -1, -1, -1, 236, 1502, 483, -1, 471, -1, -1, 1766, -1,
+  -1, -1, -1, -1, -1, -1, -1, 126, 1582, 2034, -1, 1793, -1, 2071, -1, -1, -1, 1633, 801, 1951,
+  -1, 1490, 290, 1902, -1, 998, -1, -1, 2102, -1, 1712, -1, -1, -1, 3, 2070, -1, 1119, 1626, 1858,
+  -1, 375, 699, 1091, 670, 1321, 1176, -1, 1244, -1, 1663, -1, -1, -1, 1474, 991, -1, 420, -1, -1,
+  1365, -1, 820, 822, 1383, 1702, -1, -1, 947, 890, 2056, -1, -1, -1, -1, 429, 268, -1, -1, -1,
+  -1, 1910, -1, 1810, 1587, -1, 1347, -1, -1, 2036, -1, -1, -1, -1, -1, -1, 1904, -1, 2029, -1,
+  -1, -1, 153, -1, 676, 1963, 1339, -1, 1294, -1, -1, 1009, 1899, 1019, 930, 1467, -1, -1, 1859, -1,
+  -1, -1, -1, -1, 1328, 1108, -1, -1, -1, -1, -1, -1, -1, -1, 1969, 2059, 1954, 1058, -1, 1745,
+  -1, -1, 260, -1, 956, -1, 374, -1, -1, -1, -1, -1, 927, 1970, 836, 864, -1, 688, 1883, 439,
+  973, -1, -1, 638, -1, 326, 472, -1, -1, 1887, -1, 394, -1, -1, 1391, 24, -1, 1645, -1, -1,
+  -1, -1, -1, 750, 1201, 1440, -1, -1, 1352, 358, 1681, 1207, -1, -1, 2077, 1439, 543, -1, 2124, -1,
+  -1, 615, -1, -1, -1, 1408, -1, -1, 1301, -1, -1, -1, 551, -1, -1, 1715, 1398, -1, 1030, -1,
+  -1, 1445, 287, 155, -1, 1178, 1976, 105, 1416, 734, -1, 397, 451, -1, 593, -1, 1852, -1, 319, -1,
+  682, 1605, 1493, -1, 1290, 1776, -1, 254, -1, 245, -1, -1, 812, 401, -1, 339, 1840, -1, 811, 950,
+  1381, 123, 1281, -1, 1370, 1597, 284, 385, 861, -1, -1, 1357, 1646, 910, 267, 681, 660, 1024, -1, -1,
+  -1, -1, -1, -1, -1, -1, 1824, -1, 741, 589, 1486, 379, 435, 1021, 2026, -1, 1856, 148, -1, 772,
+  1158, 1920, 1867, 1022, 1162, -1, 769, -1, -1, 413, 642, 164, 1552, 1463, -1, 1925, -1, 53, -1, 75,
+  -1, -1, -1, -1, -1, 1709, -1, 1404, -1, -1, -1, 152, 842, -1, 999, -1, -1, 1140, -1, -1,
+  -1, 604, -1, 1521, 2112, 28, -1, -1, -1, 1690, 977, -1, 1890, 658, -1, 625, -1, 228, 567, 565,
+  169, 1545, 1359, -1, -1, 1077, -1, 1312, 644, -1, 1986, -1, 613, 1882, -1, -1, 731, 1984, 969, -1,
+  -1, 541, 2092, -1, -1, 1063, -1, 780, -1, 974, -1, -1, 640, 1571, -1, 314, 1016, -1, 255, -1,
+  2011, -1, 266, -1, -1, 411, 107, -1, 486, -1, 291, 1397, 378, -1, -1, 2098, -1, 1956, 7, 689,
+  -1, 503, -1, -1, 1606, 1511, -1, 2038, 484, 1651, -1, 2018, 1419, -1, 474, 1922, 1706, -1, 14, 410,
+  1083, 1541, -1, -1, -1, -1, 1544, -1, -1, -1, -1, 222, -1, -1, 158, 369, -1, 1628, 1120, -1,
+  -1, -1, 745, -1, -1, -1, -1, -1, -1, 56, -1, -1, 1599, 1816, 76, 1184, -1, 583, 661, 4,
+  -1, 114, -1, -1, 1284, 1043, 663, 1001, -1, 605, -1, 249, 1414, -1, 2101, 1137, -1, -1, -1, -1,
+  1623, 744, -1, -1, 1846, -1, 1482, 136, 1648, -1, -1, 40, -1, -1, 600, -1, 19, 130, -1, -1,
+  -1, 218, 495, -1, -1, -1, -1, -1, 348, 656, 1086, 729, 585, 1637, 743, 1172, 1802, 1701, -1, 1749,
+  2005, 1094, -1, 340, -1, -1, 71, 1918, -1, 1588, -1, 1040, -1, 161, -1, -1, 1115, -1, 1453, -1,
+  457, 804, -1, 1056, 1450, 461, -1, -1, 869, 119, 229, -1, -1, 983, 248, 988, 971, -1, -1, -1,
+  -1, 655, 997, 2088, -1, -1, 803, 888, -1, -1, -1, 60, -1, -1, -1, 654, -1, 838, -1, -1,
+  1757, -1, -1, 892, -1, 657, -1, -1, -1, -1, -1, -1, 2017, -1, 1568, 1288, 352, -1, 633, -1,
+  1478, 173, 1363, -1, 1106, 197, -1, 1104, -1, 1583, -1, 327, 1109, -1, -1, -1, -1, -1, 557, -1,
+  1299, 286, 1570, 751, 1800, 883, 1760, 1995, 1914, 121, -1, -1, -1, -1, 1304, -1, -1, 234, 1003, -1,
+  320, 1551, -1, -1, 1002, -1, 906, -1, -1, 1928, -1, -1, -1, -1, -1, 150, 1806, -1, -1, 1870,
+  -1, -1, -1, -1, 758, -1, 1553, 1726, 202, 1100, 1041, -1, 350, -1, -1, 398
+};
+
+#endif // HTML_ENTITIES_TBL_HPP__
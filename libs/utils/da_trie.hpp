@@ -0,0 +1,261 @@
+//------------------------------------------------------------
+/// @file  da_trie.hpp
+/// @brief Double-array trie over bytes: builder and reader
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#ifndef GOGO_DA_TRIE_HPP__
+#define GOGO_DA_TRIE_HPP__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+
+#include "memio.hpp"
+#include "defs.hpp"
+
+/*
+ EXAMPLE OF USAGE:
+
+  DATrieBuilder tb;
+  tb.add ("new york", 1);
+  tb.add ("new", 2);
+
+  char *data = new char[tb.size()];
+  MemWriter mwr (data);
+  tb.save (mwr);
+
+  MemReader mrd (data);
+  DATrieReader tr;
+  tr.load (mrd);
+
+  uint32_t node = DATrieReader::ROOT, val;
+  assert (tr.walk (node, "new", 3) && tr.value (node, val) && val == 2);
+  assert (tr.walk (node, " york", 5) && tr.value (node, val) && val == 1);
+*/
+
+namespace gogo
+{
+
+namespace da_trie_impl {
+  // transition of node by label L leads to unit (base + L) if it's check is the node;
+  // label 0 ends key (the unit keeps value), byte B is label (B + 1)
+  struct unit {
+    int32_t base;  // value of key as (-1 - value) for key end units
+    int32_t check; // parent unit, -1 - free
+  } __PACKED;
+
+  static const int32_t FREE = -1;
+  static const uint32_t VALUE_MAX = 0x7FFFFFFF;
+}
+
+/// @class DATrieBuilder
+/// @brief trie of unique byte string keys with 31 bit values
+class DATrieBuilder : public QSerializerOut
+{
+  typedef std::pair<std::string, uint32_t> key_t;
+  mutable std::vector<key_t> m_keys; // sorted by prepare()
+  mutable std::vector<da_trie_impl::unit> m_units;
+  mutable uint32_t m_nextFree; // no free unit below
+  mutable bool m_dirty;
+
+  static unsigned label(const std::string &key, size_t depth) {
+    return (depth < key.size()) ? (unsigned)(unsigned char)key[depth] + 1 : 0;
+  }
+
+  void reserve(uint32_t n) const {
+    if (m_units.size() < n) {
+      da_trie_impl::unit u = {0, da_trie_impl::FREE};
+      m_units.resize(std::max((size_t)n, m_units.size() * 2), u);
+    }
+  }
+
+  /// @return base of node with (ascending) child labels
+  int32_t findBase(const std::vector<unsigned> &labels) const {
+    using namespace da_trie_impl;
+    uint32_t pos = std::max(m_nextFree, labels[0] + 1);
+
+    for (;; pos++) {
+      reserve(pos + 257);
+      if (m_units[pos].check != FREE)
+        continue;
+
+      uint32_t base = pos - labels[0], i;
+      for (i = 1; i < labels.size() && m_units[base + labels[i]].check == FREE; i++)
+        ;
+      if (i == labels.size())
+        return (int32_t)base;
+    }
+  }
+
+  /// @brief place children of @arg node: keys [lo, hi) sharing prefix of length @arg depth
+  void buildNode(uint32_t node, size_t lo, size_t hi, size_t depth) const {
+    using namespace da_trie_impl;
+    std::vector<unsigned> labels;
+    std::vector<size_t> bounds;
+    size_t i;
+
+    for (i = lo; i < hi; i++) {
+      unsigned l = label(m_keys[i].first, depth);
+      if (labels.empty() || labels.back() != l) {
+        labels.push_back(l);
+        bounds.push_back(i);
+      }
+    }
+    bounds.push_back(hi);
+
+    int32_t base = findBase(labels);
+    m_units[node].base = base;
+    for (i = 0; i < labels.size(); i++)
+      m_units[base + labels[i]].check = (int32_t)node;
+    while (m_units[m_nextFree].check != FREE)
+      m_nextFree++;
+
+    for (i = 0; i < labels.size(); i++) {
+      uint32_t child = base + labels[i];
+      if (labels[i] == 0)
+        m_units[child].base = -1 - (int32_t)m_keys[bounds[i]].second;
+      else
+        buildNode(child, bounds[i], bounds[i + 1], depth + 1);
+    }
+  }
+
+  void build() const {
+    using namespace da_trie_impl;
+    m_units.clear();
+    m_nextFree = 1;
+    reserve(512);
+    m_units[0].check = -2; // root has no parent
+
+    if (!m_keys.empty())
+      buildNode(0, 0, m_keys.size(), 0);
+
+    size_t n = m_units.size();
+    while (n > 1 && m_units[n - 1].check == FREE)
+      n--;
+    m_units.resize(n);
+    m_dirty = false;
+  }
+
+  void prepare() const {
+    if (!m_dirty)
+      return;
+
+    std::sort(m_keys.begin(), m_keys.end());
+    for (size_t i = 1; i < m_keys.size(); i++) {
+      if (m_keys[i].first == m_keys[i - 1].first)
+        throw std::runtime_error("DATrieBuilder: duplicated key");
+    }
+    build();
+  }
+
+  public:
+    DATrieBuilder() : m_nextFree(1), m_dirty(true) {}
+    virtual ~DATrieBuilder() {}
+
+    /// @brief add key (keys should be unique)
+    void add(const std::string &key, uint32_t value) {
+      if (value > da_trie_impl::VALUE_MAX)
+        throw std::out_of_range("DATrieBuilder: value is out of range");
+      m_keys.push_back(key_t(key, value));
+      m_dirty = true;
+    }
+    void clear() { m_keys.clear(); m_units.clear(); m_dirty = true; }
+    unsigned amount() const { return m_keys.size(); }
+    /// @return number of trie units (8 bytes each)
+    unsigned units() const { prepare(); return m_units.size(); }
+
+    // export format: [NUNITS][UNIT x NUNITS]
+    virtual size_t size() const {
+      prepare();
+      return sizeof(uint32_t) + m_units.size() * sizeof(da_trie_impl::unit);
+    }
+    virtual void save(MemWriter &mwr) {
+      prepare();
+      mwr << (uint32_t)m_units.size();
+      for (size_t i = 0; i < m_units.size(); i++)
+        mwr << m_units[i];
+    }
+};
+
+/// @class DATrieReader
+/// @brief walk of saved trie: transition is two array reads
+class DATrieReader : public QSerializerIn
+{
+  const da_trie_impl::unit *m_units;
+  uint32_t m_nunits;
+
+  public:
+    static const uint32_t ROOT = 0;
+
+    DATrieReader() : m_units(0), m_nunits(0) {}
+    virtual ~DATrieReader() {}
+
+    virtual void load(MemReader &mrd) {
+      mrd >> m_nunits;
+      m_units = reinterpret_cast<const da_trie_impl::unit *>(mrd.get());
+      mrd.advance(m_nunits * sizeof(da_trie_impl::unit));
+    }
+
+    bool empty() const { return m_nunits < 2; }
+
+    /// @brief follow byte @arg c from @arg node
+    /// @return false if there is no such transition (node is unchanged)
+    bool walk(uint32_t &node, unsigned char c) const {
+      int32_t base = m_units[node].base;
+      uint32_t next = (uint32_t)base + c + 1;
+      if (base < 0 || next >= m_nunits || m_units[next].check != (int32_t)node)
+        return false;
+      node = next;
+      return true;
+    }
+
+    /// @brief follow bytes of @arg s from @arg node
+    /// @return false if some byte has no transition (node is undefined)
+    bool walk(uint32_t &node, const char *s, size_t len) const {
+      for (size_t i = 0; i < len; i++) {
+        if (!walk(node, (unsigned char)s[i]))
+          return false;
+      }
+      return true;
+    }
+
+    /// @brief get value of key ended at @arg node
+    /// @return false if no key ends here
+    bool value(uint32_t node, uint32_t &val) const {
+      uint32_t next = (uint32_t)m_units[node].base;
+      if (m_units[node].base < 0 || next >= m_nunits || m_units[next].check != (int32_t)node)
+        return false;
+      val = (uint32_t)(-1 - m_units[next].base);
+      return true;
+    }
+
+    bool search(const std::string &key, uint32_t &val) const {
+      uint32_t node = ROOT;
+      return !empty() && walk(node, key.data(), key.size()) && value(node, val);
+    }
+
+    /// @brief restore all keys with their values (in order of units)
+    void keys(std::vector< std::pair<std::string, uint32_t> > &res) const {
+      res.clear();
+      for (uint32_t i = 1; i < m_nunits; i++)
+      {
+        int32_t parent = m_units[i].check;
+        if (parent < 0 || (uint32_t)m_units[parent].base != i)
+          continue; // free or not key end unit
+
+        std::string key;
+        for (uint32_t node = (uint32_t)parent; node != ROOT; node = (uint32_t)m_units[node].check)
+          key += (char)(node - m_units[ m_units[node].check ].base - 1);
+        std::reverse(key.begin(), key.end());
+        res.push_back(std::make_pair(key, (uint32_t)(-1 - m_units[i].base)));
+      }
+    }
+};
+
+} // namespace gogo
+
+#endif // GOGO_DA_TRIE_HPP__
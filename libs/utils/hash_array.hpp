@@ -137,6 +137,13 @@ class HashArrayIndexer : public QSerializerOut
       m_dirty = true;
     }
     
+    /// @brief add entry with extra fields (custom hash_entry_t)
+    void add (const hash_entry_t &e) {
+      buckets[e.key & hash_value].push_back (e);
+      m_nentries++;
+      m_dirty = true;
+    }
+    
     // export facilities
 
     // store format is following:
@@ -231,6 +238,9 @@ class HashArraySearcher : public QSerializerIn
     }
     HashArraySearcher() : m_pentries(NULL) {}
     virtual ~HashArraySearcher() {};
+    
+    /// @return total number of entries
+    unsigned amount() const { return (m_pentries) ? bucketIdx.amount() : 0; }
       
 
     // searh key bucklet, then the value itself by bsearch
@@ -295,6 +305,43 @@ class HashArraySearcher : public QSerializerIn
     }
     //-------------------------------------------------------
     
+    //-------------------------------------------------------
+    /// @brief look for range of entries with key @arg k (without copying)
+    /// @arg[out] pfirst - pointer to the first entry of range
+    /// @return number of entries in range
+    unsigned searchRange(Tkey k, const hash_entry_t *&pfirst) const
+    {
+      if (!m_pentries)
+        return 0U;
+      
+      unsigned l, i;
+      unsigned n = bucketIdx.get (k & hash_value, l);
+      unsigned u = l + n;
+      
+      unsigned _u = u, _l = l;
+      
+      while (l < u) 
+      {
+        i = (l + u) / 2;
+        if (m_pentries[i].key > k)
+          u = i;
+        else if (m_pentries[i].key < k)
+          l = i + 1;
+        else {
+          // look for bounds of equal range
+          for (l = i; l > _l && m_pentries[l - 1].key == k; l--)
+            ;
+          for (u = i+1; u < _u && m_pentries[u].key == k; u++)
+            ;
+          pfirst = m_pentries + l;
+          return u - l;
+        }
+      }
+      
+      return 0;
+    }
+    //-------------------------------------------------------
+    
     // searh key bucklet, then the values itself by bsearch
     unsigned search(Tkey k, std::vector<Tval> &vec) const 
     {
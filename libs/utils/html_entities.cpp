@@ -0,0 +1,99 @@
+//---------------------------------------------------------------------
+/// @file  html_entities.cpp
+/// @brief decoding of HTML character references
+/// @date   19.10.2026
+//---------------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+#include "bits/html_entities_tbl.hpp"
+#include "stringutils.hpp"
+
+namespace gogo {
+
+namespace {
+  // characters of references to 0x80..0x9F (they are taken as windows-1252), 0 - no replacement
+  const uint16_t C1_CHARS[0x20] = 
+  {
+    0x20AC, 0,      0x201A, 0x0192, 0x201E, 0x2026, 0x2020, 0x2021, 
+    0x02C6, 0x2030, 0x0160, 0x2039, 0x0152, 0,      0x017D, 0,
+    0,      0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 
+    0x02DC, 0x2122, 0x0161, 0x203A, 0x0153, 0,      0x017E, 0x0178
+  };
+  
+  inline int ref_digit(char c, bool hex)
+  {
+    if (c >= '0' && c <= '9')
+      return c - '0';
+    c |= 0x20;
+    return (hex && c >= 'a' && c <= 'f') ? c - 'a' + 10 : -1;
+  }
+  
+  inline bool is_name_char(char c) 
+  { 
+    return (c >= '0' && c <= '9') || (unsigned)((c | 0x20) - 'a') < 26; 
+  }
+  
+  /// @brief decode "&#N;" or "&#xN;" at @arg s
+  size_t numeric_reference(const char *s, size_t len, uint32_t c[2])
+  {
+    size_t i = 2, first;
+    bool hex = (i < len && (s[i] | 0x20) == 'x');
+    uint32_t v = 0;
+    int d;
+    
+    if (hex)
+      i++;
+    for (first = i; i < len && (d = ref_digit(s[i], hex)) >= 0; i++) {
+      if (v <= 0x10FFFF)
+        v = v * (hex ? 16 : 10) + d;
+    }
+    if (i == first || i == len || s[i] != ';')
+      return 0;
+    
+    if (v == 0 || v > 0x10FFFF || (v >= 0xD800 && v <= 0xDFFF))
+      v = 0xFFFD;
+    else if (v >= 0x80 && v < 0xA0 && C1_CHARS[v - 0x80])
+      v = C1_CHARS[v - 0x80];
+    
+    c[0] = v;
+    c[1] = 0;
+    return i + 1;
+  }
+}
+
+//---------------------------------------------------------------------
+/// @brief decode HTML character reference
+/// @param[in]  s   - text starting by '&'
+/// @param[in]  len - length of text
+/// @param[out] c   - code points of reference (c[1] is 0 unless there are two)
+/// @return length of reference or 0 if there is no known reference
+//---------------------------------------------------------------------
+size_t html_entity_decode(const char *s, size_t len, uint32_t c[2])
+{
+  if (len < 4 || s[0] != '&') // shortest is "&lt;"
+    return 0;
+  if (s[1] == '#')
+    return numeric_reference(s, len, c);
+  
+  size_t n = 0;
+  while (1 + n < len && n <= HTML_ENTITY_NAME_MAX && is_name_char(s[1 + n]))
+    n++;
+  if (!n || n > HTML_ENTITY_NAME_MAX || 1 + n == len || s[1 + n] != ';')
+    return 0;
+  
+  uint32_t h = html_entity_hash(s + 1, n);
+  int idx = HTML_ENTITY_SLOTS[ html_entity_slot(h, HTML_ENTITY_SEEDS[h % HTML_ENTITY_BUCKETS]) ];
+  if (idx < 0)
+    return 0;
+  
+  const html_entity &e = HTML_ENTITIES[idx];
+  if (strncmp(e.name, s + 1, n) || e.name[n])
+    return 0;
+  
+  c[0] = e.c1;
+  c[1] = e.c2;
+  return n + 2;
+}
+
+} // namespace gogo
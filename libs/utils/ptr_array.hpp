@@ -5,6 +5,7 @@
 /// @date   07.05.2009
 //------------------------------------------------------------
 
+#include <stdint.h>
 #include <vector>
 #include <stdexcept>
 #include "memio.hpp"
@@ -55,7 +56,7 @@ class PtrArrayReader : public QSerializerIn
     }
     virtual ~PtrArrayReader() {};
     
-    size_t size() { return (size_t)m_n; }
+    size_t size() const { return (size_t)m_n; }
     
     /// @brief initialize base to offsets
     void setBase(const char *b) { m_pBase = b; }
@@ -79,6 +80,70 @@ class PtrArrayReader : public QSerializerIn
     }
 };
 
+/// @class PtrArrayVarWriter
+/// @brief offset storage of 32 bit (default) or 64 bit offsets
+class PtrArrayVarWriter : public QSerializerOut
+{
+  PtrArrayWriter<uint32_t> m_narrow;
+  PtrArrayWriter<uint64_t> m_wide;
+  bool m_bWide;
+  
+  public:
+    PtrArrayVarWriter() : m_bWide(false) {}
+    /// @brief select offset size (should be set before offsets are added)
+    void setWide(bool bWide) { m_bWide = bWide; }
+    void push_back(uint64_t off) {
+      if (m_bWide)
+        m_wide.push_back(off);
+      else
+        m_narrow.push_back((uint32_t)off);
+    }
+    void clear() { m_narrow.clear(); m_wide.clear(); }
+    
+    virtual size_t size() const { return m_bWide ? m_wide.size() : m_narrow.size(); }
+    virtual void save(MemWriter &mwr) {
+      if (m_bWide)
+        m_wide.save(mwr);
+      else
+        m_narrow.save(mwr);
+    }
+    virtual ~PtrArrayVarWriter() {};
+};
+
+/// @class PtrArrayVarReader
+/// @brief pointer retrieval by 32 or 64 bit offsets (see PtrArrayVarWriter)
+template <typename Tobj = char>
+class PtrArrayVarReader : public QSerializerIn
+{
+  PtrArrayReader<uint32_t, Tobj> m_narrow;
+  PtrArrayReader<uint64_t, Tobj> m_wide;
+  bool m_bWide;
+  
+  public:
+    PtrArrayVarReader() : m_bWide(false) {}
+    /// @brief select offset size (should be set before loading)
+    void setWide(bool bWide) { m_bWide = bWide; }
+    virtual void load(MemReader &mrd) {
+      if (m_bWide)
+        m_wide.load(mrd);
+      else
+        m_narrow.load(mrd);
+    }
+    virtual ~PtrArrayVarReader() {};
+    
+    size_t size() const { return m_bWide ? m_wide.size() : m_narrow.size(); }
+    
+    /// @brief initialize base to offsets
+    void setBase(const char *b) { m_narrow.setBase(b); m_wide.setBase(b); }
+    
+    /// @brief retrieve pointer w/o any checks
+    Tobj *operator[](size_t i) { return m_bWide ? m_wide[i] : m_narrow[i]; }
+    const Tobj *operator[](size_t i) const { return m_bWide ? m_wide[i] : m_narrow[i]; }
+    
+    /// @brief strictly operator[]
+    Tobj *at(size_t i) { return m_bWide ? m_wide.at(i) : m_narrow.at(i); }
+};
+
 }
 
 #endif // GOGO_PTR_ARRAY_HPP__
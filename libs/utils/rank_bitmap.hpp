@@ -0,0 +1,160 @@
+//------------------------------------------------------------
+/// @file  rank_bitmap.hpp
+/// @brief Presence bitmap with rank directory: sparse ID to dense slot mapping
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#ifndef GOGO_RANK_BITMAP_HPP__
+#define GOGO_RANK_BITMAP_HPP__
+
+#include <stdint.h>
+#include <cstring> // memcpy
+#include <vector>
+
+#include "memio.hpp"
+
+/*
+ EXAMPLE OF USAGE:
+
+  RankBitmapWriter bw;
+  bw.set(3);
+  bw.set(700);
+
+  char *data = new char[bw.size()];
+  MemWriter mwr (data);
+  bw.save (mwr);
+
+  MemReader mrd (data);
+  RankBitmapReader br;
+  br.load (mrd);
+
+  unsigned slot;
+  assert (br.rank (700, slot) && slot == 1);
+  assert (!br.test (4));
+*/
+
+namespace gogo
+{
+
+namespace rank_bitmap_impl {
+  static const unsigned WORD_BITS  = 64;
+  static const unsigned BLOCK_WORDS = 4; // rank is stored for every 256 bits
+}
+
+/// @class RankBitmapWriter
+/// @brief bitmap of present IDs
+class RankBitmapWriter : public QSerializerOut
+{
+  std::vector<uint64_t> m_bits;
+  uint32_t m_nbits;
+  uint32_t m_count;
+
+  public:
+    RankBitmapWriter() : m_nbits(0), m_count(0) {}
+    virtual ~RankBitmapWriter() {}
+
+    /// @brief mark ID @arg i present
+    void set(unsigned i) {
+      using namespace rank_bitmap_impl;
+      unsigned w = i / WORD_BITS;
+      if (w >= m_bits.size())
+        m_bits.resize((w / BLOCK_WORDS + 1) * BLOCK_WORDS);
+      if (i >= m_nbits)
+        m_nbits = i + 1;
+
+      uint64_t bit = (uint64_t)1 << (i % WORD_BITS);
+      if (!(m_bits[w] & bit)) {
+        m_bits[w] |= bit;
+        m_count++;
+      }
+    }
+    void clear() { m_bits.clear(); m_nbits = m_count = 0; }
+    /// @return number of present IDs (slots)
+    unsigned count() const { return m_count; }
+
+    // export format: [NBITS][COUNT][NBLOCKS][RANK x NBLOCKS][BITS x NBLOCKS x BLOCK_WORDS]
+    virtual size_t size() const {
+      using namespace rank_bitmap_impl;
+      return 3 * sizeof(uint32_t) + (m_bits.size() / BLOCK_WORDS) * sizeof(uint32_t) +
+          m_bits.size() * sizeof(uint64_t);
+    }
+    virtual void save(MemWriter &mwr) {
+      using namespace rank_bitmap_impl;
+      uint32_t nblocks = m_bits.size() / BLOCK_WORDS, rank = 0, i;
+
+      mwr << m_nbits << m_count << nblocks;
+      for (i = 0; i < nblocks; i++) {
+        mwr << rank;
+        for (unsigned j = 0; j < BLOCK_WORDS; j++)
+          rank += __builtin_popcountll(m_bits[i * BLOCK_WORDS + j]);
+      }
+      for (i = 0; i < m_bits.size(); i++)
+        mwr << m_bits[i];
+    }
+};
+
+/// @class RankBitmapReader
+/// @brief constant time presence check and rank (slot of present ID)
+// Sections may be unaligned in the loaded region: words are copied out.
+class RankBitmapReader : public QSerializerIn
+{
+  const char *m_ranks;
+  const char *m_bits;
+  uint32_t m_nbits;
+  uint32_t m_count;
+
+  private:
+    uint32_t blockRank(unsigned block) const {
+      uint32_t r;
+      memcpy(&r, m_ranks + block * sizeof(uint32_t), sizeof(r));
+      return r;
+    }
+    uint64_t word(unsigned w) const {
+      uint64_t bits;
+      memcpy(&bits, m_bits + w * sizeof(uint64_t), sizeof(bits));
+      return bits;
+    }
+
+  public:
+    RankBitmapReader() : m_ranks(0), m_bits(0), m_nbits(0), m_count(0) {}
+    virtual ~RankBitmapReader() {}
+
+    virtual void load(MemReader &mrd) {
+      using namespace rank_bitmap_impl;
+      uint32_t nblocks;
+
+      mrd >> m_nbits >> m_count >> nblocks;
+      m_ranks = mrd.get();
+      mrd.advance(nblocks * sizeof(uint32_t));
+      m_bits = mrd.get();
+      mrd.advance(nblocks * BLOCK_WORDS * sizeof(uint64_t));
+    }
+
+    /// @return number of present IDs (slots)
+    unsigned count() const { return m_count; }
+
+    /// @return true if ID @arg i is present
+    bool test(unsigned i) const {
+      using namespace rank_bitmap_impl;
+      return i < m_nbits && (word(i / WORD_BITS) & ((uint64_t)1 << (i % WORD_BITS)));
+    }
+
+    /// @brief get slot of ID: number of present IDs less than @arg i
+    /// @return false if ID @arg i isn't present
+    bool rank(unsigned i, unsigned &slot) const {
+      using namespace rank_bitmap_impl;
+      if (!test(i))
+        return false;
+
+      unsigned w = i / WORD_BITS, block = w / BLOCK_WORDS;
+      slot = blockRank(block);
+      for (unsigned j = block * BLOCK_WORDS; j < w; j++)
+        slot += __builtin_popcountll(word(j));
+      slot += __builtin_popcountll(word(w) & (((uint64_t)1 << (i % WORD_BITS)) - 1));
+      return true;
+    }
+};
+
+} // namespace gogo
+
+#endif // GOGO_RANK_BITMAP_HPP__
@@ -3,6 +3,7 @@
 #include <stdint.h>
 
 #include "icuincls.h"
+#include "utf8_tokenizer.hpp"
 
 bool str2bool(const char *s) {
   if (!strcasecmp(s, "yes") || !strcasecmp(s, "true"))
@@ -14,30 +15,12 @@ bool str2bool(const char *s) {
 }
 
 
+/// @brief delete combining diacritics, replace Ё by Е, uppercase the rest
+// (natively, see utf8_normalize)
 void strNormalize(std::string &a_str) 
 {
-    const char *s = a_str.c_str();
-    int32_t length = a_str.length();
-
-    UnicodeString ustring;
-    for ( int32_t i = 0; i < length; )
-    {
-        UChar32 c;
-        U8_NEXT(s, i, length, c);
-
-        // delete combining diacritics
-        if (0x0300 <= c && c <= 0x036F)
-          continue;
-        
-        if (c == L'Ё' || c == L'ё')
-            c = L'Е';
-        else if (u_isULowercase(c))
-            c = u_toupper(c);
-
-        ustring += c;
-    }
-
-    a_str.clear();
-    
-    UnicodeString2UTF8(ustring, &a_str);
+    std::string s;
+    s.reserve(a_str.length());
+    gogo::utf8_normalize(a_str.data(), a_str.length(), s);
+    a_str.swap(s);
 }
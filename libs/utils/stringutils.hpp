@@ -3,6 +3,7 @@
 
 #include <string>
 #include <cstring>
+#include <stdint.h>
 #include <sys/types.h>
 #include "icuincls.h"
 
@@ -66,6 +67,10 @@ size_t base64_decode(const u_char *s, u_char *d, size_t slen = (size_t)-1);
 namespace gogo {
     void str_escape(const char* src, std::string &dest, size_t n = -1U);
     void str_unescape(const char* src, std::string &dest, size_t n = -1U);
+    
+    /// @brief decode HTML character reference at @arg s: "&name;" (HTML5 names), "&#N;" or "&#xN;"
+    /// @return length of reference (0 if it's unknown), code points go to @arg c (c[1] is 0 for one)
+    size_t html_entity_decode(const char *s, size_t len, uint32_t c[2]);
 }
 
 bool str2bool(const char *s);
@@ -0,0 +1,411 @@
+//------------------------------------------------------------
+/// @file  utf8_tokenizer.cpp
+/// @brief Native UTF-8 (and single-byte code page) word splitting and normalization
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#include <stdint.h>
+#include <string.h>
+#include <strings.h>
+#include <stdio.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "icuincls.h"
+#include "hashes/hashes.hpp"
+#include "bits/utf8_tbl.hpp"
+#include "bits/cp1251_tbl.hpp"
+#include "utf8_tokenizer.hpp"
+
+namespace gogo
+{
+
+namespace {
+  /// @brief classified character
+  struct char_info {
+    int32_t  norm;  // normalized character (< 0 - dropped)
+    unsigned flags; // UTF8_FL_*
+  };
+
+  /// @brief classify character at position @arg i and move @arg i to the next one
+  // malformed sequences are decoded by ICU (U8_NEXT) as before, so they
+  // split words the same way
+  inline void next_char(const unsigned char *s, size_t &i, size_t len, char_info &ci)
+  {
+    unsigned c = s[i];
+    if (c < 0x80) {
+      bool lower = (c - 'a') < 26, upper = (c - 'A') < 26;
+      ci.flags = (lower || upper || (c - '0') < 10) ? UTF8_FL_ALNUM : 0;
+      ci.flags |= upper ? UTF8_FL_UPPER : 0;
+      ci.norm = lower ? c - 0x20 : c;
+      i++;
+      return;
+    }
+
+    if (c >= 0xC2 && c <= 0xDF && i + 1 < len && (s[i + 1] & 0xC0) == 0x80) {
+      unsigned k = (((c & 0x1F) << 6) | (s[i + 1] & 0x3F)) - 0x80;
+      ci.flags = UTF8_2B_FLAGS[k];
+      ci.norm = UTF8_2B_NORM[k] ? UTF8_2B_NORM[k] : -1;
+      i += 2;
+      return;
+    }
+
+    // the rest of characters: by ICU
+    UChar32 uc;
+    int32_t pos = 0, rest = (len - i < 4) ? (int32_t)(len - i) : 4;
+    U8_NEXT(s + i, pos, rest, uc);
+    i += pos;
+
+    ci.flags = u_isalnum(uc) ? UTF8_FL_ALNUM : 0;
+    ci.flags |= u_isUUppercase(uc) ? UTF8_FL_UPPER : 0;
+    if (uc < 0 || (0x0300 <= uc && uc <= 0x036F))
+      ci.norm = -1;
+    else
+      ci.norm = u_isULowercase(uc) ? u_toupper(uc) : uc;
+  }
+
+  /// @brief characters of text are UTF-8
+  struct utf8_decoder {
+    void next(const unsigned char *s, size_t &i, size_t len, char_info &ci) const { 
+      next_char(s, i, len, ci); 
+    }
+  };
+
+  /// @brief characters of text are bytes classified by table
+  template<class Tentry>
+  struct table_decoder {
+    const Tentry *m_tbl;
+    table_decoder(const Tentry *tbl) : m_tbl(tbl) {}
+    void next(const unsigned char *s, size_t &i, size_t, char_info &ci) const {
+      const Tentry &e = m_tbl[s[i++]];
+      ci.norm = e.norm;
+      ci.flags = e.flags;
+    }
+  };
+
+  /// @return code point of byte @arg c of code page @arg cp
+  inline uint32_t codepage_char(codepage_t cp, unsigned char c)
+  {
+    if (c < 0x80 || cp != CODEPAGE_CP1251)
+      return c;
+    return CP1251_CHARS[c - 0x80];
+  }
+
+  /// @return byte of code point @arg c in code page @arg cp, -1 if it's missing
+  int codepage_byte(codepage_t cp, uint32_t c)
+  {
+    if (c < 0x80)
+      return (int)c;
+    if (cp != CODEPAGE_CP1251)
+      return -1;
+    
+    unsigned lo = 0, hi = sizeof(CP1251_BYTES) / sizeof(CP1251_BYTES[0]);
+    while (lo < hi) {
+      unsigned mid = (lo + hi) / 2;
+      if (CP1251_BYTES[mid][0] < c)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    return (lo < sizeof(CP1251_BYTES) / sizeof(CP1251_BYTES[0]) && CP1251_BYTES[lo][0] == c) ? 
+           (int)CP1251_BYTES[lo][1] : -1;
+  }
+
+  /// @brief receiver of normalized text: string
+  struct string_out {
+    std::string &m_s;
+    string_out(std::string &s) : m_s(s) {}
+    void append(const char *p, size_t n) { m_s.append(p, n); }
+  };
+
+  /// @brief receiver of normalized text: hash (and string unless NULL)
+  // text is gathered by small buffer and hashed by 4 byte blocks
+  struct hash_out {
+    MurmurHash32Stream &m_h;
+    std::string *m_ps;
+    char   m_buf[64];
+    size_t m_n;
+    
+    hash_out(MurmurHash32Stream &h, std::string *ps) : m_h(h), m_ps(ps), m_n(0) {}
+    void append(const char *p, size_t n) {
+      if (m_n + n > sizeof(m_buf))
+        flush();
+      memcpy(m_buf + m_n, p, n);
+      m_n += n;
+    }
+    void flush() {
+      m_h.add(m_buf, m_n);
+      if (m_ps)
+        m_ps->append(m_buf, m_n);
+      m_n = 0;
+    }
+  };
+
+  template<class Tout>
+  inline void append_utf8(Tout &out, uint32_t c)
+  {
+    char buf[4];
+    size_t n;
+
+    if (c < 0x80) {
+      buf[0] = (char)c;
+      n = 1;
+    }
+    else if (c < 0x800) {
+      buf[0] = (char)(0xC0 | (c >> 6));
+      buf[1] = (char)(0x80 | (c & 0x3F));
+      n = 2;
+    }
+    else if (c < 0x10000) {
+      buf[0] = (char)(0xE0 | (c >> 12));
+      buf[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+      buf[2] = (char)(0x80 | (c & 0x3F));
+      n = 3;
+    }
+    else {
+      buf[0] = (char)(0xF0 | (c >> 18));
+      buf[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+      buf[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+      buf[3] = (char)(0x80 | (c & 0x3F));
+      n = 4;
+    }
+    out.append(buf, n);
+  }
+
+#ifdef __SSE2__
+  /// @return bitmask of bytes of @arg v which are in range [@arg lo, @arg lo + @arg n)
+  inline __m128i in_range(__m128i v, char lo, char n) {
+    __m128i t = _mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - lo)));
+    return _mm_cmplt_epi8(t, _mm_set1_epi8((char)(0x80 + n)));
+  }
+
+  /// @return bitmask of ASCII letters and digits of 16 bytes @arg v
+  inline unsigned ascii_alnum_mask(__m128i v) {
+    __m128i letters = in_range(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 26);
+    return _mm_movemask_epi8(_mm_or_si128(letters, in_range(v, '0', 10)));
+  }
+
+  /// @brief uppercase ASCII letters of 16 bytes @arg v and store them to @arg buf
+  inline void ascii_upper(__m128i v, char *buf) {
+    __m128i lower = in_range(v, 'a', 26);
+    v = _mm_sub_epi8(v, _mm_and_si128(lower, _mm_set1_epi8(0x20)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(buf), v);
+  }
+#endif
+
+  /// @brief find word starting at position @arg pos, normalized word goes to @arg out
+  // ASCII is the same in all code pages, so ASCII runs are taken the same way
+  template<class Tdec, class Tout>
+  bool next_word(const Tdec &dec, const unsigned char *s, size_t &pos, size_t n, 
+                 Utf8Tokenizer::word &w, Tout &out)
+  {
+    size_t i = pos;
+    bool inword = false;
+    char_info ci;
+
+    while (i < n)
+    {
+#ifdef __SSE2__
+      // skip (or take) run of ASCII characters which doesn't change state
+      if (i + 16 <= n) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        unsigned alnum = ascii_alnum_mask(v);
+        unsigned stop = (inword) ? (~alnum & 0xFFFF) : (alnum | _mm_movemask_epi8(v));
+        unsigned run = (stop) ? __builtin_ctz(stop) : 16;
+
+        if (run) {
+          if (inword) {
+            char buf[16];
+            ascii_upper(v, buf);
+            out.append(buf, run);
+          }
+          i += run;
+          continue;
+        }
+      }
+#endif
+
+      size_t start = i;
+      dec.next(s, i, n, ci);
+      if (ci.flags & UTF8_FL_ALNUM) {
+        if (!inword) {
+          inword = true;
+          w.start = start;
+          w.upcase = (ci.flags & UTF8_FL_UPPER) != 0;
+        }
+        if (ci.norm >= 0)
+          append_utf8(out, ci.norm);
+      }
+      else if (inword) {
+        w.len = start - w.start;
+        pos = i;
+        return true;
+      }
+    }
+
+    pos = n;
+    if (inword)
+      w.len = n - w.start;
+    return inword;
+  }
+}
+
+bool Utf8Tokenizer::next(word &w, std::string &norm)
+{
+  string_out out(norm);
+  norm.clear();
+  return next_word(utf8_decoder(), m_s, m_pos, m_len, w, out);
+}
+
+bool Utf8Tokenizer::next(word &w, MurmurHash32Stream &h, std::string *pnorm)
+{
+  hash_out out(h, pnorm);
+  h.begin();
+  if (pnorm)
+    pnorm->clear();
+  bool found = next_word(utf8_decoder(), m_s, m_pos, m_len, w, out);
+  out.flush();
+  return found;
+}
+
+/// @brief characters of code page are classified by UTF-8 tokenizer once
+SingleByteTokenizer::SingleByteTokenizer(codepage_t cp /* = CODEPAGE_CP1251 */) : 
+  m_cp(cp), m_s(NULL), m_len(0), m_pos(0)
+{
+  for (unsigned c = 0; c < 256; c++) 
+  {
+    std::string u;
+    string_out out(u);
+    append_utf8(out, codepage_char(cp, (unsigned char)c));
+    
+    char_info ci;
+    size_t i = 0;
+    next_char(reinterpret_cast<const unsigned char *>(u.data()), i, u.length(), ci);
+    m_tbl[c].norm = ci.norm;
+    m_tbl[c].flags = (uint8_t)ci.flags;
+    m_tbl[c].ulen = (uint8_t)u.length();
+  }
+}
+
+bool SingleByteTokenizer::next(Utf8Tokenizer::word &w, std::string &norm)
+{
+  string_out out(norm);
+  norm.clear();
+  return next_word(table_decoder<char_entry>(m_tbl), m_s, m_pos, m_len, w, out);
+}
+
+bool SingleByteTokenizer::next(Utf8Tokenizer::word &w, MurmurHash32Stream &h, std::string *pnorm)
+{
+  hash_out out(h, pnorm);
+  h.begin();
+  if (pnorm)
+    pnorm->clear();
+  bool found = next_word(table_decoder<char_entry>(m_tbl), m_s, m_pos, m_len, w, out);
+  out.flush();
+  return found;
+}
+
+bool parse_codepage(const char *name, codepage_t &cp)
+{
+  static const struct {
+    const char *name;
+    codepage_t cp;
+  } names[] = {
+    {"utf-8", CODEPAGE_UTF8}, {"utf8", CODEPAGE_UTF8},
+    {"windows-1251", CODEPAGE_CP1251}, {"cp1251", CODEPAGE_CP1251}, {"cp-1251", CODEPAGE_CP1251}
+  };
+  
+  for (unsigned i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+    if (!strcasecmp(name, names[i].name)) {
+      cp = names[i].cp;
+      return true;
+    }
+  }
+  return false;
+}
+
+void codepage_to_utf8(codepage_t cp, const char *s, size_t len, std::string &out)
+{
+  if (cp == CODEPAGE_UTF8) {
+    out.append(s, len);
+    return;
+  }
+  
+  string_out sout(out);
+  for (size_t i = 0; i < len; i++)
+    append_utf8(sout, codepage_char(cp, (unsigned char)s[i]));
+}
+
+void utf8_to_codepage(codepage_t cp, const char *s, size_t len, std::string &out)
+{
+  if (cp == CODEPAGE_UTF8) {
+    out.append(s, len);
+    return;
+  }
+  
+  for (int32_t i = 0; i < (int32_t)len;) 
+  {
+    UChar32 c;
+    U8_NEXT(s, i, (int32_t)len, c);
+    if (c < 0)
+      continue;
+    
+    int b = codepage_byte(cp, (uint32_t)c);
+    if (b >= 0)
+      out += (char)b;
+    else {
+      char ref[16];
+      snprintf(ref, sizeof(ref), "&#%d;", (int)c);
+      out += ref;
+    }
+  }
+}
+
+bool append_codepage_char(codepage_t cp, uint32_t c, std::string &out)
+{
+  if (cp == CODEPAGE_UTF8) {
+    string_out sout(out);
+    append_utf8(sout, c);
+    return true;
+  }
+  
+  int b = codepage_byte(cp, c);
+  if (b < 0)
+    return false;
+  out += (char)b;
+  return true;
+}
+
+void utf8_normalize(const char *str, size_t len, std::string &out)
+{
+  const unsigned char *s = reinterpret_cast<const unsigned char *>(str);
+  size_t i = 0;
+  char_info ci;
+  string_out sout(out);
+
+  while (i < len)
+  {
+#ifdef __SSE2__
+    if (i + 16 <= len) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+      unsigned nonascii = _mm_movemask_epi8(v);
+      unsigned run = (nonascii) ? __builtin_ctz(nonascii) : 16;
+
+      if (run) {
+        char buf[16];
+        ascii_upper(v, buf);
+        out.append(buf, run);
+        i += run;
+        continue;
+      }
+    }
+#endif
+
+    next_char(s, i, len, ci);
+    if (ci.norm >= 0)
+      append_utf8(sout, ci.norm);
+  }
+}
+
+} // namespace gogo
@@ -0,0 +1,142 @@
+//------------------------------------------------------------
+/// @file  utf8_tokenizer.hpp
+/// @brief Native UTF-8 (and single-byte code page) word splitting and normalization
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#ifndef GOGO_UTF8_TOKENIZER_HPP__
+#define GOGO_UTF8_TOKENIZER_HPP__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+
+class MurmurHash32Stream;
+
+/*
+ EXAMPLE OF USAGE:
+
+  Utf8Tokenizer tok;
+  Utf8Tokenizer::word w;
+  std::string norm;
+
+  tok.reset(s.c_str(), s.length());
+  while (tok.next(w, norm))
+    printf("%.*s -> %s\n", (int)w.len, s.c_str() + w.start, norm.c_str());
+*/
+
+namespace gogo
+{
+
+/// @brief code page of text
+typedef enum {
+  CODEPAGE_UTF8,
+  CODEPAGE_CP1251 // windows-1251
+} codepage_t;
+
+/// @brief get code page by name ("utf-8", "windows-1251", etc.)
+/// @return false if code page is unknown
+bool parse_codepage(const char *name, codepage_t &cp);
+
+//---------------------------------------------------------------------------------
+/// @brief splitter of UTF-8 text to words: runs of letters and digits (u_isalnum)
+/// @brief words are normalized the same way as strNormalize() does
+// ASCII runs are processed by 16 bytes (SSE2), two-byte characters (Latin,
+// Cyrillic, etc.) are classified by table, ICU is used for the rest only.
+class Utf8Tokenizer
+{
+  const unsigned char *m_s;
+  size_t m_len;
+  size_t m_pos;
+
+  public:
+    struct word {
+      size_t start;  // offset of word in text
+      size_t len;    // length of word in text (bytes)
+      bool   upcase; // the first character is uppercase
+    };
+
+    Utf8Tokenizer() : m_s(NULL), m_len(0), m_pos(0) {}
+
+    /// @brief start splitting of text @arg s of length @arg len
+    void reset(const char *s, size_t len) {
+      m_s = reinterpret_cast<const unsigned char *>(s);
+      m_len = len;
+      m_pos = 0;
+    }
+
+    /// @brief get next word
+    /// @arg[out] w - word position
+    /// @arg[out] norm - normalized word
+    /// @return false if there are no more words
+    bool next(word &w, std::string &norm);
+
+    /// @brief get next word hashed in the same pass (see MurmurHash32A)
+    /// @arg[out] w - word position
+    /// @arg[out] h - hash of normalized word
+    /// @arg[out] pnorm - normalized word (NULL - isn't needed)
+    /// @return false if there are no more words
+    bool next(word &w, MurmurHash32Stream &h, std::string *pnorm);
+};
+
+//---------------------------------------------------------------------------------
+/// @brief splitter of single-byte text to words: words and their normalization are
+/// @brief the same as of Utf8Tokenizer for text transcoded to UTF-8
+// (normalized words are UTF-8, so their hashes are the same as well)
+class SingleByteTokenizer
+{
+  struct char_entry {
+    int32_t norm;  // normalized character (< 0 - dropped)
+    uint8_t flags; // UTF8_FL_*
+    uint8_t ulen;  // length of character in UTF-8
+  };
+  
+  codepage_t m_cp;
+  char_entry m_tbl[256];
+  const unsigned char *m_s;
+  size_t m_len;
+  size_t m_pos;
+  
+  public:
+    explicit SingleByteTokenizer(codepage_t cp = CODEPAGE_CP1251);
+    
+    codepage_t codepage() const { return m_cp; }
+    
+    /// @brief start splitting of text @arg s of length @arg len
+    void reset(const char *s, size_t len) {
+      m_s = reinterpret_cast<const unsigned char *>(s);
+      m_len = len;
+      m_pos = 0;
+    }
+    
+    /// @brief get next word (see Utf8Tokenizer::next), position is in source bytes
+    bool next(Utf8Tokenizer::word &w, std::string &norm);
+    bool next(Utf8Tokenizer::word &w, MurmurHash32Stream &h, std::string *pnorm);
+    
+    /// @return length of word @arg w in UTF-8 (as it's measured by Utf8Tokenizer)
+    size_t utf8Length(const Utf8Tokenizer::word &w) const {
+      size_t n = 0;
+      for (size_t i = w.start; i < w.start + w.len; i++)
+        n += m_tbl[m_s[i]].ulen;
+      return n;
+    }
+};
+
+/// @brief append normalized UTF-8 string @arg s to @arg out (see strNormalize)
+void utf8_normalize(const char *s, size_t len, std::string &out);
+
+/// @brief append text @arg s of single-byte code page @arg cp transcoded to UTF-8 to @arg out
+void codepage_to_utf8(codepage_t cp, const char *s, size_t len, std::string &out);
+
+/// @brief append UTF-8 text @arg s transcoded to code page @arg cp to @arg out
+/// characters missing from code page are written as HTML numeric references (&#NNNN;),
+/// malformed sequences are dropped
+void utf8_to_codepage(codepage_t cp, const char *s, size_t len, std::string &out);
+
+/// @brief append character @arg c in code page @arg cp to @arg out
+/// @return false if it's missing from code page (nothing is appended)
+bool append_codepage_char(codepage_t cp, uint32_t c, std::string &out);
+
+} // namespace gogo
+
+#endif // GOGO_UTF8_TOKENIZER_HPP__
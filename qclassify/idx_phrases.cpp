@@ -23,7 +23,8 @@ int
 main(int argc, char *argv[])
 {
     string cfgfile = "config.xml";
-    bool bSave = true, bUseLemm  = true;
+    const char *formspath = NULL;
+    bool bSave = true, bUseLemm  = true, bForms = false, bTrie = false;
 
     {
       extern int optind;
@@ -31,7 +32,7 @@ main(int argc, char *argv[])
       
       progname = argv[0];
       int  c;
-      while ( (c = getopt(argc, argv, "c:LSv")) != -1) 
+      while ( (c = getopt(argc, argv, "c:FLSTvW:")) != -1) 
           switch(c) {
               case 'S':
                   bSave = false;
@@ -42,6 +43,15 @@ main(int argc, char *argv[])
               case 'L':
                   bUseLemm = false;
                   break;
+              case 'F':
+                  bForms = true;
+                  break;
+              case 'T':
+                  bTrie = true;
+                  break;
+              case 'W':
+                  formspath = optarg;
+                  break;
                   
               case 'v':
                 printf("Format version: %d\n", qcls_impl::QCLASSIFY_INDEX_VERSION);
@@ -70,7 +80,13 @@ main(int argc, char *argv[])
       
       PhraseCollectionIndexer idx;
       idx.setLemmatizer(plem);
+      if (bTrie)
+        idx.setExactTrie(true);
       idx.indexByConfig(&cfg);
+      if (bForms)
+        idx.setFormsTable(true);
+      if (formspath)
+        idx.addWordForms(formspath);
       
       if (bSave) {
         idx.save();
@@ -85,10 +101,13 @@ main(int argc, char *argv[])
 
 static void usage()
 {
-    fprintf(stderr, "Usage: %s [-SL] [-c config]\n", progname);
+    fprintf(stderr, "Usage: %s [-SLFT] [-c config] [-W word_forms]\n", progname);
     fprintf(stderr, "\t-c - use specified config file\n");
     fprintf(stderr, "\t-S - don't save index file\n");
-    fprintf(stderr, "\t-L - don't use lemmatizer\n\n");
+    fprintf(stderr, "\t-L - don't use lemmatizer\n");
+    fprintf(stderr, "\t-F - save table of word forms (searcher resolves them without lemmatizer)\n");
+    fprintf(stderr, "\t-W - add word forms of file (word per line) to table, implies -F\n");
+    fprintf(stderr, "\t-T - save trie of plain phrases (exact engine of marker)\n\n");
     
     exit(EX_USAGE);
 }
@@ -0,0 +1,485 @@
+//------------------------------------------------------------
+/// @file   qcbench.cpp
+/// @brief  phrase searcher latency benchmarks
+/// @date   19.10.2026
+//------------------------------------------------------------
+
+#include <vector>
+#include <string>
+#include <iostream>
+#include <memory>
+#include <algorithm>
+#include <stdexcept>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sysexits.h>
+#include <sys/time.h>
+
+#include "qclassify/qclassify.hpp"
+#include "qclassify/qclassify_impl.hpp"
+#include "utils/utf8_tokenizer.hpp"
+#include "hashes/hashes.hpp"
+
+using namespace std;
+using namespace gogo;
+
+static char *progname;
+static void usage();
+
+namespace {
+
+struct bench_opts {
+  string   cfgfile;
+  string   classes; // comma separated class names to search for (replay)
+  bool     bUseLemm;
+  bool     bBestOnly;
+  unsigned nphrases;
+  unsigned nwords;
+  unsigned nqueries;
+  unsigned topk;
+  unsigned threshold;
+  unsigned seed;
+
+  bench_opts() : cfgfile("config.xml"), bUseLemm(true), bBestOnly(false), nphrases(100000), nwords(400), nqueries(10000), topk(0), threshold(64), seed(1) {}
+};
+
+/// @brief latency accumulator (microseconds)
+class LatencyStat
+{
+  vector<double> m_samples;
+  double m_total;
+
+  public:
+    LatencyStat() : m_total(0) {}
+    void add(double usec) { m_samples.push_back(usec); m_total += usec; }
+
+    void print(const char *title) {
+      if (m_samples.empty())
+        return;
+
+      sort(m_samples.begin(), m_samples.end());
+      printf("%-24s avg %8.2fus  p50 %8.2fus  p99 %8.2fus  max %8.2fus\n", title,
+             m_total / m_samples.size(),
+             m_samples[m_samples.size() / 2],
+             m_samples[(m_samples.size() * 99) / 100],
+             m_samples.back());
+    }
+};
+
+inline double now_usec()
+{
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return tv.tv_sec * 1e6 + tv.tv_usec;
+}
+
+/// @brief reproducible pseudo-random generator
+inline unsigned next_rand(unsigned &state)
+{
+  state = state * 1103515245 + 12345;
+  return (state >> 16) & 0x7FFF;
+}
+
+/// @brief make cyrillic pseudo-word by number
+string make_word(unsigned n)
+{
+  static const char *syllables[] = {
+    "ба", "ве", "ги", "до", "жу", "зы", "ка", "ле", "ми", "но",
+    "пу", "ры", "са", "те", "фи", "хо"
+  };
+
+  string w;
+  do {
+    w += syllables[n % VSIZE(syllables)];
+    n /= VSIZE(syllables);
+  } while (n);
+
+  return w + "ра";
+}
+
+/// @brief latency slot by number of space separated words in query: 1, 2, 3, more
+unsigned length_slot(const string &s)
+{
+  unsigned n = 0;
+  for (unsigned i = 0; i < s.size(); i++) {
+    if (s[i] != ' ' && (!i || s[i - 1] == ' '))
+      n++;
+  }
+  return (n) ? min(n, 4U) - 1 : 0;
+}
+
+/// @brief index phrases in memory and load searcher over it
+void build_searcher(const vector<string> &phrases, unsigned threshold,
+                    vector<char> &region, PhraseSearcher &srch)
+{
+  PhraseIndexer idx;
+  PhraseIndexer::stat st;
+
+  idx.setHotKeywordThreshold(threshold);
+  for (unsigned i = 0; i < phrases.size(); i++)
+    idx.addPhrase(0, phrases[i], 100);
+
+  idx.optimize();
+  region.resize(idx.size());
+  MemWriter mwr(&region[0]);
+  idx.save(mwr);
+
+  idx.getStat(&st);
+  printf("threshold=%u: %u phrases, %u words; %u hot keywords (%u phrases by pair)\n",
+         threshold, st.nphrases_uniq, st.nwords_uniq, st.nhotwords, st.nhotphrases);
+
+  MemReader mrd(&region[0]);
+  srch.load(mrd);
+}
+
+/// @brief run queries and collect per-query latency
+/// @arg[out] lat_by_len - optional latency by number of query words (1, 2, 3, more)
+/// @return number of distinct phrases matched
+// (query with repeated word could match the same phrase several times)
+unsigned run_queries(const PhraseSearcher &srch, const vector<string> &queries, LatencyStat &lat,
+                     LatencyStat *lat_by_len = NULL)
+{
+  vector<PhraseSearcher::phrase_matched> vres;
+  vector<unsigned> ids;
+  unsigned nmatched = 0;
+
+  for (unsigned i = 0; i < queries.size(); i++) {
+    double t = now_usec();
+    srch.searchPhrase(queries[i], vres);
+    t = now_usec() - t;
+    lat.add(t);
+    if (lat_by_len)
+      lat_by_len[length_slot(queries[i])].add(t);
+
+    ids.clear();
+    for (unsigned j = 0; j < vres.size(); j++)
+      ids.push_back(vres[j].phrase_id);
+    sort(ids.begin(), ids.end());
+    nmatched += unique(ids.begin(), ids.end()) - ids.begin();
+  }
+
+  return nmatched;
+}
+
+/// @brief worst case for keyword addressing:
+/// every phrase is built of words from small vocabulary,
+/// so posting lists of all keywords are long.
+int bench_hotwords(const bench_opts &opts)
+{
+  unsigned rnd = opts.seed, i;
+  vector<string> phrases, queries;
+
+  for (i = 0; i < opts.nphrases; i++) {
+    unsigned n = 2 + next_rand(rnd) % 2;
+    unsigned w[3];
+    string s;
+
+    for (unsigned j = 0; j < n; j++) {
+      w[j] = next_rand(rnd) % opts.nwords;
+      if (find(w, w + j, w[j]) != w + j) { // words of phrase must be distinct
+        j--;
+        continue;
+      }
+      if (j)
+        s += ' ';
+      s += make_word(w[j]);
+    }
+    phrases.push_back(s);
+  }
+
+  for (i = 0; i < opts.nqueries; i++) {
+    string s;
+    for (unsigned j = 0; j < 4; j++) {
+      if (j)
+        s += ' ';
+      s += make_word(next_rand(rnd) % opts.nwords);
+    }
+    queries.push_back(s);
+  }
+
+  unsigned nmatched[2];
+  for (i = 0; i < 2; i++)
+  {
+    vector<char> region;
+    PhraseSearcher srch;
+    LatencyStat lat;
+
+    build_searcher(phrases, i ? opts.threshold : 0, region, srch);
+    nmatched[i] = run_queries(srch, queries, lat);
+    lat.print(i ? "pair index:" : "keyword index:");
+  }
+
+  if (nmatched[0] != nmatched[1]) {
+    fprintf(stderr, "matched phrases differ: %u vs %u\n", nmatched[0], nmatched[1]);
+    return 1;
+  }
+
+  printf("%u phrases matched by %u queries\n", nmatched[0], opts.nqueries);
+  return 0;
+}
+
+/// @brief replay queries (one per line) from stdin against collection of config
+int bench_replay(const bench_opts &opts)
+{
+  vector<string> queries;
+  string s;
+  
+  while (getline(cin, s)) {
+    if (!s.empty())
+      queries.push_back(s);
+  }
+  
+  XmlConfig cfg(opts.cfgfile.c_str());
+  auto_ptr<LemInterface> plem;
+  if (opts.bUseLemm && cfg.GetBool("QueryQualifier", "UseLemmatizer", true))
+    plem.reset(new LemInterface(true /* UTF8 */));
+  
+  PhraseCollectionLoader ldr(plem.get());
+  ldr.loadByConfig(&cfg);
+  if (!ldr.is_loaded())
+    throw std::runtime_error("Phrase collection not loaded");
+  
+  QCClassMask mask;
+  for (size_t pos = 0; pos < opts.classes.size(); ) {
+    size_t end = opts.classes.find(',', pos);
+    if (end == string::npos)
+      end = opts.classes.size();
+    
+    unsigned clsid;
+    string name = opts.classes.substr(pos, end - pos);
+    if (!ldr.getQCIndex().getId(name, clsid))
+      throw std::runtime_error("Unknown class: " + name);
+    mask.add(clsid);
+    pos = end + 1;
+  }
+  
+  LatencyStat lat, lat_by_len[4];
+  unsigned nmatched = 0;
+  if (opts.topk) {
+    vector<PhraseSearcher::cls_matched> top;
+    
+    for (unsigned i = 0; i < queries.size(); i++) {
+      double t = now_usec();
+      nmatched += ldr->searchTopK(queries[i], opts.topk, top, &mask);
+      t = now_usec() - t;
+      lat.add(t);
+      lat_by_len[length_slot(queries[i])].add(t);
+    }
+  }
+  else if (opts.bBestOnly) {
+    unsigned clsid;
+    PhraseSearcher::phrase_info info;
+    
+    for (unsigned i = 0; i < queries.size(); i++) {
+      double t = now_usec();
+      nmatched += ldr->searchBest(queries[i], clsid, info, &mask) ? 1 : 0;
+      t = now_usec() - t;
+      lat.add(t);
+      lat_by_len[length_slot(queries[i])].add(t);
+    }
+  }
+  else {
+    QCResultArray res;
+    LatencyStat lat_ranked;
+    
+    nmatched = run_queries(*ldr.getSearcher(), queries, lat, lat_by_len);
+    
+    // ranked search prunes candidates which can't be ranked by penalties
+    for (unsigned i = 0; i < queries.size(); i++) {
+      double t = now_usec();
+      ldr->searchPhrase(queries[i], res, &mask);
+      lat_ranked.add(now_usec() - t);
+    }
+    lat_ranked.print("ranked (result array):");
+  }
+  
+  PhraseSearcher::search_stat st;
+  LemmaCache::stat lst;
+  ldr->getSearchStat(&st);
+  ldr->getLemmaStat(&lst);
+  
+  lat.print(opts.topk ? "replay (top k):" : (opts.bBestOnly ? "replay (best only):" : "replay:"));
+  lat_by_len[0].print("  1 word:");
+  lat_by_len[1].print("  2 words:");
+  lat_by_len[2].print("  3 words:");
+  lat_by_len[3].print("  4+ words:");
+  printf("%u results for %u queries\n", nmatched, (unsigned)queries.size());
+  printf("ranked search: %u candidates, %u pruned before verification, %u dropped after, "
+         "%u skipped by rank bound, %u by class mask\n", st.nvisited, st.npruned, st.ndropped, st.nbounded, st.nfiltered);
+  printf("lemma cache: %llu hits, %llu misses, %llu evictions, %llu bypassed\n", 
+         (unsigned long long)lst.hits, (unsigned long long)lst.misses, 
+         (unsigned long long)lst.evictions, (unsigned long long)lst.bypassed);
+  return 0;
+}
+
+/// @brief per-word cost of word splitting for text lines from stdin:
+/// normalization and hashing in separate passes vs. fused pass, whole splitter
+int bench_words(const bench_opts &opts)
+{
+  static const unsigned NROUNDS = 10;
+  vector<string> lines;
+  string s;
+  
+  while (getline(cin, s))
+    lines.push_back(s);
+  
+  Utf8Tokenizer tok;
+  Utf8Tokenizer::word w;
+  MurmurHash32Stream h;
+  uint32_t sum[2] = {0, 0};
+  unsigned nwords = 0, r, i;
+  double t[3];
+  
+  t[0] = now_usec();
+  for (r = 0; r < NROUNDS; r++) {
+    for (i = 0; i < lines.size(); i++) {
+      tok.reset(lines[i].c_str(), lines[i].length());
+      while (tok.next(w, s)) {
+        sum[0] += MurmurHash32A(s.data(), s.length());
+        nwords++;
+      }
+    }
+  }
+  t[0] = now_usec() - t[0];
+  
+  t[1] = now_usec();
+  for (r = 0; r < NROUNDS; r++) {
+    for (i = 0; i < lines.size(); i++) {
+      tok.reset(lines[i].c_str(), lines[i].length());
+      while (tok.next(w, h, NULL))
+        sum[1] += h.end();
+    }
+  }
+  t[1] = now_usec() - t[1];
+  
+  auto_ptr<LemInterface> plem;
+  if (opts.bUseLemm)
+    plem.reset(new LemInterface(true /* UTF8 */));
+  PhraseSplitterPlain splitter;
+  splitter.setLemmatizer(plem.get());
+  
+  t[2] = now_usec();
+  for (r = 0; r < NROUNDS; r++) {
+    for (i = 0; i < lines.size(); i++)
+      splitter.split(lines[i]);
+  }
+  t[2] = now_usec() - t[2];
+  
+  if (sum[0] != sum[1]) {
+    fprintf(stderr, "word hashes differ\n");
+    return 1;
+  }
+  if (!nwords)
+    return 0;
+  
+  printf("%u words in %u lines\n", nwords / NROUNDS, (unsigned)lines.size());
+  printf("%-24s %8.1fns/word\n", "normalize, then hash:", t[0] * 1000 / nwords);
+  printf("%-24s %8.1fns/word\n", "normalize-and-hash:", t[1] * 1000 / nwords);
+  printf("%-24s %8.1fns/word\n", opts.bUseLemm ? "splitter (lemmatizer):" : "splitter:", t[2] * 1000 / nwords);
+  return 0;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+  bench_opts opts;
+
+  {
+    extern int optind;
+    extern char *optarg;
+
+    progname = argv[0];
+    int  c;
+    while ( (c = getopt(argc, argv, "c:LBk:m:n:w:q:t:s:")) != -1) {
+      switch(c) {
+        case 'c':
+          opts.cfgfile = optarg;
+          break;
+        case 'L':
+          opts.bUseLemm = false;
+          break;
+        case 'B':
+          opts.bBestOnly = true;
+          break;
+        case 'k':
+          opts.topk = atoi(optarg);
+          break;
+        case 'm':
+          opts.classes = optarg;
+          break;
+        case 'n':
+          opts.nphrases = atoi(optarg);
+          break;
+        case 'w':
+          opts.nwords = atoi(optarg);
+          break;
+        case 'q':
+          opts.nqueries = atoi(optarg);
+          break;
+        case 't':
+          opts.threshold = atoi(optarg);
+          break;
+        case 's':
+          opts.seed = atoi(optarg);
+          break;
+
+        default:
+          usage();
+      }
+    }
+
+    argc -= optind;
+    argv += optind;
+    if (!argc)
+      usage();
+  }
+
+  if (opts.nwords < 3)
+    usage();
+
+  try {
+    string mode = argv[0];
+    if (mode == "hotwords")
+      return bench_hotwords(opts);
+    if (mode == "replay")
+      return bench_replay(opts);
+    if (mode == "words")
+      return bench_words(opts);
+
+    usage();
+  }
+  catch (std::exception &e) {
+    fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  return 0;
+}
+
+
+static void usage()
+{
+  fprintf(stderr, "Usage: %s [options] mode\n", progname);
+  fprintf(stderr, "Modes:\n");
+  fprintf(stderr, "\thotwords - synthetic worst case of long keyword posting lists;\n"
+                  "\t           compare keyword index and hot keyword pair index\n");
+  fprintf(stderr, "\treplay   - search queries from stdin (one per line) in collection of config;\n"
+                  "\t           e.g. phrases as queries: cat data/phrases_proj/*.txt | %s -c config.xml replay\n", progname);
+  fprintf(stderr, "\twords    - per-word cost of splitting text from stdin to normalized hashed words\n");
+  fprintf(stderr, "Options:\n");
+  fprintf(stderr, "\t-c - use specified config file (replay)\n");
+  fprintf(stderr, "\t-L - don't use lemmatizer (replay, words)\n");
+  fprintf(stderr, "\t-B - search the best class only (replay)\n");
+  fprintf(stderr, "\t-k - search k best classes (replay)\n");
+  fprintf(stderr, "\t-m - comma separated classes to search for (replay)\n");
+  fprintf(stderr, "\t-n - number of phrases (100000)\n");
+  fprintf(stderr, "\t-w - vocabulary size (400)\n");
+  fprintf(stderr, "\t-q - number of queries (10000)\n");
+  fprintf(stderr, "\t-t - hot keyword threshold (64)\n");
+  fprintf(stderr, "\t-s - random seed (1)\n\n");
+  exit (EX_USAGE);
+}
@@ -22,6 +22,7 @@ using namespace std;
 using namespace gogo;
 
 extern LemInterface lem;
+extern unsigned g_nallocs; // heap allocations (see qclassify_test.cpp)
 
 static const char *CONFIG_PATH_SIMPLE="cfg/config_simple.xml";
 static const char *CONFIG_PATH_MARKERCFG="cfg/config_markercfg.xml";
@@ -185,8 +186,10 @@ class QCMarkupHtmlTest : public CppUnit::TestFixture
     CPPUNIT_ASSERT_EQUAL(0U, def.gap);
     CPPUNIT_ASSERT_EQUAL(3U, def.nmax);
     CPPUNIT_ASSERT_EQUAL(true, def.bSkipFirstWord);
+    CPPUNIT_ASSERT_EQUAL(false, def.bSkipRawText);
     CPPUNIT_ASSERT_EQUAL(true, def.bUniq);
     CPPUNIT_ASSERT_EQUAL(QCHtmlMarker::MARKUP_ORDER_RANK_DESC, def.order);
+    CPPUNIT_ASSERT_EQUAL(CODEPAGE_UTF8, def.codepage);
   }
   
   void MarkerNothingToMarkTest()
@@ -314,6 +317,193 @@ class QCMarkupHtmlTest : public CppUnit::TestFixture
     CPPUNIT_ASSERT_EQUAL_MESSAGE( "wrong escaping?", output, os );
   }
   
+  // windows-1251 text is marked as it's UTF-8 version, markup is in windows-1251 (URLs are UTF-8)
+  void Cp1251MarkupTest()
+  {
+    XmlConfig cfg(CONFIG_PATH_MARKERCFG);
+    PhraseCollectionLoader ldr(&lem);
+    CPPUNIT_ASSERT_NO_THROW(CPPUNIT_ASSERT_EQUAL_MESSAGE("Phrase index loading failed", true, ldr.loadByConfig(&cfg)));
+    
+    QCHtmlMarker mrk(ldr.getSearcher());
+    mrk.loadSettings(&cfg);
+    
+    static const char *inputs[] = {
+      "наши терминаторы наступают!", // %O
+      "дистрибутив Ubuntu а также Fedora Core", // %U
+      "Have you ever taste Carte Noire or another one - Nescafe coffees?",
+      "Глава 2: длинный посох с которым он путешествовал последние 20 лет", // %Q, %S
+      "<p>&laquo;Рубин&raquo; (Казань)&nbsp;&mdash; &laquo;Ростов&raquo; (Ростов-на-Дону)&nbsp;&mdash; 0:2,</p>" // %M
+    };
+    
+    QCHtmlMarker::MarkupSettings st = mrk.getConfigSettings(), st_cp;
+    st.bSkipFirstWord = false;
+    st_cp = st;
+    st_cp.codepage = CODEPAGE_CP1251;
+    
+    for (unsigned i = 0; i < VSIZE(inputs); i++) {
+      string input(inputs[i]), input_cp, os, os_cp, expected;
+      
+      utf8_to_codepage(CODEPAGE_CP1251, input.data(), input.length(), input_cp);
+      unsigned n = mrk.markup(input, os, st);
+      CPPUNIT_ASSERT(n > 0);
+      CPPUNIT_ASSERT_EQUAL(n, mrk.markup(input_cp, os_cp, st_cp));
+      
+      utf8_to_codepage(CODEPAGE_CP1251, os.data(), os.length(), expected);
+      CPPUNIT_ASSERT_EQUAL(expected, os_cp);
+    }
+  }
+  
+  void SkipRawTextTest()
+  {
+    XmlConfig cfg(CONFIG_PATH_MARKERCFG);
+    PhraseCollectionLoader ldr(&lem);
+    CPPUNIT_ASSERT_NO_THROW(CPPUNIT_ASSERT_EQUAL_MESSAGE("Phrase index loading failed", true, ldr.loadByConfig(&cfg)));
+    
+    QCHtmlMarker mrk(ldr.getSearcher());
+    mrk.loadSettings(&cfg);
+    
+    QCHtmlMarker::MarkupSettings st = mrk.getConfigSettings();
+    st.bSkipFirstWord = false;
+    st.bUniq = false;
+    
+    const string input = "<script type=\"text/javascript\">var s = \"<b>Казань</b>\";</script><p>Казань</p>";
+    string os;
+    
+    CPPUNIT_ASSERT_EQUAL(2U, mrk.markup(input, os, st));
+    
+    st.bSkipRawText = true;
+    CPPUNIT_ASSERT_EQUAL(1U, mrk.markup(input, os, st));
+    CPPUNIT_ASSERT_EQUAL("<script type=\"text/javascript\">var s = \"<b>Казань</b>\";</script><p>" + 
+                         EncodeAddress("Казань", "0JrQsNC30LDQvdGM") + "</p>", os);
+    
+    CPPUNIT_ASSERT_EQUAL(1U, mrk.markup("<TEXTAREA>Казань</textarea>Казань", os, st));
+    CPPUNIT_ASSERT_EQUAL(0U, mrk.markup("<style>Казань</styles>Казань", os, st));
+  }
+  
+  // words are searched with decoded character references, markup keeps them as they are
+  void EntityMarkupTest()
+  {
+    XmlConfig cfg(CONFIG_PATH_MARKERCFG);
+    PhraseCollectionLoader ldr(&lem);
+    CPPUNIT_ASSERT_NO_THROW(CPPUNIT_ASSERT_EQUAL_MESSAGE("Phrase index loading failed", true, ldr.loadByConfig(&cfg)));
+    
+    QCHtmlMarker mrk(ldr.getSearcher());
+    mrk.loadSettings(&cfg);
+    
+    QCHtmlMarker::MarkupSettings st = mrk.getConfigSettings(), st_cp;
+    st.bSkipFirstWord = false;
+    st_cp = st;
+    st_cp.codepage = CODEPAGE_CP1251;
+    
+    static const char *kazan[] = {
+      "&#1050;&#1072;&#1079;&#1072;&#1085;&#1100;", "&#x41A;азань", "&Kcy;&acy;&zcy;&acy;&ncy;&softcy;"
+    };
+    for (unsigned i = 0; i < VSIZE(kazan); i++) {
+      string os;
+      CPPUNIT_ASSERT_EQUAL_MESSAGE(kazan[i], 1U, mrk.markup(kazan[i], os, st));
+      CPPUNIT_ASSERT_EQUAL(EncodeAddress(kazan[i], "0JrQsNC30LDQvdGM"), os);
+    }
+    
+    const string input = "<p>Ростов&#x2D;на&#45;Дону&comma; Казань&period;</p>", 
+                 output = "<p>" + EncodeAddress("Ростов&#x2D;на&#45;Дону", "0KDQvtGB0YLQvtCyLdC90LAt0JTQvtC90YM%3D") + 
+                          "&comma; " + EncodeAddress("Казань", "0JrQsNC30LDQvdGM") + "&period;</p>";
+    string os, input_cp, os_cp, expected;
+    
+    CPPUNIT_ASSERT_EQUAL(2U, mrk.markup(input, os, st));
+    CPPUNIT_ASSERT_EQUAL(output, os);
+    
+    utf8_to_codepage(CODEPAGE_CP1251, input.data(), input.length(), input_cp);
+    utf8_to_codepage(CODEPAGE_CP1251, output.data(), output.length(), expected);
+    CPPUNIT_ASSERT_EQUAL(2U, mrk.markup(input_cp, os_cp, st_cp));
+    CPPUNIT_ASSERT_EQUAL(expected, os_cp);
+  }
+  
+  // repeated markup with context of caller doesn't allocate
+  void MarkupNoAllocTest()
+  {
+    XmlConfig cfg(CONFIG_PATH_MARKERCFG);
+    PhraseCollectionLoader ldr(&lem);
+    CPPUNIT_ASSERT_NO_THROW(CPPUNIT_ASSERT_EQUAL_MESSAGE("Phrase index loading failed", true, ldr.loadByConfig(&cfg)));
+    
+    QCHtmlMarker mrk(ldr.getSearcher());
+    mrk.loadSettings(&cfg);
+    
+    static const char *inputs[] = {
+      "наши терминаторы наступают!", // %O
+      "дистрибутив Ubuntu а также Fedora Core", // %U
+      "Глава 2: длинный посох с которым он путешествовал последние 20 лет", // %Q, %S
+      "<p>&laquo;Рубин&raquo; (Казань)&nbsp;&mdash; &laquo;Ростов&raquo; (Ростов&#x2D;на&#45;Дону)&nbsp;&mdash; 0:2,</p>" // %M
+    };
+    
+    QCHtmlMarker::MarkupSettings st = mrk.getConfigSettings(), st_freq, st_cp;
+    st.bSkipFirstWord = false;
+    st_freq = st;
+    st_freq.order = QCHtmlMarker::MARKUP_ORDER_FREQ_DESC;
+    st_freq.gap = 1;
+    st_cp = st;
+    st_cp.codepage = CODEPAGE_CP1251;
+    
+    string text, text_cp, os, expected, expected_cp;
+    for (unsigned i = 0; i < VSIZE(inputs); i++)
+      text = text + inputs[i] + "<br />";
+    utf8_to_codepage(CODEPAGE_CP1251, text.data(), text.length(), text_cp);
+    
+    QCHtmlMarker::MarkupContext ctx;
+    unsigned n = mrk.markup(text, expected, st);
+    unsigned n_freq = mrk.markup(text, os, st_freq);
+    CPPUNIT_ASSERT(n > 0 && n_freq > 0);
+    
+    // warm up buffers
+    CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text, os, st, ctx));
+    CPPUNIT_ASSERT_EQUAL(expected, os);
+    CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text_cp, expected_cp, st_cp, ctx));
+    CPPUNIT_ASSERT_EQUAL(n_freq, mrk.markup(text, os, st_freq, ctx));
+    
+    unsigned nallocs = g_nallocs;
+    for (unsigned i = 0; i < 10; i++) {
+      CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text, os, st, ctx));
+      CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text_cp, os, st_cp, ctx));
+      CPPUNIT_ASSERT_EQUAL(n_freq, mrk.markup(text, os, st_freq, ctx));
+    }
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("markup allocates memory", nallocs, g_nallocs);
+    
+    CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text, os, st, ctx));
+    CPPUNIT_ASSERT_EQUAL(expected, os);
+    CPPUNIT_ASSERT_EQUAL(n, mrk.markup(text_cp, os, st_cp, ctx));
+    CPPUNIT_ASSERT_EQUAL(expected_cp, os);
+  }
+  
+  // phrase of rank tie (exact and partial match) is marked by class of lower ID as selectBest selects
+  void MarkupRankTieTest()
+  {
+    QCIndexWriter qcw;
+    PhraseIndexer idx;
+    QCPenalties pens; // no penalties
+    
+    qcw.addQClass("first", pens);
+    qcw.addQClass("second", pens);
+    idx.addPhrase(0, "ноутбук", 100, "<b class=\"first\">%P</b>");
+    idx.addPhrase(1, "ноутбук lenovo", 100, "<b class=\"second\">%P</b>");
+    
+    auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+    MemWriter mwr (region.get());
+    CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+    CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+    
+    MemReader mrd (region.get());
+    QCIndexReader qcr;
+    PhraseSearcher srch;
+    CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+    CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+    srch.setQCIndex(&qcr);
+    
+    QCHtmlMarker mrk(&srch);
+    string os;
+    CPPUNIT_ASSERT_EQUAL(1U, mrk.markup("ноутбук lenovo", os));
+    CPPUNIT_ASSERT(os.find("class=\"first\"") != string::npos);
+    CPPUNIT_ASSERT(os.find("class=\"second\"") == string::npos);
+  }
+  
   public:
     CPPUNIT_TEST_SUITE (QCMarkupHtmlTest);
         CPPUNIT_TEST (PrepareIndex);
@@ -328,6 +518,11 @@ class QCMarkupHtmlTest : public CppUnit::TestFixture
         CPPUNIT_TEST (UseUdataAsFormatMeaningTest);
         CPPUNIT_TEST (UrlEscapedStringSkipWell);
         CPPUNIT_TEST (EscapingSpecialMarkersTest);
+        CPPUNIT_TEST (Cp1251MarkupTest);
+        CPPUNIT_TEST (SkipRawTextTest);
+        CPPUNIT_TEST (EntityMarkupTest);
+        CPPUNIT_TEST (MarkupNoAllocTest);
+        CPPUNIT_TEST (MarkupRankTieTest);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -11,6 +11,7 @@
 
 #include <stdexcept>
 #include <cstdlib>
+#include <cstdio>
 #include <vector>
 #include <ctime>
 #include <memory>
@@ -20,12 +21,27 @@
 #include "defs.hpp"
 #include "utils/hash_array.hpp"
 #include "utils/ptr_array.hpp"
+#include "utils/rank_bitmap.hpp"
 #include "qclassify/qclassify.hpp"
 #include "qclassify/qclassify_impl.hpp"
 
 using namespace std;
 using namespace gogo;
 
+// counting of heap allocations (see QPhraseSearchNoAllocTest, QCMarkupHtmlTest::MarkupNoAllocTest)
+unsigned g_nallocs = 0;
+
+void *operator new(size_t sz) throw(std::bad_alloc)
+{
+  g_nallocs++;
+  void *p = malloc(sz ? sz : 1);
+  if (!p)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) throw() { free(p); }
+
 LemInterface lem(true /* UTF8 */);
 
 class QClassifyTest : public CppUnit::TestFixture
@@ -65,6 +81,65 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT_THROW(pr.at(VSIZE(arr) + 1), std::out_of_range);
     }
     
+    /// @brief presence bitmap should map sparse IDs to dense slots
+    void RankBitmapTest()
+    {
+      unsigned ids[] = {0, 3, 63, 64, 255, 256, 700, 1023, 1024, 5000};
+      RankBitmapWriter bw;
+      unsigned i, slot;
+      
+      for (i = VSIZE(ids); i; i--) {
+        bw.set(ids[i - 1]);
+        bw.set(ids[i - 1]); // twice
+      }
+      CPPUNIT_ASSERT_EQUAL((unsigned)VSIZE(ids), bw.count());
+      
+      auto_ptr_arr<char> region (new char[bw.size() ]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(bw.save (mwr));
+      CPPUNIT_ASSERT_EQUAL(bw.size(), (size_t)((char *)mwr.get() - region.get()));
+      
+      MemReader mrd (region.get());
+      RankBitmapReader br;
+      CPPUNIT_ASSERT_NO_THROW(br.load (mrd));
+      CPPUNIT_ASSERT_EQUAL((unsigned)VSIZE(ids), br.count());
+      
+      for (i = 0; i < VSIZE(ids); i++) {
+        CPPUNIT_ASSERT(br.rank(ids[i], slot));
+        CPPUNIT_ASSERT_EQUAL(i, slot);
+      }
+      
+      unsigned absent[] = {1, 62, 65, 257, 1022, 4999, 5001, 100000};
+      for (i = 0; i < VSIZE(absent); i++) {
+        CPPUNIT_ASSERT(!br.test(absent[i]));
+        CPPUNIT_ASSERT(!br.rank(absent[i], slot));
+      }
+      
+      // bitmap at unaligned offset of region
+      auto_ptr_arr<char> region1 (new char[bw.size() + 1]);
+      MemWriter mwr1 (region1.get() + 1);
+      bw.save(mwr1);
+      MemReader mrd1 (region1.get() + 1);
+      RankBitmapReader br1;
+      br1.load(mrd1);
+      for (i = 0; i < VSIZE(ids); i++) {
+        CPPUNIT_ASSERT(br1.rank(ids[i], slot));
+        CPPUNIT_ASSERT_EQUAL(i, slot);
+      }
+      CPPUNIT_ASSERT(!br1.test(65));
+      
+      // empty bitmap
+      RankBitmapWriter bw0;
+      auto_ptr_arr<char> region0 (new char[bw0.size() ]);
+      MemWriter mwr0 (region0.get());
+      bw0.save(mwr0);
+      MemReader mrd0 (region0.get());
+      RankBitmapReader br0;
+      br0.load(mrd0);
+      CPPUNIT_ASSERT(!br0.test(0));
+      CPPUNIT_ASSERT_EQUAL(0U, br0.count());
+    }
+    
     /// @brief testing hash array wich used for word indexing/searching
     void HashArrayTest() 
     {
@@ -109,6 +184,12 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT_EQUAL_MESSAGE("Array badly retrieved", 9U, varr[1]);
       CPPUNIT_ASSERT_EQUAL_MESSAGE("Array badly retrieved", 27U, varr[2]);
       CPPUNIT_ASSERT_EQUAL_MESSAGE("Array retrieve failed (should not been found)", 0U, srch.search (111, varr));
+      
+      const hash_entry<uint32_t, uint32_t> *pe = NULL;
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("Range retrieve failed", 4U, srch.searchRange (2, pe));
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("Range badly retrieved", 2U, pe[0].value);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("Range badly retrieved", 16U, pe[3].value);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("Range retrieve failed (should not been found)", 0U, srch.searchRange (111, pe));
 
       CPPUNIT_ASSERT(!srch.search (0, val));
       CPPUNIT_ASSERT(!srch.search (321, val));
@@ -160,6 +241,66 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT_THROW_MESSAGE ("out of bounds", reader.getPhrase(phrases.size()), std::out_of_range);
     }
     
+    /// @brief front-coded phrases (several blocks) and shared user data strings
+    void QCCompactStringsTest()
+    {
+      QCBasicPhraseStorage st;
+      vector<string> phrases;
+      size_t plainsz = 0;
+      unsigned i;
+
+      for (i = 0; i < QCBasicPhraseStorage::BLOCK_SIZE * 2 + 3; i++) {
+        char buf[64];
+        snprintf(buf, sizeof(buf), "московский метрополитен %s %u", (i & 1) ? "схема" : "станция", i);
+        phrases.push_back(buf);
+        plainsz += phrases.back().length() + 1 + sizeof(uint32_t);
+      }
+      phrases.push_back("");
+      phrases.push_back(string(300, 'a'));
+      phrases.push_back(string(300, 'a') + "b"); // shared prefix longer than 255
+      for (i = QCBasicPhraseStorage::BLOCK_SIZE * 2 + 3; i < phrases.size(); i++)
+        plainsz += phrases[i].length() + 1 + sizeof(uint32_t);
+
+      for (i = 0; i < phrases.size(); i++)
+        st.addPhrase(phrases[i]);
+      CPPUNIT_ASSERT(st.size() < plainsz);
+
+      auto_ptr_arr<char> region (new char[st.size() ]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(st.save (mwr));
+      CPPUNIT_ASSERT_EQUAL(st.size(), (size_t)((char *)mwr.get() - region.get()));
+
+      MemReader mrd (region.get());
+      QCBasicPhraseReader reader;
+      CPPUNIT_ASSERT_NO_THROW(reader.load(mrd));
+
+      for (i = phrases.size(); i; i--)
+        CPPUNIT_ASSERT_EQUAL(phrases[i - 1], (string)reader.getPhrase(i - 1));
+      // phrase pointers stay the same
+      CPPUNIT_ASSERT(reader.getPhrase(17) == reader.getPhrase(17));
+      CPPUNIT_ASSERT_THROW(reader.getPhrase(phrases.size()), std::out_of_range);
+
+      // equal user data strings are saved once
+      string tmpl = "<a href=\"http://go.mail.ru/search?q=%s\">%s</a>";
+      QCScatteredStringsWriter ssw;
+      ssw.add(1, tmpl);
+      size_t sz1 = ssw.size();
+      ssw.add(7, tmpl);
+      ssw.add(9, "other");
+      CPPUNIT_ASSERT(ssw.size() < sz1 * 2);
+
+      auto_ptr_arr<char> region2 (new char[ssw.size() ]);
+      MemWriter mwr2 (region2.get());
+      CPPUNIT_ASSERT_NO_THROW(ssw.save (mwr2));
+
+      MemReader mrd2 (region2.get());
+      QCScatteredStringsReader ssr;
+      CPPUNIT_ASSERT_NO_THROW(ssr.load(mrd2));
+      CPPUNIT_ASSERT_EQUAL(tmpl, (string)ssr.get(1));
+      CPPUNIT_ASSERT(ssr.get(1) == ssr.get(7));
+      CPPUNIT_ASSERT_EQUAL((string)"other", (string)ssr.get(9));
+    }
+
     /// @brief test scattered string storage
     /// @brief this is (storable) map in fact, so test it like map
     void QCScatteredStringsTest()
@@ -211,6 +352,111 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT (!splitter.vWords[4].upcase);
     }
     
+    /// @brief lemmas taken from cache are the same as lemmatizer's ones
+    void LemmaCacheTest() {
+      LemmaCache cache(1024);
+      PhraseSplitterPlain splitter, splitter_cached;
+      LemmaCache::stat st;
+      const char *query = "Парков окну 2009 Я парков";
+      const unsigned bypass = LemmaCache::BYPASS_DIGITS | LemmaCache::BYPASS_SHORT;
+      unsigned i, j;
+      
+      splitter.setLemmatizer(&lem);
+      splitter.setLemmaBypass(bypass);
+      splitter_cached.setLemmatizer(&lem);
+      splitter_cached.setLemmaBypass(bypass);
+      splitter_cached.setLemmaCache(&cache);
+      
+      CPPUNIT_ASSERT(LemmaCache::isBypassed("2009", bypass));
+      CPPUNIT_ASSERT(LemmaCache::isBypassed("Я", bypass));
+      CPPUNIT_ASSERT(!LemmaCache::isBypassed("ПАРКОВ", bypass));
+      CPPUNIT_ASSERT(!LemmaCache::isBypassed("SIMPLE", bypass));
+      CPPUNIT_ASSERT(!LemmaCache::isBypassed("2009", 0));
+      CPPUNIT_ASSERT(LemmaCache::isBypassed("SIMPLE", LemmaCache::BYPASS_LATIN));
+      
+      for (i = 0; i < 2; i++) {
+        CPPUNIT_ASSERT_EQUAL(5U, splitter.split(query));
+        CPPUNIT_ASSERT_EQUAL(5U, splitter_cached.split(query));
+        for (j = 0; j < 5; j++) {
+          CPPUNIT_ASSERT_EQUAL(splitter.vWords[j].hash, splitter_cached.vWords[j].hash);
+          CPPUNIT_ASSERT_EQUAL(splitter.vWords[j].form, splitter_cached.vWords[j].form);
+        }
+      }
+      CPPUNIT_ASSERT(splitter.vWords[0].hash != splitter.vWords[0].form);
+      
+      // "парков" twice a query, "окну" is missed on first query only
+      splitter_cached.getLemmaStat(&st);
+      CPPUNIT_ASSERT_EQUAL((uint64_t)4, st.bypassed);
+      CPPUNIT_ASSERT_EQUAL((uint64_t)2, st.misses);
+      CPPUNIT_ASSERT_EQUAL((uint64_t)4, st.hits);
+      CPPUNIT_ASSERT_EQUAL((uint64_t)0, st.evictions);
+      
+      splitter_cached.getLemmaStat(&st);
+      CPPUNIT_ASSERT_EQUAL((uint64_t)0, st.hits + st.misses + st.evictions + st.bypassed);
+      
+      cache.clear();
+      uint32_t lemma;
+      CPPUNIT_ASSERT(!cache.lookup(splitter.vWords[0].form, lemma));
+      CPPUNIT_ASSERT(!cache.insert(splitter.vWords[0].form, splitter.vWords[0].hash));
+      CPPUNIT_ASSERT(cache.lookup(splitter.vWords[0].form, lemma));
+      CPPUNIT_ASSERT_EQUAL(splitter.vWords[0].hash, lemma);
+      
+      // the only slot is taken by other word
+      LemmaCache tiny(1);
+      CPPUNIT_ASSERT(!tiny.insert(splitter.vWords[0].form, splitter.vWords[0].hash));
+      CPPUNIT_ASSERT(tiny.insert(splitter.vWords[1].form, splitter.vWords[1].hash));
+      CPPUNIT_ASSERT(!tiny.lookup(splitter.vWords[0].form, lemma));
+    }
+    
+    /// @brief bypass rules of index are applied to query words by searcher
+    void LemmaBypassTest() {
+      const unsigned bypass[] = { 0, LemmaCache::BYPASS_DIGITS | LemmaCache::BYPASS_SHORT };
+      
+      for (unsigned k = 0; k < 2; k++) 
+      {
+        PhraseIndexer idx(&lem);
+        idx.setLemmaBypass(bypass[k]);
+        idx.addPhrase(0, "дом 5", 100);
+        idx.addPhrase(0, "витамин С", 100);
+        idx.addPhrase(0, "парков", 100);
+        
+        auto_ptr_arr<char> region (new char[idx.size()]);
+        MemWriter mwr (region.get());
+        CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+        
+        MemReader mrd (region.get());
+        LemmaCache cache(64);
+        PhraseSearcher srch(&lem);
+        CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+        srch.setLemmaCache(&cache);
+        
+        vector<PhraseSearcher::phrase_matched> vmatch;
+        CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("дом 5", vmatch));
+        CPPUNIT_ASSERT_EQUAL(0, vmatch[0].match_flags);
+        CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("витамин С", vmatch));
+        CPPUNIT_ASSERT_EQUAL(0, vmatch[0].match_flags);
+        CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("парк", vmatch));
+        
+        LemmaCache::stat st;
+        srch.getLemmaStat(&st);
+        CPPUNIT_ASSERT_EQUAL((uint64_t)(k ? 2 : 0), st.bypassed); // "5", "С"
+        
+        // rules are kept by export
+        PhraseIndexer idx2;
+        CPPUNIT_ASSERT_EQUAL(3U, srch.exportPhrases(idx2));
+        auto_ptr_arr<char> region2 (new char[idx2.size()]);
+        MemWriter mwr2 (region2.get());
+        CPPUNIT_ASSERT_NO_THROW(idx2.save(mwr2));
+        
+        MemReader mrd2 (region2.get());
+        PhraseSearcher srch2(&lem);
+        CPPUNIT_ASSERT_NO_THROW(srch2.load(mrd2));
+        CPPUNIT_ASSERT_EQUAL(1U, srch2.searchPhrase("дом 5", vmatch));
+        srch2.getLemmaStat(&st);
+        CPPUNIT_ASSERT_EQUAL((uint64_t)k, st.bypassed);
+      }
+    }
+    
     /// @brief testing what phrases with regular expressions are split correctly
     void PhraseSplitterPCRETest()
     {
@@ -365,6 +611,221 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT_EQUAL(8U, st.nwords);
       CPPUNIT_ASSERT_EQUAL(5U, st.nwords_uniq);
     }
+
+    /// @brief phrases with equal class lists share them, single class is inlined
+    void QPhraseSharedClassListsTest() {
+      PhraseIndexer idx(&lem);
+      PhraseIndexer::stat st;
+
+      idx.addPhrase(0, "Женевские отели", 50);
+      idx.addPhrase(1, "Женевские отели", 75);
+      idx.addPhrase(0, "Владимир Путин", 50);
+      idx.addPhrase(1, "Владимир Путин", 75);
+      idx.addPhrase(0, "отель", 50);
+      idx.addPhrase(1, "отель", 75);
+      idx.addPhrase(1, "автобусная остановка", 75); // other order of the same classes
+      idx.addPhrase(0, "автобусная остановка", 50);
+      idx.addPhrase(3, "Путин", 90);
+
+      auto_ptr_arr<char> region (new char[idx.size() ]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW (idx.save (mwr));
+
+      idx.getStat(&st);
+      CPPUNIT_ASSERT_EQUAL(2U, st.nclasslists);
+
+      MemReader mrd (region.get());
+      PhraseSearcher srch(&lem);
+      CPPUNIT_ASSERT_NO_THROW(srch.load (mrd));
+
+      const char *queries[] = {"Женевские отели", "Владимир Путин", "отель", "автобусная остановка"};
+      for (unsigned i = 0; i < VSIZE(queries); i++)
+      {
+        vector<PhraseSearcher::phrase_matched> vmatch;
+        std::multimap<unsigned, PhraseSearcher::phrasecls_matched> phraseByCls;
+
+        CPPUNIT_ASSERT(srch.searchPhrase(queries[i], vmatch) >= 1U);
+        srch.getClasses(vmatch, phraseByCls);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(queries[i], 50U, phraseByCls.find(0)->second.baserank);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(queries[i], 75U, phraseByCls.find(1)->second.baserank);
+      }
+
+      vector<PhraseSearcher::phrase_matched> vmatch;
+      std::multimap<unsigned, PhraseSearcher::phrasecls_matched> phraseByCls;
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("Путин", vmatch));
+      srch.getClasses(vmatch, phraseByCls);
+      CPPUNIT_ASSERT_EQUAL(1U, (unsigned)phraseByCls.size());
+      CPPUNIT_ASSERT_EQUAL(90U, phraseByCls.find(3)->second.baserank);
+
+      // lists of multiclass phrases (4 x [N][2 x phrase_cls_info]) are saved twice only
+      PhraseIndexer idx2(&lem);
+      idx2.addPhrase(0, "Женевские отели", 50);
+      idx2.addPhrase(0, "Владимир Путин", 50);
+      idx2.addPhrase(0, "отель", 50);
+      idx2.addPhrase(0, "автобусная остановка", 50);
+      idx2.addPhrase(3, "Путин", 90);
+      CPPUNIT_ASSERT_EQUAL(idx2.size() + 2 * (sizeof(uint16_t) + 2 * 4), idx.size());
+    }
+
+    /// @brief phrases differing by punctuation only are merged in word deduplication mode
+    void QPhraseDedupByWordsTest() {
+      PhraseIndexer idx(&lem);
+      PhraseIndexer::stat st;
+
+      idx.setDedupByWords(true);
+      idx.saveOrigPhrases(true);
+      idx.addPhrase(0, "Москва, Кремль", 50, "first");
+      idx.addPhrase(0, "Москва  Кремль!", 80, "second");
+      idx.addPhrase(1, "Москва - Кремль", 60);
+      idx.addPhrase(1, "москва кремль", 70); // capitalization differs
+      idx.addPhrase(1, "/Москва Кремль/", 90); // regular expressions aren't merged
+
+      idx.getStat(&st);
+      CPPUNIT_ASSERT_EQUAL(5U, st.nphrases);
+      CPPUNIT_ASSERT_EQUAL(3U, st.nphrases_uniq);
+      CPPUNIT_ASSERT_EQUAL(2U, st.nmerged);
+
+      auto_ptr_arr<char> region (new char[idx.size() ]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW (idx.save (mwr));
+
+      MemReader mrd (region.get());
+      PhraseSearcher srch(&lem);
+      CPPUNIT_ASSERT_NO_THROW(srch.load (mrd));
+
+      vector<PhraseSearcher::phrase_matched> vmatch;
+      std::multimap<unsigned, PhraseSearcher::phrasecls_matched> phraseByCls;
+      CPPUNIT_ASSERT_EQUAL(3U, srch.searchPhrase("Москва Кремль", vmatch));
+
+      // origin and user data of the first phrase are kept
+      unsigned i;
+      for (i = 0; i < vmatch.size() && strcmp(srch.getOriginPhrase(vmatch[i].phrase_id), "Москва, Кремль"); i++)
+        ;
+      CPPUNIT_ASSERT(i < vmatch.size());
+      CPPUNIT_ASSERT_EQUAL((string)"first", (string)srch.getUserData(vmatch[i].phrase_id));
+
+      vmatch.erase(vmatch.begin(), vmatch.begin() + i);
+      vmatch.resize(1);
+      srch.getClasses(vmatch, phraseByCls);
+      CPPUNIT_ASSERT_EQUAL(2U, (unsigned)phraseByCls.size());
+      CPPUNIT_ASSERT_EQUAL(80U, phraseByCls.find(0)->second.baserank); // the best rank of class
+      CPPUNIT_ASSERT_EQUAL(60U, phraseByCls.find(1)->second.baserank);
+    }
+
+    /// @brief narrow (default) and wide index formats give the same search results
+    void QPhraseWideFormatTest() {
+      static const char *phrases[] = {
+        "Путин", "Владимир Путин", "Женевские конвенции", "Женевские отели",
+        "автобусная остановка у Женевского озера", "отель"
+      };
+      const unsigned nphrases = sizeof(phrases) / sizeof(phrases[0]);
+      PhraseIndexer idx(&lem), idxw(&lem);
+      PhraseIndexer::stat st;
+      unsigned i, j;
+
+      idxw.setWideFormat(true);
+      idx.saveOrigPhrases(true);
+      idxw.saveOrigPhrases(true);
+      for (i = 0; i < nphrases; i++) {
+        idx.addPhrase(i % 3, phrases[i], 50 + i, (i & 1) ? "udata" : NULL);
+        idxw.addPhrase(i % 3, phrases[i], 50 + i, (i & 1) ? "udata" : NULL);
+        idx.addPhrase(3, phrases[i], 10);
+        idxw.addPhrase(3, phrases[i], 10);
+      }
+
+      // narrow format is chosen for small collection
+      CPPUNIT_ASSERT(idxw.size() > idx.size());
+      idx.getStat(&st);
+      CPPUNIT_ASSERT(!st.wide);
+      idxw.getStat(&st);
+      CPPUNIT_ASSERT(st.wide);
+
+      auto_ptr_arr<char> region (new char[idx.size() ]), regionw (new char[idxw.size() ]);
+      MemWriter mwr (region.get()), mwrw (regionw.get());
+      CPPUNIT_ASSERT_NO_THROW (idx.save (mwr));
+      CPPUNIT_ASSERT_NO_THROW (idxw.save (mwrw));
+      CPPUNIT_ASSERT_EQUAL(idxw.size(), (size_t)((char *)mwrw.get() - regionw.get()));
+
+      MemReader mrd (region.get()), mrdw (regionw.get());
+      PhraseSearcher srch(&lem), srchw(&lem);
+      CPPUNIT_ASSERT_NO_THROW(srch.load (mrd));
+      CPPUNIT_ASSERT_NO_THROW(srchw.load (mrdw));
+
+      static const char *queries[] = {
+        "Владимир Путин", "путин", "отели Женевские", "остановка автобусная у Женевского озера отель"
+      };
+      for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) 
+      {
+        vector<PhraseSearcher::phrase_matched> vmatch, vmatchw;
+        std::multimap<unsigned, PhraseSearcher::phrasecls_matched> byCls, byClsw;
+        
+        CPPUNIT_ASSERT(srch.searchPhrase(queries[i], vmatch) > 0);
+        CPPUNIT_ASSERT_EQUAL((unsigned)vmatch.size(), srchw.searchPhrase(queries[i], vmatchw));
+        for (j = 0; j < vmatch.size(); j++) {
+          CPPUNIT_ASSERT_EQUAL(vmatch[j].phrase_id, vmatchw[j].phrase_id);
+          CPPUNIT_ASSERT_EQUAL(vmatch[j].match_flags, vmatchw[j].match_flags);
+          CPPUNIT_ASSERT_EQUAL((string)srch.getOriginPhrase(vmatch[j].phrase_id), 
+                               (string)srchw.getOriginPhrase(vmatch[j].phrase_id));
+          CPPUNIT_ASSERT_EQUAL(srch.getUserData(vmatch[j].phrase_id) != NULL, 
+                               srchw.getUserData(vmatch[j].phrase_id) != NULL);
+        }
+        
+        srch.getClasses(vmatch, byCls);
+        srchw.getClasses(vmatchw, byClsw);
+        CPPUNIT_ASSERT_EQUAL(byCls.size(), byClsw.size());
+        std::multimap<unsigned, PhraseSearcher::phrasecls_matched>::const_iterator it, itw;
+        for (it = byCls.begin(), itw = byClsw.begin(); it != byCls.end(); it++, itw++) {
+          CPPUNIT_ASSERT_EQUAL(it->first, itw->first);
+          CPPUNIT_ASSERT_EQUAL(it->second.phrase_id, itw->second.phrase_id);
+          CPPUNIT_ASSERT_EQUAL(it->second.baserank, itw->second.baserank);
+        }
+      }
+      
+      // phrases of wide index are exported to narrow one
+      PhraseIndexer idx2(&lem);
+      CPPUNIT_ASSERT_EQUAL(nphrases, srchw.exportPhrases(idx2));
+      CPPUNIT_ASSERT_EQUAL(idx.size(), idx2.size());
+    }
+
+    /// @brief words of forms table are resolved without lemmatizer
+    void QPhraseFormsTableTest() {
+      PhraseIndexer idx(&lem);
+      PhraseIndexer::stat st;
+      vector<PhraseSearcher::phrase_matched> vmatch;
+      
+      idx.setFormsTable(true);
+      idx.addPhrase(0, "парк", 100);
+      idx.addPhrase(0, "окно", 100);
+      idx.addPhrase(1, "Женевские отели", 100);
+      idx.addWordForm("окну");
+      idx.addWordForm("ноутбуки"); // lemma isn't indexed
+      
+      auto_ptr_arr<char> region (new char[idx.size() ]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW (idx.save (mwr));
+      CPPUNIT_ASSERT_EQUAL(idx.size(), (size_t)((char *)mwr.get() - region.get()));
+      idx.getStat(&st);
+      CPPUNIT_ASSERT_EQUAL(3U, st.nforms); // ЖЕНЕВСКИЕ, ОТЕЛИ, ОКНУ
+      
+      MemReader mrd (region.get()), mrdl (region.get());
+      PhraseSearcher srch(NULL), srchl(&lem);
+      CPPUNIT_ASSERT_NO_THROW(srch.load (mrd));
+      CPPUNIT_ASSERT_NO_THROW(srchl.load (mrdl));
+      CPPUNIT_ASSERT(srch.hasFormsTable());
+      
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("окну", vmatch));
+      CPPUNIT_ASSERT_EQUAL(PhraseSearcher::MATCH_FL_DIFF_FORM, vmatch[0].match_flags);
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("окно", vmatch));
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("женевские отели", vmatch));
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchPhrase("парков", vmatch)); // form isn't in table
+      
+      // lemmatizer is called for words missing from table unless strict mode is set
+      CPPUNIT_ASSERT_EQUAL(2U, srchl.searchPhrase("окну парков", vmatch));
+      CPPUNIT_ASSERT_EQUAL(1U, srchl.searchPhrase("парков", vmatch));
+      srchl.setStrictForms(true);
+      CPPUNIT_ASSERT_EQUAL(0U, srchl.searchPhrase("парков", vmatch));
+      CPPUNIT_ASSERT_EQUAL(1U, srchl.searchPhrase("окну", vmatch));
+    }
     
     /// @brief test what phrase indexer working fine (simple index/search)
     void QPhraseIndexerTest() {
@@ -405,6 +866,904 @@ class QClassifyTest : public CppUnit::TestFixture
       CPPUNIT_ASSERT_MESSAGE("Partial", 0U == srch.searchPhrase("Женевские", vres));
     }
     
+    /// @brief phrases of hot keyword addressed by word pair should be matched as usual
+    void QPhraseIndexerHotKeywordTest() 
+    {
+      // threshold 0 disables pair index: results must be the same
+      for (unsigned threshold = 0; threshold < 2; threshold++)
+      {
+        PhraseIndexer idx;
+        PhraseIndexer::stat st;
+        
+        idx.setHotKeywordThreshold(threshold);
+        idx.addPhrase(0, "Ленина", 100);
+        idx.addPhrase(0, "Гагарина", 100);
+        idx.addPhrase(0, "улица Ленина", 100);
+        idx.addPhrase(0, "улица Гагарина", 100);
+        idx.addPhrase(0, "улица", 100);
+        
+        auto_ptr_arr<char> region (new char[idx.size() ]);
+        MemWriter mwr (region.get());
+        CPPUNIT_ASSERT_NO_THROW (idx.save (mwr));
+        
+        idx.getStat(&st);
+        CPPUNIT_ASSERT_EQUAL(threshold, st.nhotwords);
+        CPPUNIT_ASSERT_EQUAL(threshold * 2, st.nhotphrases);
+        
+        MemReader mrd (region.get());
+        PhraseSearcher srch;
+        CPPUNIT_ASSERT_NO_THROW(srch.load (mrd));
+        
+        std::vector<PhraseSearcher::phrase_matched> vres;
+        CPPUNIT_ASSERT_EQUAL(3U, srch.searchPhrase("Гагарина улица", vres));
+        
+        unsigned i, nreordered = 0;
+        for (i = 0; i < vres.size(); i++) {
+          if (vres[i].match_flags == PhraseSearcher::MATCH_FL_REORDERED)
+            nreordered++;
+          else
+            CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[i].match_flags);
+        }
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("reordered phrase not found", 1U, nreordered);
+        
+        CPPUNIT_ASSERT_EQUAL(3U, srch.searchPhrase("улица Ленина дом", vres));
+        for (i = 0; i < vres.size(); i++)
+          CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[i].match_flags);
+        
+        CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("улица дом", vres));
+        CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[0].match_flags);
+      }
+    }
+    
+    /// @brief phrases of 1-3 words (specialized matching, single-word phrases in dictionary)
+    void QPhraseShortPhrasesTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      idx.saveOrigPhrases(true);
+      idx.addPhrase(0, "Москва", 100);
+      idx.addPhrase(1, "Москва", 50);
+      idx.addPhrase(0, "Москва река", 80);
+      idx.addPhrase(1, "река Москва берег", 70);
+      idx.addPhrase(1, "река Москва берег пляж", 60);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      std::vector<PhraseSearcher::phrase_matched> vres;
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("Москва", vres));
+      CPPUNIT_ASSERT_EQUAL(0, vres[0].match_flags);
+      CPPUNIT_ASSERT_EQUAL(string("Москва"), string(srch.getOriginPhrase(vres[0].phrase_id)));
+      
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("москва", vres));
+      CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_DIFF_CAPS, vres[0].match_flags);
+      
+      // every phrase word takes the first unused query word
+      const int fl_reordered_partial = PhraseSearcher::MATCH_FL_REORDERED | PhraseSearcher::MATCH_FL_PARTIAL;
+      CPPUNIT_ASSERT_EQUAL(4U, srch.searchPhrase("берег Москва река пляж", vres));
+      for (unsigned i = 0; i < vres.size(); i++) {
+        string orig = srch.getOriginPhrase(vres[i].phrase_id);
+        if (orig == "Москва")
+          CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[i].match_flags);
+        else if (orig == "Москва река")
+          CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[i].match_flags);
+        else if (orig == "река Москва берег")
+          CPPUNIT_ASSERT_EQUAL(fl_reordered_partial, vres[i].match_flags);
+        else
+          CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_REORDERED, vres[i].match_flags);
+      }
+      
+      // classes of single-word phrase
+      PhraseSearcher::res_cls_num_t res;
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchPhrase("Москва", res));
+      CPPUNIT_ASSERT_EQUAL(100U, res[0].rank);
+      CPPUNIT_ASSERT_EQUAL(50U, res[1].rank);
+      
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchPhrase("река", vres));
+      
+      // more single-word phrases of a word than byte counts (distinct texts of the same word)
+      static const unsigned nsingles[] = { 256, 300 };
+      for (unsigned k = 0; k < sizeof(nsingles) / sizeof(nsingles[0]); k++) 
+      {
+        PhraseIndexer idxs;
+        for (unsigned i = 0; i < nsingles[k]; i++)
+          idxs.addPhrase(0, string(i, ' ') + "Москва", 100);
+        
+        auto_ptr_arr<char> regions (new char[idxs.size()]);
+        MemWriter mwrs (regions.get());
+        CPPUNIT_ASSERT_NO_THROW(idxs.save(mwrs));
+        
+        MemReader mrds (regions.get());
+        PhraseSearcher srchs;
+        CPPUNIT_ASSERT_NO_THROW(srchs.load(mrds));
+        CPPUNIT_ASSERT_EQUAL(nsingles[k], srchs.searchPhrase("Москва", vres));
+      }
+    }
+    
+    /// @brief candidates which can't be ranked are skipped by ranked searches only
+    void QPhrasePruningTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens;
+      
+      pens.partial_penalty = QCPenalties::penaltiToMultiplier(1.0); // partial match is useless
+      qcw.addQClass("strict", pens);
+      idx.addPhrase(0, "ноутбук", 100);
+      idx.addPhrase(0, "ноутбук lenovo", 100);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      PhraseSearcher::search_stat st;
+      PhraseSearcher::res_cls_num_t res;
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("ноутбук lenovo", res));
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchPhrase("ноутбук asus", res));
+      srch.getSearchStat(&st);
+      CPPUNIT_ASSERT_EQUAL(3U, st.nvisited); // phrase is posted by one of its words
+      CPPUNIT_ASSERT_EQUAL(2U, st.npruned);
+      
+      // unranked search returns all matches
+      std::vector<PhraseSearcher::phrase_matched> vres;
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("ноутбук asus", vres));
+      CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_PARTIAL, vres[0].match_flags);
+      
+      unsigned clsid;
+      PhraseSearcher::phrase_info info;
+      CPPUNIT_ASSERT(!srch.searchBest("ноутбук asus", clsid, info));
+    }
+    
+    /// @brief best class search should agree with searchPhrase + selectBest
+    void QPhraseSearchBestTest()
+    {
+      PhraseCollectionIndexer idx(&lem);
+      XmlConfig cfg("cfg/config_2qc.xml");
+      
+      CPPUNIT_ASSERT_NO_THROW(idx.indexByConfig(&cfg));
+      CPPUNIT_ASSERT_NO_THROW(idx.save());
+      
+      PhraseCollectionLoader ldr(&lem);
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("Phrase index loading failed", true, ldr.loadByConfig(&cfg));
+      
+      const char *queries[] = {
+        "ноутбук lenovo", // exact
+        "учебник",        // exact, but in both classes
+        "ноутбук",        // exact, other phrases are penalized
+        "lenovo ноутбук", // reordered
+        "телефон мобильный"
+      };
+      
+      for (unsigned i = 0; i < VSIZE(queries); i++) 
+      {
+        PhraseSearcher::res_cls_num_t res;
+        unsigned clsid;
+        PhraseSearcher::phrase_info info;
+        
+        CPPUNIT_ASSERT(ldr->searchPhrase(queries[i], res));
+        CPPUNIT_ASSERT_MESSAGE(queries[i], ldr->searchBest(queries[i], clsid, info));
+        
+        PhraseSearcher::res_cls_num_t::iterator it = PhraseSearcher::selectBest(res);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(queries[i], it->first, clsid);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(queries[i], it->second.rank, info.rank);
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(queries[i], it->second.phrase_id, info.phrase_id);
+      }
+      
+      unsigned clsid;
+      PhraseSearcher::phrase_info info;
+      CPPUNIT_ASSERT(ldr->searchBest("ноутбук lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(string("ноутбук lenovo"), string(ldr->getOriginPhrase(info.phrase_id)));
+      CPPUNIT_ASSERT_EQUAL(100U, info.rank);
+      
+      CPPUNIT_ASSERT(!ldr->searchBest("школьный портфель", clsid, info));
+      CPPUNIT_ASSERT(!ldr->searchBest("частотный анализатор", clsid, info));
+    }
+    
+    /// @brief rank ties of searchBest are resolved in favour of exact match
+    void QPhraseSearchBestTieTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      idx.addPhrase(0, "ноутбук", 100);
+      idx.addPhrase(1, "ноутбук lenovo", 100);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      unsigned clsid;
+      PhraseSearcher::phrase_info info;
+      // rank tie of exact and partial match is resolved by lower class ID (as selectBest does)
+      CPPUNIT_ASSERT(srch.searchBest("ноутбук lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(0U, clsid);
+      CPPUNIT_ASSERT_EQUAL(100U, info.rank);
+      
+      PhraseSearcher::res_cls_num_t cres;
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchPhrase("ноутбук lenovo", cres));
+      CPPUNIT_ASSERT_EQUAL(clsid, PhraseSearcher::selectBest(cres)->first);
+      
+      // partial match only
+      CPPUNIT_ASSERT(srch.searchBest("ноутбук asus", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(0U, clsid);
+    }
+    
+    /// @brief k best classes are ordered by rank
+    void QPhraseSearchTopKTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      pens.partial_penalty = QCPenalties::penaltiToMultiplier(0.5);
+      qcw.addQClass("third", pens);
+      idx.addPhrase(0, "ноутбук lenovo", 100);
+      idx.addPhrase(1, "ноутбук", 80);
+      idx.addPhrase(1, "lenovo", 30);
+      idx.addPhrase(2, "lenovo", 90);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      std::vector<PhraseSearcher::cls_matched> top;
+      CPPUNIT_ASSERT_EQUAL(3U, srch.searchTopK("ноутбук lenovo", 5, top));
+      CPPUNIT_ASSERT_EQUAL(0U, top[0].clsid);
+      CPPUNIT_ASSERT_EQUAL(100U, top[0].info.rank);
+      CPPUNIT_ASSERT_EQUAL(1U, top[1].clsid);
+      CPPUNIT_ASSERT_EQUAL(80U, top[1].info.rank);
+      CPPUNIT_ASSERT_EQUAL(2U, top[2].clsid);
+      CPPUNIT_ASSERT_EQUAL(45U, top[2].info.rank);
+      
+      PhraseSearcher::search_stat st;
+      srch.getSearchStat(&st);
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchTopK("ноутбук lenovo", 2, top));
+      CPPUNIT_ASSERT_EQUAL(1U, top[1].clsid);
+      srch.getSearchStat(&st);
+      CPPUNIT_ASSERT_MESSAGE("nothing skipped by rank bound", st.nbounded > 0);
+      
+      unsigned clsid;
+      PhraseSearcher::phrase_info info;
+      CPPUNIT_ASSERT(srch.searchBest("lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchTopK("lenovo", 1, top));
+      CPPUNIT_ASSERT_EQUAL(2U, clsid);
+      CPPUNIT_ASSERT_EQUAL(clsid, top[0].clsid);
+      CPPUNIT_ASSERT_EQUAL(info.phrase_id, top[0].info.phrase_id);
+      
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchTopK("ноутбук lenovo", 0, top));
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchTopK("частотный анализатор", 3, top));
+    }
+    
+    /// @brief repeated search into caller-owned containers doesn't allocate
+    void QPhraseSearchNoAllocTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      idx.addPhrase(0, "ноутбук lenovo", 100);
+      idx.addPhrase(1, "ноутбук", 80);
+      idx.addPhrase(1, "lenovo", 30);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      struct RankSum : public SearchVisitor {
+        unsigned sum;
+        RankSum() : sum(0) {}
+        virtual void visit(unsigned, unsigned, unsigned rank, int) { sum += rank; }
+      } visitor;
+      
+      QCResultArray res;
+      const string q1 = "ноутбук lenovo", q2 = "lenovo";
+      
+      // warm up buffers
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchPhrase(q1, res));
+      CPPUNIT_ASSERT_EQUAL(3U, srch.searchPhrase(q1, visitor));
+      
+      unsigned nallocs = g_nallocs;
+      CPPUNIT_ASSERT_MESSAGE("allocation counter is not active", nallocs > 0);
+      for (unsigned i = 0; i < 10; i++) {
+        CPPUNIT_ASSERT_EQUAL(2U, srch.searchPhrase(q1, res));
+        CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase(q2, res));
+        CPPUNIT_ASSERT_EQUAL(3U, srch.searchPhrase(q1, visitor));
+      }
+      CPPUNIT_ASSERT_EQUAL_MESSAGE("search allocates memory", nallocs, g_nallocs);
+      CPPUNIT_ASSERT_EQUAL(11U * (100 + 80 + 30), visitor.sum);
+      
+      // the last search is "lenovo"
+      CPPUNIT_ASSERT(!res.has(0));
+      CPPUNIT_ASSERT(res.has(1));
+      CPPUNIT_ASSERT_EQUAL(30U, res[1].rank);
+      CPPUNIT_ASSERT_EQUAL(1U, res.best());
+      CPPUNIT_ASSERT_EQUAL(string("second"), string(srch.getClassNamePtr(1)));
+    }
+    
+    /// @brief search by pre-tokenized query is the same as by text
+    void QPhraseSearchTokensTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx(&lem);
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      idx.addPhrase(0, "Женевские отели", 100);
+      idx.addPhrase(1, "отель", 80);
+      idx.addPhrase(1, "ноутбук lenovo", 30);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch(&lem);
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      static const char *queries[] = {
+        "женевские отели", "Отели женевские", "ноутбуки Lenovo", "отель", "lenovo ноутбук отель", "кот"
+      };
+      vector<PhraseSearcher::query_token> tokens;
+      vector<PhraseSearcher::phrase_matched> vmatch, vmatch_tok;
+      QCResultArray res, res_tok;
+      unsigned i, j;
+      
+      for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) 
+      {
+        unsigned n = srch.tokenize(queries[i], tokens);
+        CPPUNIT_ASSERT_EQUAL(srch.searchPhrase(queries[i], vmatch), srch.searchTokens(&tokens[0], n, vmatch_tok));
+        for (j = 0; j < vmatch.size(); j++) {
+          CPPUNIT_ASSERT_EQUAL(vmatch[j].phrase_id, vmatch_tok[j].phrase_id);
+          CPPUNIT_ASSERT_EQUAL(vmatch[j].match_flags, vmatch_tok[j].match_flags);
+        }
+        
+        CPPUNIT_ASSERT_EQUAL(srch.searchPhrase(queries[i], res), srch.searchTokens(&tokens[0], n, res_tok));
+        for (j = 0; j < res.size(); j++) {
+          CPPUNIT_ASSERT_EQUAL(res.clsid(j), res_tok.clsid(j));
+          CPPUNIT_ASSERT_EQUAL(res[res.clsid(j)].rank, res_tok[res.clsid(j)].rank);
+        }
+      }
+      
+      // tokens lemmatized by caller: resolved once, searched many times
+      const char *words[][2] = { {"ОТЕЛЬ", "отели"}, {"женевский", "Женевские"} };
+      PhraseSearcher::query_token qt[2];
+      for (i = 0; i < 2; i++)
+        PhraseSearcher::makeToken(words[i][0], words[i][1], qt[i]);
+      CPPUNIT_ASSERT(qt[1].upcase);
+      srch.resolveTokens(qt, 2);
+      CPPUNIT_ASSERT(qt[0].resolved && qt[0].id != ~0U);
+      
+      srch.tokenize("Женевские отели", tokens);
+      CPPUNIT_ASSERT_EQUAL(tokens[0].id, qt[1].id);
+      CPPUNIT_ASSERT_EQUAL(tokens[0].form, qt[1].form);
+      for (i = 0; i < 3; i++) {
+        CPPUNIT_ASSERT_EQUAL(2U, srch.searchTokens(qt, 2, vmatch_tok));
+        CPPUNIT_ASSERT_EQUAL(2U, srch.searchTokens(qt, 2, res_tok));
+        CPPUNIT_ASSERT_EQUAL(100U, res_tok[0].rank);
+      }
+      
+      // unknown word
+      PhraseSearcher::makeToken("кот", "кот", qt[0]);
+      srch.resolveTokens(qt, 1);
+      CPPUNIT_ASSERT_EQUAL(~0U, qt[0].id);
+      CPPUNIT_ASSERT_EQUAL(0U, srch.searchTokens(qt, 1, vmatch_tok));
+      
+      // windows-1251 text: the same tokens, the same best match
+      vector<PhraseSearcher::query_token> tokens_cp;
+      for (i = 0; i < sizeof(queries) / sizeof(queries[0]); i++) 
+      {
+        string q(queries[i]), q_cp;
+        utf8_to_codepage(CODEPAGE_CP1251, q.data(), q.length(), q_cp);
+        unsigned n = srch.tokenize(q, tokens);
+        CPPUNIT_ASSERT_EQUAL(n, srch.tokenize(q_cp.data(), q_cp.length(), CODEPAGE_CP1251, tokens_cp));
+        for (j = 0; j < n; j++) {
+          CPPUNIT_ASSERT_EQUAL(tokens[j].hash, tokens_cp[j].hash);
+          CPPUNIT_ASSERT_EQUAL(tokens[j].form, tokens_cp[j].form);
+          CPPUNIT_ASSERT_EQUAL(tokens[j].upcase, tokens_cp[j].upcase);
+          CPPUNIT_ASSERT_EQUAL(tokens[j].id, tokens_cp[j].id);
+        }
+        
+        unsigned clsid = ~0U, clsid_cp = ~0U;
+        PhraseSearcher::phrase_info info = {0, 0}, info_cp = {0, 0};
+        bool found = srch.searchBest(q, clsid, info);
+        CPPUNIT_ASSERT_EQUAL(found, n && srch.searchBest(&tokens_cp[0], n, clsid_cp, info_cp));
+        CPPUNIT_ASSERT_EQUAL(clsid, clsid_cp);
+        CPPUNIT_ASSERT_EQUAL(info.phrase_id, info_cp.phrase_id);
+        CPPUNIT_ASSERT_EQUAL(info.rank, info_cp.rank);
+      }
+    }
+    
+    /// @brief occurrence as sortable vector: first, nwords, phrase ID, flags, class ID, rank
+    static vector<unsigned> occurrenceKey(const PhraseSearcher::exact_occurrence &oc) {
+      unsigned v[] = {oc.first, oc.nwords, oc.phrase_id, (unsigned)oc.match_flags, oc.clsid, oc.rank};
+      return vector<unsigned>(v, v + sizeof(v) / sizeof(v[0]));
+    }
+    
+    /// @brief exact trie finds the same exact matches as search of every word window
+    void QPhraseExactTrieTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx; // no lemmatizer: words are matched as written
+      QCPenalties pens, pens_caps;
+      
+      pens_caps.diff_caps_penalty = 0.5;
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens_caps);
+      idx.setExactTrie(true);
+      idx.saveOrigPhrases(true);
+      idx.addPhrase(0, "ноутбук lenovo", 100);
+      idx.addPhrase(0, "ноутбук-Lenovo", 20); // the same key, other capitalization
+      idx.addPhrase(1, "ноутбук", 80);
+      idx.addPhrase(1, "Lenovo", 30);
+      idx.addPhrase(0, "Красная площадь Москвы", 50);
+      idx.addPhrase(1, "красная площадь", 60);
+      idx.addPhrase(0, "площадь", 10);
+      idx.addPhrase(1, "площадь", 15);
+      idx.addPhrase(1, "Москва", 40);
+      idx.optimize();
+      
+      PhraseIndexer::stat st;
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      idx.getStat(&st);
+      CPPUNIT_ASSERT_EQUAL(7U, st.ntriekeys);
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      CPPUNIT_ASSERT(srch.hasExactTrie());
+      
+      const string text = "Купите ноутбук Lenovo на Красной площади: КРАСНАЯ площадь Москвы, "
+                          "ноутбук, lenovo ноутбук... Москва - площадь красная, ноутбук lenovo";
+      vector<PhraseSearcher::exact_occurrence> occ;
+      vector< vector<unsigned> > got, ref;
+      unsigned i, n;
+      
+      CPPUNIT_ASSERT(srch.scanExact(text, occ) > 0);
+      for (i = 0; i < occ.size(); i++)
+        got.push_back(occurrenceKey(occ[i]));
+      
+      // reference: standard engine for every word window, matches without penalties but caps
+      struct BestOfPhrase : public SearchVisitor {
+        map<unsigned, PhraseSearcher::exact_occurrence> best; // by phrase ID
+        virtual void visit(unsigned clsid, unsigned phrase_id, unsigned rank, int flags) {
+          if (flags & ~PhraseSearcher::MATCH_FL_DIFF_CAPS)
+            return;
+          PhraseSearcher::exact_occurrence &oc = best[phrase_id];
+          if (!oc.rank || rank > oc.rank || (rank == oc.rank && clsid < oc.clsid)) {
+            oc.phrase_id = phrase_id;
+            oc.match_flags = flags;
+            oc.clsid = clsid;
+            oc.rank = rank;
+          }
+        }
+      };
+      
+      Utf8Tokenizer tok;
+      Utf8Tokenizer::word w;
+      string norm;
+      vector<Utf8Tokenizer::word> words;
+      tok.reset(text.c_str(), text.length());
+      while (tok.next(w, norm))
+        words.push_back(w);
+      
+      for (i = 0; i < words.size(); i++) {
+        for (n = 1; n <= MAX_WORDS_SPLIT && i + n <= words.size(); n++) {
+          BestOfPhrase visitor;
+          const Utf8Tokenizer::word &last = words[i + n - 1];
+          srch.searchPhrase(text.substr(words[i].start, last.start + last.len - words[i].start), visitor);
+          
+          map<unsigned, PhraseSearcher::exact_occurrence>::iterator it;
+          for (it = visitor.best.begin(); it != visitor.best.end(); it++) {
+            it->second.first = i;
+            it->second.nwords = n;
+            ref.push_back(occurrenceKey(it->second));
+          }
+        }
+      }
+      
+      sort(got.begin(), got.end());
+      sort(ref.begin(), ref.end());
+      CPPUNIT_ASSERT_EQUAL(ref.size(), got.size());
+      CPPUNIT_ASSERT(ref == got);
+      
+      // caps differ: ranked by penalty of the second class, the first one has none
+      bool bCaps = false;
+      for (i = 0; i < occ.size(); i++) {
+        if (occ[i].match_flags == PhraseSearcher::MATCH_FL_DIFF_CAPS && occ[i].clsid == 1) {
+          CPPUNIT_ASSERT(occ[i].rank < 80);
+          bCaps = true;
+        }
+      }
+      CPPUNIT_ASSERT(bCaps);
+      
+      // class mask, caller words with limit
+      QCClassMask mask;
+      mask.add(1);
+      srch.scanExact(text, occ, &mask);
+      for (i = 0; i < occ.size(); i++)
+        CPPUNIT_ASSERT_EQUAL(1U, occ[i].clsid);
+      
+      // caller words: occurrence covers whole words, no more than maxwords of them
+      const string w1 = "КРАСНАЯ площадь", w2 = "Москвы";
+      vector< pair<unsigned, unsigned> > spans;
+      spans.push_back(make_pair((unsigned)text.find(w1), (unsigned)w1.length()));
+      spans.push_back(make_pair((unsigned)text.find(w2), (unsigned)w2.length()));
+      CPPUNIT_ASSERT_EQUAL(1U, srch.scanExact(text, spans, 1, occ));
+      CPPUNIT_ASSERT_EQUAL(0U, occ[0].first);
+      CPPUNIT_ASSERT_EQUAL(1U, occ[0].nwords);
+      CPPUNIT_ASSERT_EQUAL((int)PhraseSearcher::MATCH_FL_DIFF_CAPS, occ[0].match_flags);
+      CPPUNIT_ASSERT_EQUAL(30U, occ[0].rank);
+      CPPUNIT_ASSERT_EQUAL(2U, srch.scanExact(text, spans, 2, occ));
+      CPPUNIT_ASSERT_EQUAL(2U, occ[1].nwords);
+      CPPUNIT_ASSERT_EQUAL(string("Красная площадь Москвы"), string(srch.getOriginPhrase(occ[1].phrase_id)));
+      
+      // the same words of windows-1251 text
+      string text_cp, w1_cp, w2_cp;
+      vector<PhraseSearcher::exact_occurrence> occ_cp;
+      utf8_to_codepage(CODEPAGE_CP1251, text.data(), text.length(), text_cp);
+      utf8_to_codepage(CODEPAGE_CP1251, w1.data(), w1.length(), w1_cp);
+      utf8_to_codepage(CODEPAGE_CP1251, w2.data(), w2.length(), w2_cp);
+      spans.clear();
+      spans.push_back(make_pair((unsigned)text_cp.find(w1_cp), (unsigned)w1_cp.length()));
+      spans.push_back(make_pair((unsigned)text_cp.find(w2_cp), (unsigned)w2_cp.length()));
+      CPPUNIT_ASSERT_EQUAL(2U, srch.scanExact(text_cp, spans, 2, occ_cp, NULL, CODEPAGE_CP1251));
+      for (i = 0; i < occ.size(); i++)
+        CPPUNIT_ASSERT(occurrenceKey(occ[i]) == occurrenceKey(occ_cp[i]));
+      
+      // trie is kept by export (class subset loading)
+      PhraseIndexer idx2;
+      QCClassMask nomask;
+      PhraseIndexer idx3;
+      CPPUNIT_ASSERT_EQUAL(8U, srch.exportPhrases(idx2));
+      CPPUNIT_ASSERT_EQUAL(8U, srch.exportPhrases(idx3, &nomask)); // empty mask is all classes
+      auto_ptr_arr<char> region2 (new char[idx2.size()]);
+      MemWriter mwr2 (region2.get());
+      CPPUNIT_ASSERT_NO_THROW(idx2.save(mwr2));
+      
+      MemReader mrd2 (region2.get());
+      PhraseSearcher srch2;
+      CPPUNIT_ASSERT_NO_THROW(srch2.load(mrd2));
+      srch2.setQCIndex(&qcr);
+      CPPUNIT_ASSERT(srch2.hasExactTrie());
+      srch2.scanExact(text, occ);
+      CPPUNIT_ASSERT_EQUAL(got.size(), occ.size());
+      
+      // engine selection
+      CPPUNIT_ASSERT_EQUAL(PhraseSearcher::EXACT_ENGINE_INDEX, srch.getExactEngine());
+      srch.setExactEngine(PhraseSearcher::EXACT_ENGINE_TRIE);
+      CPPUNIT_ASSERT_EQUAL(PhraseSearcher::EXACT_ENGINE_TRIE, srch.getExactEngine());
+      PhraseSearcher empty;
+      CPPUNIT_ASSERT_THROW(empty.setExactEngine(PhraseSearcher::EXACT_ENGINE_TRIE), std::runtime_error);
+      
+      // with lemmatizer: index is the same as without trie, trie keys are words as written
+      for (int bTrie = 0; bTrie < 2; bTrie++) 
+      {
+        PhraseIndexer idxl(&lem);
+        PhraseIndexer::stat stl;
+        vector<PhraseSearcher::phrase_matched> vmatch;
+        
+        idxl.setExactTrie(bTrie != 0);
+        idxl.setFormsTable(true);
+        idxl.addPhrase(0, "парков", 100);
+        idxl.addPhrase(0, "окно", 100);
+        idxl.addWordForm("окну");
+        
+        auto_ptr_arr<char> regionl (new char[idxl.size()]);
+        MemWriter mwrl (regionl.get());
+        CPPUNIT_ASSERT_NO_THROW(idxl.save(mwrl));
+        idxl.getStat(&stl);
+        CPPUNIT_ASSERT_EQUAL(2U, stl.nforms); // ПАРКОВ, ОКНУ
+        
+        MemReader mrdl (regionl.get());
+        PhraseSearcher srchl(&lem);
+        CPPUNIT_ASSERT_NO_THROW(srchl.load(mrdl));
+        srchl.setQCIndex(&qcr);
+        CPPUNIT_ASSERT_EQUAL(bTrie != 0, srchl.hasExactTrie());
+        CPPUNIT_ASSERT_EQUAL(1U, srchl.searchPhrase("парк", vmatch));
+        CPPUNIT_ASSERT_EQUAL(2U, srchl.searchPhrase("окну парков", vmatch));
+        CPPUNIT_ASSERT_EQUAL(2U, srchl.searchPhrase("окно парк", vmatch));
+        if (bTrie) {
+          CPPUNIT_ASSERT_EQUAL(1U, srchl.scanExact("окну парков", occ));
+          CPPUNIT_ASSERT_EQUAL(1U, occ[0].first);
+        }
+      }
+    }
+    
+    /// @brief search restricted by class mask
+    void QPhraseClassMaskTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      // classes 1 and 33 share bit of folded class bitmap
+      for (unsigned i = 0; i < 34; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "class%u", i);
+        qcw.addQClass(name, pens);
+      }
+      idx.addPhrase(0, "ноутбук lenovo", 100);
+      idx.addPhrase(2, "ноутбук", 90);
+      idx.addPhrase(1, "lenovo", 30);
+      idx.addPhrase(33, "lenovo", 50);
+      idx.addPhrase(33, "lenovo thinkpad", 60);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      QCClassMask mask;
+      unsigned clsid;
+      CPPUNIT_ASSERT(qcr.getId("class1", clsid));
+      mask.add(clsid);
+      CPPUNIT_ASSERT(mask.has(1));
+      CPPUNIT_ASSERT(!mask.has(33));
+      
+      PhraseSearcher::search_stat st;
+      srch.getSearchStat(&st);
+      
+      QCResultArray res;
+      CPPUNIT_ASSERT_EQUAL(1U, srch.searchPhrase("ноутбук lenovo thinkpad", res, &mask));
+      CPPUNIT_ASSERT(res.has(1));
+      CPPUNIT_ASSERT_EQUAL(30U, res[1].rank);
+      srch.getSearchStat(&st);
+      CPPUNIT_ASSERT_MESSAGE("nothing filtered by class bitmap", st.nfiltered > 0);
+      
+      // the same without mask
+      CPPUNIT_ASSERT_EQUAL(4U, srch.searchPhrase("ноутбук lenovo thinkpad", res));
+      
+      PhraseSearcher::phrase_info info;
+      CPPUNIT_ASSERT(srch.searchBest("ноутбук lenovo", clsid, info, &mask));
+      CPPUNIT_ASSERT_EQUAL(1U, clsid);
+      CPPUNIT_ASSERT_EQUAL(30U, info.rank);
+      CPPUNIT_ASSERT(srch.searchBest("lenovo", clsid, info, &mask)); // exact word sequence
+      CPPUNIT_ASSERT_EQUAL(1U, clsid);
+      
+      std::vector<PhraseSearcher::cls_matched> top;
+      mask.add(2);
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchTopK("ноутбук lenovo thinkpad", 5, top, &mask));
+      CPPUNIT_ASSERT_EQUAL(2U, top[0].clsid);
+      CPPUNIT_ASSERT_EQUAL(1U, top[1].clsid);
+      
+      mask.clear();
+      mask.add(3);
+      CPPUNIT_ASSERT(!srch.searchBest("ноутбук lenovo", clsid, info, &mask));
+    }
+    
+    /// @brief penalties override by config: ranks and rank bounds follow new penalties
+    void QCMergeConfigTest()
+    {
+      QCIndexWriter qcw;
+      PhraseIndexer idx;
+      QCPenalties pens; // no penalties
+      
+      qcw.addQClass("first", pens);
+      qcw.addQClass("second", pens);
+      idx.addPhrase(0, "ноутбук lenovo", 60);
+      idx.addPhrase(1, "lenovo", 80);
+      
+      auto_ptr_arr<char> region (new char[qcw.size() + idx.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      CPPUNIT_ASSERT_NO_THROW(idx.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      PhraseSearcher srch;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      CPPUNIT_ASSERT_NO_THROW(srch.load(mrd));
+      srch.setQCIndex(&qcr);
+      
+      unsigned clsid;
+      PhraseSearcher::phrase_info info;
+      CPPUNIT_ASSERT(srch.searchBest("ноутбук lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(1U, clsid);
+      CPPUNIT_ASSERT_EQUAL(80U, info.rank);
+      
+      // replaced ranking is kept until it's released
+      const QCIndexReader::ranking *pold = qcr.acquireRanking();
+      CPPUNIT_ASSERT_EQUAL(3, (int)pold->nrefs); // reader, searcher and us
+      XmlConfig cfg("cfg/config_penalties.xml");
+      CPPUNIT_ASSERT_NO_THROW(qcr.mergeConfig(&cfg));
+      CPPUNIT_ASSERT(pold->getTables() != qcr.getRankTables());
+      CPPUNIT_ASSERT_EQUAL(2, (int)pold->nrefs);
+      CPPUNIT_ASSERT_EQUAL(80U, QCIndexReader::applyRank(pold->getTables()[1], 80, PhraseSearcher::MATCH_FL_PARTIAL));
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, qcr.getPenalties(1).baseRank, 1e-9);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, qcr.getPenalties(0).partial_penalty, 1e-9);
+      
+      // searcher takes new penalties with class index
+      srch.setQCIndex(&qcr);
+      CPPUNIT_ASSERT(srch.searchBest("ноутбук lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(0U, clsid);
+      CPPUNIT_ASSERT_EQUAL(60U, info.rank);
+      
+      std::vector<PhraseSearcher::cls_matched> top;
+      CPPUNIT_ASSERT_EQUAL(2U, srch.searchTopK("ноутбук lenovo", 2, top));
+      CPPUNIT_ASSERT_EQUAL(1U, top[1].clsid);
+      CPPUNIT_ASSERT_EQUAL(20U, top[1].info.rank); // 80 x 0.5 x (1 - 0.5)
+      CPPUNIT_ASSERT(srch.searchBest("lenovo", clsid, info));
+      CPPUNIT_ASSERT_EQUAL(40U, info.rank);
+      
+      // state of last search is freed by the next replacement
+      CPPUNIT_ASSERT_EQUAL(2, (int)pold->nrefs);
+      srch.setQCIndex(&qcr);
+      CPPUNIT_ASSERT_EQUAL(1, (int)pold->nrefs);
+      QCIndexReader::releaseRanking(pold);
+    }
+    
+    /// @brief ranks of rank tables are the same as of plain double arithmetic
+    void QCRankTruncationTest()
+    {
+      static const double penalties[] = { 0.0, 0.1, 0.2, 0.25, 0.3, 0.5, 0.7, 0.9, 0.95, 1.0 };
+      static const double baseRanks[] = { 1.0, 0.5, 0.3, 1.5 };
+      const unsigned npens = sizeof(penalties) / sizeof(penalties[0]);
+      const unsigned nbases = sizeof(baseRanks) / sizeof(baseRanks[0]);
+      QCIndexWriter qcw;
+      
+      for (unsigned i = 0; i < npens * nbases; i++) {
+        QCPenalties pens;
+        pens.baseRank = baseRanks[i % nbases];
+        pens.reorder_penalty = QCPenalties::penaltiToMultiplier(penalties[i % npens]);
+        pens.partial_penalty = QCPenalties::penaltiToMultiplier(penalties[(i + 3) % npens]);
+        pens.diff_form_penalty = QCPenalties::penaltiToMultiplier(penalties[(i + 7) % npens]);
+        pens.diff_caps_penalty = QCPenalties::penaltiToMultiplier(penalties[i / nbases]);
+        char name[16];
+        snprintf(name, sizeof(name), "class%u", i);
+        qcw.addQClass(name, pens);
+      }
+      QCPenalties pens;
+      pens.reorder_penalty = QCPenalties::penaltiToMultiplier(0.9);
+      pens.diff_form_penalty = QCPenalties::penaltiToMultiplier(0.3);
+      qcw.addQClass("pinned", pens);
+      
+      auto_ptr_arr<char> region (new char[qcw.size()]);
+      MemWriter mwr (region.get());
+      CPPUNIT_ASSERT_NO_THROW(qcw.save(mwr));
+      
+      MemReader mrd (region.get());
+      QCIndexReader qcr;
+      CPPUNIT_ASSERT_NO_THROW(qcr.load(mrd));
+      
+      const QCIndexReader::rank_table *tables = qcr.getRankTables();
+      for (unsigned clsid = 0; clsid < qcr.amount(); clsid++) 
+      {
+        const QCPenalties &pens = qcr.getPenalties(clsid);
+        for (int flags = 0; flags <= 0xF; flags++) {
+          for (unsigned base = 0; base < 256; base++) {
+            double rank = (double)base * pens.baseRank;
+            if (flags & PhraseSearcher::MATCH_FL_REORDERED)
+              rank *= pens.reorder_penalty;
+            if (flags & PhraseSearcher::MATCH_FL_DIFF_FORM)
+              rank *= pens.diff_form_penalty;
+            if (flags & PhraseSearcher::MATCH_FL_PARTIAL)
+              rank *= pens.partial_penalty;
+            if (flags & PhraseSearcher::MATCH_FL_DIFF_CAPS)
+              rank *= pens.diff_caps_penalty;
+            CPPUNIT_ASSERT_EQUAL((unsigned)rank, QCIndexReader::applyRank(tables[clsid], base, flags));
+          }
+        }
+      }
+      
+      // 100 x (1 - 0.9) and 90 x (1 - 0.3) are just below 10 and 63
+      unsigned clsid;
+      CPPUNIT_ASSERT(qcr.getId("pinned", clsid));
+      CPPUNIT_ASSERT_EQUAL(9U, QCIndexReader::applyRank(tables[clsid], 100, PhraseSearcher::MATCH_FL_REORDERED));
+      CPPUNIT_ASSERT_EQUAL(62U, QCIndexReader::applyRank(tables[clsid], 90, PhraseSearcher::MATCH_FL_DIFF_FORM));
+      CPPUNIT_ASSERT_EQUAL(7U, QCIndexReader::applyRank(tables[clsid], 10, PhraseSearcher::MATCH_FL_DIFF_FORM));
+    }
+    
+    /// @brief load class subset of index file
+    void PhraseCollectionLoadClassesTest()
+    {
+      PhraseCollectionIndexer idx(&lem);
+      XmlConfig cfg("cfg/config_2qc.xml");
+      
+      CPPUNIT_ASSERT_NO_THROW(idx.indexByConfig(&cfg));
+      CPPUNIT_ASSERT_NO_THROW(idx.save());
+      
+      PhraseCollectionLoader ldrFull(&lem), ldr(&lem);
+      std::vector<std::string> classes(1, "hitech");
+      CPPUNIT_ASSERT(ldrFull.loadFile("idx/2qc.idx"));
+      CPPUNIT_ASSERT(ldr.loadFile("idx/2qc.idx", false, false, &classes));
+      
+      // class IDs are the same
+      unsigned clsid, clsidFull;
+      CPPUNIT_ASSERT(ldr.getQCIndex().getId("hitech", clsid));
+      CPPUNIT_ASSERT(ldrFull.getQCIndex().getId("hitech", clsidFull));
+      CPPUNIT_ASSERT_EQUAL(clsidFull, clsid);
+      
+      PhraseSearcher::res_t res;
+      CPPUNIT_ASSERT_EQUAL(2U, ldrFull->searchPhrase("учебник", res));
+      CPPUNIT_ASSERT_EQUAL(1U, ldr->searchPhrase("учебник", res));
+      CPPUNIT_ASSERT_EQUAL(10U, res["hitech"]);
+      CPPUNIT_ASSERT_EQUAL(0U, ldr->searchPhrase("портфель", res));
+      CPPUNIT_ASSERT_EQUAL(1U, ldr->searchPhrase("телефон мобильный", res));
+      CPPUNIT_ASSERT_EQUAL(75U, res["hitech"]);
+      
+      // origins are kept
+      std::vector<PhraseSearcher::phrase_matched> vres;
+      CPPUNIT_ASSERT_EQUAL(1U, ldr->searchPhrase("коммуникатор", vres));
+      CPPUNIT_ASSERT(ldr->getOriginPhrase(vres[0].phrase_id) != NULL);
+      CPPUNIT_ASSERT_EQUAL(string("коммуникатор"), string(ldr->getOriginPhrase(vres[0].phrase_id)));
+      
+      // no listed class is in file
+      PhraseCollectionLoader ldrNone(&lem);
+      std::vector<std::string> unknown(1, "nosuchclass");
+      CPPUNIT_ASSERT(!ldrNone.loadFile("idx/2qc.idx", false, false, &unknown));
+      CPPUNIT_ASSERT(!ldrNone.is_loaded());
+    }
+    
     /// @brief index external data and check
     void PhraseCollectionIndexerTest()
     {
@@ -605,20 +1964,41 @@ class QClassifyTest : public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE (QClassifyTest);
       CPPUNIT_TEST (PtrArrayTest);
       CPPUNIT_TEST (HashArrayTest);
+      CPPUNIT_TEST (RankBitmapTest);
       CPPUNIT_TEST (EmptyHashArrayBugTest);
       CPPUNIT_TEST (QCBasicPhraseStorageTest);
       CPPUNIT_TEST (QCScatteredStringsTest);
+      CPPUNIT_TEST (QCCompactStringsTest);
       CPPUNIT_TEST (PhraseSplitterPlainTest);
+      CPPUNIT_TEST (LemmaCacheTest);
+      CPPUNIT_TEST (LemmaBypassTest);
       //CPPUNIT_TEST (PhraseSplitterPCRETest);
       //CPPUNIT_TEST (PhrasePCREWriterReaderTest);
       //CPPUNIT_TEST (PhrasePCREWriterReaderFlagsTest);
       CPPUNIT_TEST (QClassIndexerTest);
       CPPUNIT_TEST (QPhraseIndexerStatTest);
+      CPPUNIT_TEST (QPhraseSharedClassListsTest);
+      CPPUNIT_TEST (QPhraseDedupByWordsTest);
+      CPPUNIT_TEST (QPhraseWideFormatTest);
+      CPPUNIT_TEST (QPhraseFormsTableTest);
       CPPUNIT_TEST (QPhraseIndexerTest);
+      CPPUNIT_TEST (QPhraseIndexerHotKeywordTest);
       CPPUNIT_TEST (PhraseCollectionIndexerTest);
+      CPPUNIT_TEST (PhraseCollectionLoadClassesTest);
       //CPPUNIT_TEST (PhraseCollectionIndexerWithRETest);
       CPPUNIT_TEST (QPhraseIndexerRankTest);
       CPPUNIT_TEST (QPhraseGetClassesTest);
+      CPPUNIT_TEST (QPhraseShortPhrasesTest);
+      CPPUNIT_TEST (QPhrasePruningTest);
+      CPPUNIT_TEST (QPhraseSearchBestTest);
+      CPPUNIT_TEST (QPhraseSearchBestTieTest);
+      CPPUNIT_TEST (QPhraseSearchTopKTest);
+      CPPUNIT_TEST (QPhraseSearchNoAllocTest);
+      CPPUNIT_TEST (QPhraseSearchTokensTest);
+      CPPUNIT_TEST (QPhraseExactTrieTest);
+      CPPUNIT_TEST (QPhraseClassMaskTest);
+      CPPUNIT_TEST (QCMergeConfigTest);
+      CPPUNIT_TEST (QCRankTruncationTest);
     CPPUNIT_TEST_SUITE_END();
 };
 
@@ -6,6 +6,8 @@
 
 #include <stdexcept>
 #include <algorithm>
+#include <vector>
+#include <map>
 #include <cppunit/Portability.h>
 #include <cppunit/Exception.h>
 #include <cppunit/Asserter.h>
@@ -13,6 +15,54 @@
 
 #include "Interfaces/cpp/LemInterface.hpp"
 #include "utils/stringutils.hpp"
+#include "utils/utf8_tokenizer.hpp"
+#include "utils/bits/utf8_tbl.hpp"
+#include "utils/bits/html_entities_tbl.hpp"
+#include "utils/da_trie.hpp"
+#include "hashes/hashes.hpp"
+
+/// @brief ICU normalization of character (strNormalize reference)
+static void icu_normalize_char(UChar32 c, UnicodeString &us)
+{
+  if (0x0300 <= c && c <= 0x036F)
+    return;
+  if (c == 0x0401 || c == 0x0451)
+    c = 0x0415;
+  else if (u_isULowercase(c))
+    c = u_toupper(c);
+  us += c;
+}
+
+/// @brief ICU splitting to normalized words (Utf8Tokenizer reference)
+static void icu_split(const std::string &text, std::vector<std::string> &words, std::vector<bool> &upcase)
+{
+  const char *s = text.c_str();
+  int32_t length = text.length();
+  UnicodeString us;
+  std::string w;
+
+  words.clear();
+  upcase.clear();
+  for (int32_t i = 0; i <= length;) 
+  {
+    UChar32 c = -1;
+    if (i < length)
+      U8_NEXT(s, i, length, c);
+    else
+      i++;
+
+    if (u_isalnum(c)) {
+      if (us.isEmpty())
+        upcase.push_back(u_isUUppercase(c));
+      icu_normalize_char(c, us);
+    }
+    else if (!us.isEmpty()) {
+      w.clear();
+      words.push_back(us.toUTF8String(w));
+      us.truncate(0);
+    }
+  }
+}
 
 class StringUtilsTest : public CppUnit::TestFixture
 {
@@ -32,6 +82,263 @@ class StringUtilsTest : public CppUnit::TestFixture
         CHECK_NORMALIZE("Ёжики-мухрёжики", "ЕЖИКИ-МУХРЕЖИКИ");
     }
 
+    /// @brief table of two-byte characters is the same as ICU in use
+    void Utf8TableTest()
+    {
+      for (UChar32 c = 0x80; c < 0x800; c++) {
+        unsigned flags = (u_isalnum(c) ? UTF8_FL_ALNUM : 0) | (u_isUUppercase(c) ? UTF8_FL_UPPER : 0);
+        UnicodeString us;
+        icu_normalize_char(c, us);
+        
+        CPPUNIT_ASSERT_EQUAL(flags, (unsigned)UTF8_2B_FLAGS[c - 0x80]);
+        CPPUNIT_ASSERT_EQUAL(us.isEmpty() ? 0 : us.char32At(0), (UChar32)UTF8_2B_NORM[c - 0x80]);
+      }
+    }
+
+    /// @brief native splitting is the same as ICU one
+    void Utf8TokenizerTest()
+    {
+      static const char *texts[] = {
+        "", "   ", "test", "Теперь, по-русски!!!", "Ёжики-мухрёжики ёлка",
+        "a quite long ASCII text, longer than 16 bytes: 0123456789abcdefghijklmnopqrstuvwxyz_ABC",
+        "mixed:Москваmoscow1234567890123456789 straße ſ ı µ ÿ Ǆǅǆ",
+        "ελληνικά ΑΒΓ, עברית, 中文汉字, ١٢٣ आदि 😀x",
+        "broken \xD0 utf\xC0\x80-8 \xE2\x82 \xF0\x9F\x98 tail\xD0",
+        "combining: cafe\xCC\x81 naïve"
+      };
+      gogo::Utf8Tokenizer tok;
+      gogo::Utf8Tokenizer::word w;
+      std::string norm;
+      std::vector<std::string> words;
+      std::vector<bool> upcase;
+      
+      for (unsigned i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) 
+      {
+        std::string text(texts[i]);
+        
+        icu_split(text, words, upcase);
+        tok.reset(text.c_str(), text.length());
+        for (unsigned j = 0; j < words.size(); j++) {
+          CPPUNIT_ASSERT(tok.next(w, norm));
+          CPPUNIT_ASSERT_EQUAL(words[j], norm);
+          CPPUNIT_ASSERT_EQUAL((bool)upcase[j], w.upcase);
+        }
+        CPPUNIT_ASSERT(!tok.next(w, norm));
+        
+        std::string s(text), ref;
+        strNormalize(s);
+        UnicodeString us;
+        for (int32_t k = 0; k < (int32_t)text.length();) {
+          UChar32 c;
+          U8_NEXT(text.c_str(), k, (int32_t)text.length(), c);
+          if (c >= 0)
+            icu_normalize_char(c, us);
+        }
+        us.toUTF8String(ref);
+        CPPUNIT_ASSERT_EQUAL(ref, s);
+      }
+    }
+
+    /// @brief hashing by pieces and in tokenizer pass is the same as MurmurHash32A
+    void HashStreamTest()
+    {
+      std::string data("Теперь, по-русски: 0123456789abcdefghijklmnopqrstuvwxyz");
+      
+      for (size_t len = 0; len <= data.length(); len++) {
+        Hash32 ref = MurmurHash32A(data.c_str(), len);
+        for (size_t piece = 1; piece <= 5; piece++) {
+          MurmurHash32Stream h;
+          for (size_t i = 0; i < len; i += piece)
+            h.add(data.c_str() + i, std::min(piece, len - i));
+          CPPUNIT_ASSERT_EQUAL(ref, h.end());
+        }
+      }
+      
+      std::string text("Ёжики-мухрёжики, a quite long ASCII word: abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyz ёлка");
+      gogo::Utf8Tokenizer tok, tok_hash;
+      gogo::Utf8Tokenizer::word w, w_hash;
+      MurmurHash32Stream h;
+      std::string norm, norm_hash;
+      
+      tok.reset(text.c_str(), text.length());
+      tok_hash.reset(text.c_str(), text.length());
+      while (tok.next(w, norm)) {
+        CPPUNIT_ASSERT(tok_hash.next(w_hash, h, &norm_hash));
+        CPPUNIT_ASSERT_EQUAL(norm, norm_hash);
+        CPPUNIT_ASSERT_EQUAL(w.start, w_hash.start);
+        CPPUNIT_ASSERT_EQUAL(MurmurHash32A(norm.c_str(), norm.length()), h.end());
+      }
+      CPPUNIT_ASSERT(!tok_hash.next(w_hash, h, NULL));
+    }
+
+    /// @brief windows-1251 words are the same as of UTF-8 text, transcoding is reversible
+    void SingleByteTokenizerTest()
+    {
+      std::string text("Ёжики-мухрёжики, ЁЛКА ёлка; a quite long ASCII word: abcdefghijklmnopqrstuvwxyz0123456789 "
+                       "№5 €10 «Москва» — ЂђЉљЎўЈ ҐґЄєЇїІі ©®µ¶· \xC2\x98 end");
+      for (unsigned c = 0x80; c < 0x100; c++) {
+        UChar32 uc = (c == 0x98) ? 0x98 : -1;
+        char b = (char)c;
+        UnicodeString us(&b, 1, "windows-1251");
+        if (uc < 0)
+          uc = us.char32At(0);
+        std::string u;
+        UnicodeString(uc).toUTF8String(u);
+        text += " x" + u + "y" + u;
+      }
+      
+      std::string sb, back;
+      gogo::utf8_to_codepage(gogo::CODEPAGE_CP1251, text.data(), text.length(), sb);
+      gogo::codepage_to_utf8(gogo::CODEPAGE_CP1251, sb.data(), sb.length(), back);
+      CPPUNIT_ASSERT_EQUAL(text, back);
+      
+      gogo::Utf8Tokenizer tok;
+      gogo::SingleByteTokenizer sbtok(gogo::CODEPAGE_CP1251);
+      gogo::Utf8Tokenizer::word w, w_sb;
+      MurmurHash32Stream h;
+      std::string norm, norm_sb;
+      
+      tok.reset(text.data(), text.length());
+      sbtok.reset(sb.data(), sb.length());
+      while (tok.next(w, norm)) {
+        CPPUNIT_ASSERT(sbtok.next(w_sb, h, &norm_sb));
+        CPPUNIT_ASSERT_EQUAL(norm, norm_sb);
+        CPPUNIT_ASSERT_EQUAL(w.upcase, w_sb.upcase);
+        CPPUNIT_ASSERT_EQUAL(w.len, sbtok.utf8Length(w_sb));
+        CPPUNIT_ASSERT_EQUAL(MurmurHash32A(norm.c_str(), norm.length()), h.end());
+        back.clear();
+        gogo::codepage_to_utf8(gogo::CODEPAGE_CP1251, sb.data() + w_sb.start, w_sb.len, back);
+        CPPUNIT_ASSERT_EQUAL(text.substr(w.start, w.len), back);
+      }
+      CPPUNIT_ASSERT(!sbtok.next(w_sb, norm_sb));
+      
+      // characters missing from code page
+      sb.clear();
+      std::string alien("Москва 中文 ελλ");
+      gogo::utf8_to_codepage(gogo::CODEPAGE_CP1251, alien.data(), alien.length(), sb);
+      CPPUNIT_ASSERT_EQUAL((std::string)"\xCC\xEE\xF1\xEA\xE2\xE0 &#20013;&#25991; &#949;&#955;&#955;", sb);
+      
+      gogo::codepage_t cp;
+      CPPUNIT_ASSERT(gogo::parse_codepage("Windows-1251", cp) && cp == gogo::CODEPAGE_CP1251);
+      CPPUNIT_ASSERT(gogo::parse_codepage("utf-8", cp) && cp == gogo::CODEPAGE_UTF8);
+      CPPUNIT_ASSERT(!gogo::parse_codepage("koi8-r", cp));
+    }
+
+    /// @brief trie lookups are the same as of map, keys are restored from units
+    void DATrieTest()
+    {
+      std::map<std::string, uint32_t> ref;
+      gogo::DATrieBuilder tb;
+      static const char *words[] = {"КОТ", "КОТЫ", "K", "KOT", "\xFF", "ЁЖ ЁЖ", "A B C", "A B", "A"};
+      unsigned i, j;
+      
+      for (i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+        ref[words[i]] = i;
+      for (i = 0; i < 2000; i++) {
+        std::string key;
+        for (j = 0; j <= (i * 7) % 13; j++)
+          key += (char)('a' + (i * 31 + j * 17) % 26);
+        ref.insert(std::make_pair(key, ref.size()));
+      }
+      for (std::map<std::string, uint32_t>::const_iterator it = ref.begin(); it != ref.end(); it++)
+        tb.add(it->first, it->second);
+      
+      std::vector<char> region(tb.size());
+      gogo::MemWriter mwr(&region[0]);
+      tb.save(mwr);
+      
+      gogo::MemReader mrd(&region[0]);
+      gogo::DATrieReader tr;
+      tr.load(mrd);
+      
+      uint32_t val, node;
+      for (std::map<std::string, uint32_t>::const_iterator it = ref.begin(); it != ref.end(); it++) {
+        CPPUNIT_ASSERT(tr.search(it->first, val));
+        CPPUNIT_ASSERT_EQUAL(it->second, val);
+        std::string prefix = it->first.substr(0, it->first.size() - 1);
+        CPPUNIT_ASSERT_EQUAL(ref.count(prefix) != 0, tr.search(prefix, val));
+      }
+      CPPUNIT_ASSERT(!tr.search("КОТЯ", val));
+      CPPUNIT_ASSERT(!tr.search("", val));
+      
+      // walk by pieces
+      node = gogo::DATrieReader::ROOT;
+      CPPUNIT_ASSERT(tr.walk(node, "A", 1) && tr.value(node, val));
+      CPPUNIT_ASSERT_EQUAL(ref["A"], val);
+      CPPUNIT_ASSERT(tr.walk(node, " B", 2) && tr.value(node, val));
+      CPPUNIT_ASSERT_EQUAL(ref["A B"], val);
+      CPPUNIT_ASSERT(tr.walk(node, (unsigned char)' ') && !tr.value(node, val));
+      CPPUNIT_ASSERT(!tr.walk(node, (unsigned char)'D'));
+      
+      std::vector< std::pair<std::string, uint32_t> > keys, ref_keys(ref.begin(), ref.end());
+      tr.keys(keys);
+      std::sort(keys.begin(), keys.end());
+      CPPUNIT_ASSERT(keys == ref_keys);
+      
+      gogo::DATrieBuilder dup;
+      dup.add("КОТ", 1);
+      dup.add("КОТ", 2);
+      CPPUNIT_ASSERT_THROW(dup.size(), std::runtime_error);
+    }
+    
+    /// @brief every HTML5 name is found by perfect hash, numeric references are checked
+    void HtmlEntityTest()
+    {
+      uint32_t c[2];
+      unsigned i;
+      
+      for (i = 0; i < sizeof(HTML_ENTITIES) / sizeof(HTML_ENTITIES[0]); i++) {
+        std::string ref = (std::string)"&" + HTML_ENTITIES[i].name + ";x";
+        CPPUNIT_ASSERT_EQUAL(ref.length() - 1, gogo::html_entity_decode(ref.data(), ref.length(), c));
+        CPPUNIT_ASSERT_EQUAL(HTML_ENTITIES[i].c1, c[0]);
+        CPPUNIT_ASSERT_EQUAL(HTML_ENTITIES[i].c2, c[1]);
+        
+        // without ';'
+        CPPUNIT_ASSERT_EQUAL((size_t)0, gogo::html_entity_decode(ref.data(), ref.length() - 2, c));
+      }
+      
+      static const struct {
+        const char *ref;
+        size_t   len;
+        uint32_t c1, c2;
+      } refs[] = {
+        {"&nbsp;",           6, 0x00A0, 0},
+        {"&NotEqualTilde;", 15, 0x2242, 0x0338},
+        {"&#1055;",          7, 0x041F, 0},
+        {"&#x41F;",          7, 0x041F, 0},
+        {"&#X41f;",          7, 0x041F, 0},
+        {"&#039;",           6, 0x0027, 0},
+        {"&#150;",           6, 0x2013, 0}, // windows-1252
+        {"&#129;",           6, 0x0081, 0},
+        {"&#0;",             4, 0xFFFD, 0},
+        {"&#xD800;",         8, 0xFFFD, 0},
+        {"&#99999999999;",  14, 0xFFFD, 0},
+        {"&nbsp",            0, 0, 0},
+        {"&Nbsp;",           0, 0, 0},
+        {"&nbspx;",          0, 0, 0},
+        {"&#;",              0, 0, 0},
+        {"&#x;",             0, 0, 0},
+        {"&#12a;",           0, 0, 0},
+        {"&;",               0, 0, 0},
+        {"lt;",              0, 0, 0},
+        {"&CounterClockwiseContourIntegralX;", 0, 0, 0}
+      };
+      for (i = 0; i < sizeof(refs) / sizeof(refs[0]); i++) {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE(refs[i].ref, refs[i].len, gogo::html_entity_decode(refs[i].ref, strlen(refs[i].ref), c));
+        if (refs[i].len) {
+          CPPUNIT_ASSERT_EQUAL_MESSAGE(refs[i].ref, refs[i].c1, c[0]);
+          CPPUNIT_ASSERT_EQUAL_MESSAGE(refs[i].ref, refs[i].c2, c[1]);
+        }
+      }
+      CPPUNIT_ASSERT_EQUAL((size_t)0, gogo::html_entity_decode("&lt;", 3, c));
+      
+      std::string s;
+      CPPUNIT_ASSERT(gogo::append_codepage_char(gogo::CODEPAGE_UTF8, 0x041F, s));
+      CPPUNIT_ASSERT(gogo::append_codepage_char(gogo::CODEPAGE_CP1251, 0x041F, s));
+      CPPUNIT_ASSERT(!gogo::append_codepage_char(gogo::CODEPAGE_CP1251, 0x4E2D, s));
+      CPPUNIT_ASSERT_EQUAL((std::string)"П\xCF", s);
+    }
+    
     void LemInterfaceTest()
     {
         LemInterface lem(true /* UTF8 */);
@@ -44,6 +351,12 @@ class StringUtilsTest : public CppUnit::TestFixture
 
     CPPUNIT_TEST_SUITE (StringUtilsTest);
       CPPUNIT_TEST (NormalizeTest);
+      CPPUNIT_TEST (Utf8TableTest);
+      CPPUNIT_TEST (Utf8TokenizerTest);
+      CPPUNIT_TEST (HashStreamTest);
+      CPPUNIT_TEST (SingleByteTokenizerTest);
+      CPPUNIT_TEST (DATrieTest);
+      CPPUNIT_TEST (HtmlEntityTest);
       CPPUNIT_TEST (LemInterfaceTest);
     CPPUNIT_TEST_SUITE_END();
 };